@@ -40,6 +40,34 @@ AC_DEFUN([AX_LIBHMAC_CHECK_LOCAL],
     [test "x$ac_cv_libcrypto" = xno || test "x$ac_cv_libcrypto_sha512" = xno],
     [ac_cv_libhmac_sha512=local],
     [ac_cv_libhmac_sha512=$ac_cv_libcrypto_sha512])
+
+  dnl Check for runtime CPU feature detection and kernel selection support
+  AC_CHECK_HEADERS([cpuid.h immintrin.h])
+  AC_CHECK_FUNCS([getenv])
+
+  AC_CACHE_CHECK(
+    [whether the compiler supports the x86 target function attribute],
+    [ac_cv_libhmac_x86_target_attribute],
+    [AC_LANG_PUSH(C)
+    AC_LINK_IFELSE(
+      [AC_LANG_PROGRAM(
+        [[#include <immintrin.h>
+
+__attribute__((target("sse4.1,sha"))) static int test_sha( int *values ) { __m128i value = _mm_loadu_si128( (__m128i *) values ); value = _mm_sha256rnds2_epu32( value, value, value ); return( _mm_cvtsi128_si32( value ) ); }
+__attribute__((target("avx2,bmi2"))) static int test_avx2( int *values ) { __m256i value = _mm256_loadu_si256( (__m256i *) values ); value = _mm256_add_epi32( value, value ); return( _mm256_extract_epi32( value, 0 ) ); }
+__attribute__((target("avx512f,avx512bw,avx512vl"))) static int test_avx512( int *values ) { __m512i value = _mm512_loadu_si512( values ); value = _mm512_rol_epi32( value, 5 ); return( _mm512_reduce_add_epi32( value ) ); }]],
+        [[int values[ 16 ] = { 0 };
+return( test_sha( values ) + test_avx2( values ) + test_avx512( values ) );]] )],
+      [ac_cv_libhmac_x86_target_attribute=yes],
+      [ac_cv_libhmac_x86_target_attribute=no])
+    AC_LANG_POP(C)])
+
+  AS_IF(
+    [test "x$ac_cv_libhmac_x86_target_attribute" = xyes],
+    [AC_DEFINE(
+      [HAVE_X86_TARGET_ATTRIBUTE],
+      [1],
+      [Define to 1 if the compiler supports the x86 target function attribute.])])
   ])
 
 dnl Function to detect if hmactools dependencies are available
@@ -0,0 +1,63 @@
+/*
+ * Atomic access functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBHMAC_ATOMIC_H )
+#define _LIBHMAC_ATOMIC_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* Retrieves and sets 32-bit values that are determined on first use and shared between threads
+ * A value that is set is visible to threads that retrieve it afterwards
+ */
+#if defined( __ATOMIC_ACQUIRE ) && defined( __ATOMIC_RELEASE )
+#define libhmac_atomic_get_32bit( value ) \
+	__atomic_load_n( value, __ATOMIC_ACQUIRE )
+
+#define libhmac_atomic_set_32bit( value, new_value ) \
+	__atomic_store_n( value, new_value, __ATOMIC_RELEASE )
+
+#elif defined( WINAPI )
+#define libhmac_atomic_get_32bit( value ) \
+	InterlockedCompareExchange( (LONG volatile *) ( value ), 0, 0 )
+
+#define libhmac_atomic_set_32bit( value, new_value ) \
+	InterlockedExchange( (LONG volatile *) ( value ), (LONG) ( new_value ) )
+
+#else
+#define libhmac_atomic_get_32bit( value ) \
+	*( value )
+
+#define libhmac_atomic_set_32bit( value, new_value ) \
+	*( value ) = new_value
+
+#endif
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBHMAC_ATOMIC_H ) */
+
@@ -0,0 +1,217 @@
+/*
+ * CPU feature detection functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libhmac_atomic.h"
+#include "libhmac_cpu.h"
+
+#if defined( LIBHMAC_HAVE_X86_KERNELS ) && defined( _MSC_VER )
+#include <intrin.h>
+#include <immintrin.h>
+
+#elif defined( LIBHMAC_HAVE_X86_KERNELS )
+#include <cpuid.h>
+#endif
+
+/* The CPU features, determined on first use
+ */
+static uint32_t libhmac_cpu_features = 0;
+
+#if defined( LIBHMAC_HAVE_X86_KERNELS )
+
+/* Executes the CPUID instruction for a specific leaf and sub leaf
+ * Returns 1 if successful or 0 if the leaf is not supported
+ */
+static int libhmac_cpu_cpuid(
+            uint32_t leaf,
+            uint32_t sub_leaf,
+            uint32_t registers[ 4 ] )
+{
+#if defined( _MSC_VER )
+	int cpu_info[ 4 ];
+
+	__cpuid(
+	 cpu_info,
+	 0 );
+
+	if( (uint32_t) cpu_info[ 0 ] < leaf )
+	{
+		return( 0 );
+	}
+	__cpuidex(
+	 cpu_info,
+	 (int) leaf,
+	 (int) sub_leaf );
+
+	registers[ 0 ] = (uint32_t) cpu_info[ 0 ];
+	registers[ 1 ] = (uint32_t) cpu_info[ 1 ];
+	registers[ 2 ] = (uint32_t) cpu_info[ 2 ];
+	registers[ 3 ] = (uint32_t) cpu_info[ 3 ];
+#else
+	if( __get_cpuid_max( 0, NULL ) < leaf )
+	{
+		return( 0 );
+	}
+	__cpuid_count(
+	 leaf,
+	 sub_leaf,
+	 registers[ 0 ],
+	 registers[ 1 ],
+	 registers[ 2 ],
+	 registers[ 3 ] );
+#endif
+	return( 1 );
+}
+
+/* Reads the extended control register (XCR0) that indicates
+ * the register states the operating system saves on a context switch
+ */
+static uint32_t libhmac_cpu_xgetbv(
+                 void )
+{
+#if defined( _MSC_VER )
+	return( (uint32_t) _xgetbv( 0 ) );
+#else
+	uint32_t eax = 0;
+	uint32_t edx = 0;
+
+	__asm__ __volatile__ (
+	 "xgetbv"
+	 : "=a" ( eax ), "=d" ( edx )
+	 : "c" ( 0 ) );
+
+	return( eax );
+#endif
+}
+
+/* Determines the CPU features
+ * Returns the CPU feature flags
+ */
+static uint32_t libhmac_cpu_determine_features(
+                 void )
+{
+	uint32_t registers[ 4 ];
+
+	uint32_t extended_control_register = 0;
+	uint32_t features                  = 0;
+	uint8_t avx_state_enabled          = 0;
+	uint8_t avx512_state_enabled       = 0;
+
+	if( libhmac_cpu_cpuid(
+	     1,
+	     0,
+	     registers ) == 0 )
+	{
+		return( 0 );
+	}
+	if( ( registers[ 2 ] & 0x00000200UL ) != 0 )
+	{
+		features |= LIBHMAC_CPU_FEATURE_FLAG_SSSE3;
+	}
+	if( ( registers[ 2 ] & 0x00080000UL ) != 0 )
+	{
+		features |= LIBHMAC_CPU_FEATURE_FLAG_SSE4_1;
+	}
+	/* The AVX registers can only be used if the operating system
+	 * has enabled XSAVE and saves the XMM and YMM (and ZMM) state
+	 */
+	if( ( registers[ 2 ] & 0x08000000UL ) != 0 )
+	{
+		extended_control_register = libhmac_cpu_xgetbv();
+
+		if( ( extended_control_register & 0x00000006UL ) == 0x00000006UL )
+		{
+			avx_state_enabled = 1;
+		}
+		if( ( extended_control_register & 0x000000e6UL ) == 0x000000e6UL )
+		{
+			avx512_state_enabled = 1;
+		}
+	}
+	if( ( avx_state_enabled != 0 )
+	 && ( ( registers[ 2 ] & 0x10000000UL ) != 0 ) )
+	{
+		features |= LIBHMAC_CPU_FEATURE_FLAG_AVX;
+	}
+	if( libhmac_cpu_cpuid(
+	     7,
+	     0,
+	     registers ) != 0 )
+	{
+		if( ( avx_state_enabled != 0 )
+		 && ( ( registers[ 1 ] & 0x00000020UL ) != 0 ) )
+		{
+			features |= LIBHMAC_CPU_FEATURE_FLAG_AVX2;
+		}
+		if( ( registers[ 1 ] & 0x00000100UL ) != 0 )
+		{
+			features |= LIBHMAC_CPU_FEATURE_FLAG_BMI2;
+		}
+		if( avx512_state_enabled != 0 )
+		{
+			if( ( registers[ 1 ] & 0x00010000UL ) != 0 )
+			{
+				features |= LIBHMAC_CPU_FEATURE_FLAG_AVX512F;
+			}
+			if( ( registers[ 1 ] & 0x40000000UL ) != 0 )
+			{
+				features |= LIBHMAC_CPU_FEATURE_FLAG_AVX512BW;
+			}
+			if( ( registers[ 1 ] & 0x80000000UL ) != 0 )
+			{
+				features |= LIBHMAC_CPU_FEATURE_FLAG_AVX512VL;
+			}
+		}
+		if( ( registers[ 1 ] & 0x20000000UL ) != 0 )
+		{
+			features |= LIBHMAC_CPU_FEATURE_FLAG_SHA;
+		}
+	}
+	return( features );
+}
+
+#endif /* defined( LIBHMAC_HAVE_X86_KERNELS ) */
+
+/* Retrieves the CPU features
+ * The CPU features are determined once, concurrent callers determine the same value
+ * Returns the CPU feature flags
+ */
+uint32_t libhmac_cpu_get_features(
+          void )
+{
+	uint32_t features = (uint32_t) libhmac_atomic_get_32bit( &libhmac_cpu_features );
+
+	if( features == 0 )
+	{
+#if defined( LIBHMAC_HAVE_X86_KERNELS )
+		features = libhmac_cpu_determine_features();
+#endif
+		features |= LIBHMAC_CPU_FEATURE_FLAG_INITIALIZED;
+
+		libhmac_atomic_set_32bit(
+		 &libhmac_cpu_features,
+		 features );
+	}
+	return( features & ~( LIBHMAC_CPU_FEATURE_FLAG_INITIALIZED ) );
+}
+
@@ -0,0 +1,73 @@
+/*
+ * CPU feature detection functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBHMAC_CPU_H )
+#define _LIBHMAC_CPU_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The x86 kernels are only build when the compiler can target
+ * instruction set extensions per function
+ */
+#if ( defined( __x86_64__ ) || defined( __i386__ ) ) && defined( HAVE_CPUID_H ) && defined( HAVE_IMMINTRIN_H ) && defined( HAVE_X86_TARGET_ATTRIBUTE )
+#define LIBHMAC_HAVE_X86_KERNELS
+
+#define LIBHMAC_X86_TARGET( features ) \
+	__attribute__((target( features )))
+
+#elif defined( _MSC_VER ) && ( _MSC_VER >= 1910 ) && defined( _M_X64 )
+#define LIBHMAC_HAVE_X86_KERNELS
+
+#define LIBHMAC_X86_TARGET( features )
+
+#endif
+
+enum LIBHMAC_CPU_FEATURE_FLAGS
+{
+	LIBHMAC_CPU_FEATURE_FLAG_SSSE3		= 0x00000001UL,
+	LIBHMAC_CPU_FEATURE_FLAG_SSE4_1		= 0x00000002UL,
+	LIBHMAC_CPU_FEATURE_FLAG_AVX		= 0x00000004UL,
+	LIBHMAC_CPU_FEATURE_FLAG_AVX2		= 0x00000008UL,
+	LIBHMAC_CPU_FEATURE_FLAG_BMI2		= 0x00000010UL,
+	LIBHMAC_CPU_FEATURE_FLAG_AVX512F	= 0x00000020UL,
+	LIBHMAC_CPU_FEATURE_FLAG_AVX512BW	= 0x00000040UL,
+	LIBHMAC_CPU_FEATURE_FLAG_AVX512VL	= 0x00000080UL,
+	LIBHMAC_CPU_FEATURE_FLAG_SHA		= 0x00000100UL,
+
+	/* Flag to indicate the features have been determined
+	 */
+	LIBHMAC_CPU_FEATURE_FLAG_INITIALIZED	= 0x40000000UL
+};
+
+uint32_t libhmac_cpu_get_features(
+          void );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBHMAC_CPU_H ) */
+
@@ -0,0 +1,347 @@
+/*
+ * Kernel functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "libhmac_atomic.h"
+#include "libhmac_cpu.h"
+#include "libhmac_definitions.h"
+#include "libhmac_kernel.h"
+#include "libhmac_libcerror.h"
+#include "libhmac_md5_context.h"
+#include "libhmac_md5_multi_buffer.h"
+#include "libhmac_sha1_context.h"
+#include "libhmac_sha1_multi_buffer.h"
+#include "libhmac_sha224_context.h"
+#include "libhmac_sha256_context.h"
+#include "libhmac_sha256_multi_buffer.h"
+#include "libhmac_sha512_context.h"
+#include "libhmac_sha512_multi_buffer.h"
+
+/* The kernel type forced by the LIBHMAC_KERNEL environment variable
+ * -1 if not yet determined or 0 if not forced
+ */
+static int libhmac_kernel_forced_type = -1;
+
+/* Determines if a kernel type is supported by the CPU
+ * Returns 1 if supported or 0 if not
+ */
+int libhmac_kernel_is_supported(
+     int kernel_type )
+{
+	uint32_t required_features = 0;
+
+	switch( kernel_type )
+	{
+		case LIBHMAC_KERNEL_TYPE_PORTABLE:
+			return( 1 );
+
+#if defined( LIBHMAC_HAVE_X86_KERNELS )
+		case LIBHMAC_KERNEL_TYPE_SSSE3:
+			required_features = LIBHMAC_CPU_FEATURE_FLAG_SSSE3;
+			break;
+
+		case LIBHMAC_KERNEL_TYPE_AVX2:
+			required_features = LIBHMAC_CPU_FEATURE_FLAG_AVX
+			                  | LIBHMAC_CPU_FEATURE_FLAG_AVX2
+			                  | LIBHMAC_CPU_FEATURE_FLAG_BMI2;
+			break;
+
+		case LIBHMAC_KERNEL_TYPE_AVX512:
+			required_features = LIBHMAC_CPU_FEATURE_FLAG_AVX
+			                  | LIBHMAC_CPU_FEATURE_FLAG_AVX2
+			                  | LIBHMAC_CPU_FEATURE_FLAG_BMI2
+			                  | LIBHMAC_CPU_FEATURE_FLAG_AVX512F
+			                  | LIBHMAC_CPU_FEATURE_FLAG_AVX512BW
+			                  | LIBHMAC_CPU_FEATURE_FLAG_AVX512VL;
+			break;
+
+		case LIBHMAC_KERNEL_TYPE_SHA_NI:
+			required_features = LIBHMAC_CPU_FEATURE_FLAG_SSSE3
+			                  | LIBHMAC_CPU_FEATURE_FLAG_SSE4_1
+			                  | LIBHMAC_CPU_FEATURE_FLAG_SHA;
+			break;
+#endif /* defined( LIBHMAC_HAVE_X86_KERNELS ) */
+
+		default:
+			return( 0 );
+	}
+	if( ( libhmac_cpu_get_features() & required_features ) != required_features )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the kernel type forced by the LIBHMAC_KERNEL environment variable
+ * Supported values are: portable, ssse3, avx2, avx512 and sha-ni
+ * Returns the kernel type or 0 if not forced
+ */
+int libhmac_kernel_get_forced_type(
+     void )
+{
+	const char *kernel_name = NULL;
+	size_t kernel_name_length = 0;
+	int kernel_type           = libhmac_atomic_get_32bit( &libhmac_kernel_forced_type );
+
+	if( kernel_type != -1 )
+	{
+		return( kernel_type );
+	}
+	kernel_type = 0;
+
+#if defined( HAVE_GETENV ) || defined( WINAPI )
+	kernel_name = getenv(
+	               "LIBHMAC_KERNEL" );
+#endif
+	if( kernel_name != NULL )
+	{
+		kernel_name_length = narrow_string_length(
+		                      kernel_name );
+
+		if( kernel_name_length == 4 )
+		{
+			if( narrow_string_compare(
+			     kernel_name,
+			     "avx2",
+			     4 ) == 0 )
+			{
+				kernel_type = LIBHMAC_KERNEL_TYPE_AVX2;
+			}
+		}
+		else if( kernel_name_length == 5 )
+		{
+			if( narrow_string_compare(
+			     kernel_name,
+			     "ssse3",
+			     5 ) == 0 )
+			{
+				kernel_type = LIBHMAC_KERNEL_TYPE_SSSE3;
+			}
+		}
+		else if( kernel_name_length == 6 )
+		{
+			if( narrow_string_compare(
+			     kernel_name,
+			     "avx512",
+			     6 ) == 0 )
+			{
+				kernel_type = LIBHMAC_KERNEL_TYPE_AVX512;
+			}
+			else if( narrow_string_compare(
+			          kernel_name,
+			          "sha-ni",
+			          6 ) == 0 )
+			{
+				kernel_type = LIBHMAC_KERNEL_TYPE_SHA_NI;
+			}
+		}
+		else if( kernel_name_length == 8 )
+		{
+			if( narrow_string_compare(
+			     kernel_name,
+			     "portable",
+			     8 ) == 0 )
+			{
+				kernel_type = LIBHMAC_KERNEL_TYPE_PORTABLE;
+			}
+		}
+	}
+	libhmac_atomic_set_32bit(
+	 &libhmac_kernel_forced_type,
+	 kernel_type );
+
+	return( kernel_type );
+}
+
+/* Selects a kernel from a list of kernel types in order of preference
+ * The last kernel type in the list is expected to be the portable kernel
+ * If a kernel type is forced the forced kernel type is selected if available
+ * otherwise the portable kernel is selected
+ * Returns the index of the selected kernel type
+ */
+int libhmac_kernel_select(
+     const int *kernel_types,
+     int number_of_kernel_types )
+{
+	int forced_kernel_type = 0;
+	int kernel_index       = 0;
+
+	forced_kernel_type = libhmac_kernel_get_forced_type();
+
+	for( kernel_index = 0;
+	     kernel_index < ( number_of_kernel_types - 1 );
+	     kernel_index++ )
+	{
+		if( ( forced_kernel_type != 0 )
+		 && ( kernel_types[ kernel_index ] != forced_kernel_type ) )
+		{
+			continue;
+		}
+		if( libhmac_kernel_is_supported(
+		     kernel_types[ kernel_index ] ) != 0 )
+		{
+			break;
+		}
+	}
+	return( kernel_index );
+}
+
+/* Retrieves the type of the kernel used to calculate a specific hash
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_get_kernel_type(
+     int hash_algorithm,
+     int *kernel_type,
+     libcerror_error_t **error )
+{
+	static char *function = "libhmac_get_kernel_type";
+
+	if( kernel_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid kernel type.",
+		 function );
+
+		return( -1 );
+	}
+	switch( hash_algorithm )
+	{
+		case LIBHMAC_HASH_ALGORITHM_MD5:
+			*kernel_type = libhmac_md5_context_get_kernel_type();
+			break;
+
+		case LIBHMAC_HASH_ALGORITHM_SHA1:
+			*kernel_type = libhmac_sha1_context_get_kernel_type();
+			break;
+
+		case LIBHMAC_HASH_ALGORITHM_SHA224:
+			*kernel_type = libhmac_sha224_context_get_kernel_type();
+			break;
+
+		case LIBHMAC_HASH_ALGORITHM_SHA256:
+			*kernel_type = libhmac_sha256_context_get_kernel_type();
+			break;
+
+		case LIBHMAC_HASH_ALGORITHM_SHA512:
+			*kernel_type = libhmac_sha512_context_get_kernel_type();
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported hash algorithm.",
+			 function );
+
+			return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the type of the kernel used to calculate multiple hashes at once
+ * Returns 1 if successful, 0 if no multi-buffer kernel is used or -1 on error
+ */
+int libhmac_get_multi_buffer_kernel_type(
+     int hash_algorithm,
+     int *kernel_type,
+     libcerror_error_t **error )
+{
+	static char *function        = "libhmac_get_multi_buffer_kernel_type";
+	int multi_buffer_kernel_type = LIBHMAC_KERNEL_TYPE_PORTABLE;
+
+	if( kernel_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid kernel type.",
+		 function );
+
+		return( -1 );
+	}
+	switch( hash_algorithm )
+	{
+		case LIBHMAC_HASH_ALGORITHM_MD5:
+#if !defined( LIBHMAC_HAVE_MD5_SUPPORT )
+			multi_buffer_kernel_type = libhmac_md5_multi_buffer_get_kernel_type();
+#endif
+			break;
+
+		case LIBHMAC_HASH_ALGORITHM_SHA1:
+#if !defined( LIBHMAC_HAVE_SHA1_SUPPORT )
+			multi_buffer_kernel_type = libhmac_sha1_multi_buffer_get_kernel_type();
+#endif
+			break;
+
+		/* SHA-224 uses the SHA-256 multi-buffer kernels
+		 */
+		case LIBHMAC_HASH_ALGORITHM_SHA224:
+#if !defined( LIBHMAC_HAVE_SHA224_SUPPORT ) && !defined( LIBHMAC_HAVE_SHA256_SUPPORT )
+			multi_buffer_kernel_type = libhmac_sha256_multi_buffer_get_kernel_type();
+#endif
+			break;
+
+		case LIBHMAC_HASH_ALGORITHM_SHA256:
+#if !defined( LIBHMAC_HAVE_SHA256_SUPPORT )
+			multi_buffer_kernel_type = libhmac_sha256_multi_buffer_get_kernel_type();
+#endif
+			break;
+
+		case LIBHMAC_HASH_ALGORITHM_SHA512:
+#if !defined( LIBHMAC_HAVE_SHA512_SUPPORT )
+			multi_buffer_kernel_type = libhmac_sha512_multi_buffer_get_kernel_type();
+#endif
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported hash algorithm.",
+			 function );
+
+			return( -1 );
+	}
+	/* The multi-buffer functions fall back to the single-stream kernels
+	 * when only the portable multi-buffer kernel is available
+	 */
+	if( multi_buffer_kernel_type == LIBHMAC_KERNEL_TYPE_PORTABLE )
+	{
+		return( 0 );
+	}
+	*kernel_type = multi_buffer_kernel_type;
+
+	return( 1 );
+}
+
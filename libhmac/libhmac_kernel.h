@@ -0,0 +1,120 @@
+/*
+ * Kernel functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBHMAC_KERNEL_H )
+#define _LIBHMAC_KERNEL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libhmac_extern.h"
+#include "libhmac_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* Transforms a number of blocks into hash values with 32-bit words
+ * as used by MD5, SHA-1, SHA-224 and SHA-256
+ * Returns 1 if successful or -1 on error
+ */
+typedef int (*libhmac_kernel_transform_32bit_function_t)(
+              uint32_t *hash_values,
+              const uint8_t *buffer,
+              size_t number_of_blocks );
+
+/* Transforms a number of blocks into hash values with 64-bit words
+ * as used by SHA-512
+ * Returns 1 if successful or -1 on error
+ */
+typedef int (*libhmac_kernel_transform_64bit_function_t)(
+              uint64_t *hash_values,
+              const uint8_t *buffer,
+              size_t number_of_blocks );
+
+/* Transforms a single block, of which the message schedule is precomputed, into hash values with 32-bit words
+ * The message schedule contains the extended 32-bit message values with the round constants added
+ * Returns 1 if successful or -1 on error
+ */
+typedef int (*libhmac_kernel_schedule_transform_32bit_function_t)(
+              uint32_t *hash_values,
+              const uint32_t *schedule );
+
+/* Transforms a number of blocks of two independent messages into hash values with 32-bit words
+ * The blocks of the first buffer are transformed into the first hash values
+ * and the blocks of the second buffer into the second hash values
+ * Returns 1 if successful or -1 on error
+ */
+typedef int (*libhmac_kernel_pair_transform_32bit_function_t)(
+              uint32_t *first_hash_values,
+              const uint8_t *first_buffer,
+              uint32_t *second_hash_values,
+              const uint8_t *second_buffer,
+              size_t number_of_blocks );
+
+/* Transforms a number of blocks of independent messages in lanes into hash values with 32-bit words
+ * The hash values are stored per word, hash value 0 of every lane followed by hash value 1 of every lane, etc.
+ * Every lane transforms the number of blocks from its own buffer
+ * Returns 1 if successful or -1 on error
+ */
+typedef int (*libhmac_kernel_multi_buffer_transform_32bit_function_t)(
+              uint32_t *lanes_hash_values,
+              const uint8_t **lanes_buffer,
+              size_t number_of_blocks );
+
+/* Transforms a number of blocks of independent messages in lanes into hash values with 64-bit words
+ * The hash values are stored per word, hash value 0 of every lane followed by hash value 1 of every lane, etc.
+ * Every lane transforms the number of blocks from its own buffer
+ * Returns 1 if successful or -1 on error
+ */
+typedef int (*libhmac_kernel_multi_buffer_transform_64bit_function_t)(
+              uint64_t *lanes_hash_values,
+              const uint8_t **lanes_buffer,
+              size_t number_of_blocks );
+
+int libhmac_kernel_is_supported(
+     int kernel_type );
+
+int libhmac_kernel_get_forced_type(
+     void );
+
+int libhmac_kernel_select(
+     const int *kernel_types,
+     int number_of_kernel_types );
+
+LIBHMAC_EXTERN \
+int libhmac_get_kernel_type(
+     int hash_algorithm,
+     int *kernel_type,
+     libcerror_error_t **error );
+
+LIBHMAC_EXTERN \
+int libhmac_get_multi_buffer_kernel_type(
+     int hash_algorithm,
+     int *kernel_type,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBHMAC_KERNEL_H ) */
+
@@ -33,345 +33,227 @@
 
 #endif
 
+#include "libhmac_atomic.h"
 #include "libhmac_byte_stream.h"
 #include "libhmac_definitions.h"
+#include "libhmac_kernel.h"
 #include "libhmac_libcerror.h"
 #include "libhmac_md5_context.h"
 
-#if !defined( LIBHMAC_HAVE_MD5_SUPPORT )
-
-/* RFC 1321 based MD5 functions
+/* Structure used to determine the alignment of the internal context
  */
+typedef struct libhmac_md5_context_alignment libhmac_md5_context_alignment_t;
 
-/* TODO decription what these values are based on
- */
-static uint32_t libhmac_md5_context_fixed_constants[ 4 ] = {
-	0x67452301UL, 0xefcdab89UL, 0x98badcfeUL, 0x10325476UL
-};
+struct libhmac_md5_context_alignment
+{
+	/* Dummy value to offset the internal context
+	 */
+	uint8_t dummy;
 
-/* The first 32-bits of the sines (in radians) of the first 64 integers [ 0, 63 ]
- */
-static uint32_t libhmac_md5_context_sines[ 64 ] = {
-	0xd76aa478UL, 0xe8c7b756UL, 0x242070dbUL, 0xc1bdceeeUL,
-	0xf57c0fafUL, 0x4787c62aUL, 0xa8304613UL, 0xfd469501UL,
-	0x698098d8UL, 0x8b44f7afUL, 0xffff5bb1UL, 0x895cd7beUL,
-	0x6b901122UL, 0xfd987193UL, 0xa679438eUL, 0x49b40821UL,
-	0xf61e2562UL, 0xc040b340UL, 0x265e5a51UL, 0xe9b6c7aaUL,
-	0xd62f105dUL, 0x02441453UL, 0xd8a1e681UL, 0xe7d3fbc8UL,
-	0x21e1cde6UL, 0xc33707d6UL, 0xf4d50d87UL, 0x455a14edUL,
-	0xa9e3e905UL, 0xfcefa3f8UL, 0x676f02d9UL, 0x8d2a4c8aUL,
-	0xfffa3942UL, 0x8771f681UL, 0x6d9d6122UL, 0xfde5380cUL,
-	0xa4beea44UL, 0x4bdecfa9UL, 0xf6bb4b60UL, 0xbebfbc70UL,
-	0x289b7ec6UL, 0xeaa127faUL, 0xd4ef3085UL, 0x04881d05UL,
-	0xd9d4d039UL, 0xe6db99e5UL, 0x1fa27cf8UL, 0xc4ac5665UL,
-	0xf4292244UL, 0x432aff97UL, 0xab9423a7UL, 0xfc93a039UL,
-	0x655b59c3UL, 0x8f0ccc92UL, 0xffeff47dUL, 0x85845dd1UL,
-	0x6fa87e4fUL, 0xfe2ce6e0UL, 0xa3014314UL, 0x4e0811a1UL,
-	0xf7537e82UL, 0xbd3af235UL, 0x2ad7d2bbUL, 0xeb86d391UL
+	/* The internal context
+	 */
+	libhmac_internal_md5_context_t internal_context;
 };
 
-/* The bit shifts
+/* RFC 1321 based MD5 functions
  */
-static uint8_t libhmac_md5_context_bit_shifts[ 64 ] = {
-	7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22,
-	5,  9, 14, 20, 5,  9, 14, 20, 5,  9, 14, 20, 5,  9, 14, 20,
-	4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23,
-	6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21
-};
 
-#if !defined( LIBHMAC_UNFOLLED_LOOPS )
+#if !defined( LIBHMAC_HAVE_MD5_SUPPORT )
 
-/* The 32-bit values indexes
- * [  0, 15 ] => index
- * [ 16, 31 ] => ( ( 5 x index ) + 1 ) mod 16
- * [ 32, 47 ] => ( ( 3 x index ) + 5 ) mod 16
- * [ 48, 63 ] => ( 7 x index ) mod 16
+/* TODO decription what these values are based on
  */
-static uint8_t libhmac_md5_context_values_32bit_index[ 64 ] = {
-	0, 1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15,
-	1, 6, 11,  0,  5, 10, 15,  4,  9, 14,  3,  8, 13,  2,  7, 12,
-	5, 8, 11, 14,  1,  4,  7, 10, 13,  0,  3,  6,  9, 12, 15,  2,
-	0, 7, 14,  5, 12,  3, 10,  1,  8, 15,  6, 13,  4, 11,  2,  9
+static uint32_t libhmac_md5_context_fixed_constants[ 4 ] = {
+	0x67452301UL, 0xefcdab89UL, 0x98badcfeUL, 0x10325476UL
 };
 
-#endif /* !defined( LIBHMAC_UNFOLLED_LOOPS ) */
+#endif /* !defined( LIBHMAC_HAVE_MD5_SUPPORT ) */
 
-#define libhmac_md5_context_transform_unfolded_calculate_hash_value_round1( values_32bit, value_32bit_index, hash_values, hash_value_index0, hash_value_index1, hash_value_index2, hash_value_index3, block_index ) \
-	hash_values[ hash_value_index0 ] += ( hash_values[ hash_value_index1 ] & hash_values[ hash_value_index2 ] ) \
-	                                  | ( ~( hash_values[ hash_value_index1 ] ) & hash_values[ hash_value_index3 ] ); \
-	hash_values[ hash_value_index0 ] += values_32bit[ value_32bit_index ]; \
-	hash_values[ hash_value_index0 ] += libhmac_md5_context_sines[ block_index ]; \
+/* The round functions add the message value and sine first, since these do not depend
+ * on the preceding round, and use forms with a short dependency chain on the result of
+ * the preceding round in hash_value_index1
+ *
+ * F( b, c, d ) = ( b & c ) | ( ~b & d ) = ( ( c ^ d ) & b ) ^ d
+ * G( b, c, d ) = ( b & d ) | ( c & ~d ) = ( c & ~d ) + ( b & d ), since both terms have no bits in common
+ * H( b, c, d ) = b ^ c ^ d = ( c ^ d ) ^ b
+ * I( b, c, d ) = c ^ ( b | ~d )
+ *
+ * The sines are the first 32-bits of the sines (in radians) of the first 64 integers [ 0, 63 ]
+ */
+#define libhmac_md5_context_transform_calculate_hash_value_round1( values_32bit, value_32bit_index, hash_values, hash_value_index0, hash_value_index1, hash_value_index2, hash_value_index3, sine, bit_shift ) \
+	hash_values[ hash_value_index0 ] += values_32bit[ value_32bit_index ] + sine; \
+	hash_values[ hash_value_index0 ] += ( ( hash_values[ hash_value_index2 ] ^ hash_values[ hash_value_index3 ] ) & hash_values[ hash_value_index1 ] ) \
+	                                  ^ hash_values[ hash_value_index3 ]; \
 \
 	hash_values[ hash_value_index0 ] = byte_stream_bit_rotate_left_32bit( \
-	                                    hash_values[ hash_value_index0 ],  \
-	                                    libhmac_md5_context_bit_shifts[ block_index ] ); \
+	                                    hash_values[ hash_value_index0 ], \
+	                                    bit_shift ); \
 \
 	hash_values[ hash_value_index0 ] += hash_values[ hash_value_index1 ];
 
-#define libhmac_md5_context_transform_unfolded_calculate_hash_value_round2( values_32bit, value_32bit_index, hash_values, hash_value_index0, hash_value_index1, hash_value_index2, hash_value_index3, block_index ) \
-	hash_values[ hash_value_index0 ] += ( hash_values[ hash_value_index1 ] & hash_values[ hash_value_index3 ] ) \
-	                                  | ( hash_values[ hash_value_index2 ] & ~( hash_values[ hash_value_index3 ] ) ); \
-	hash_values[ hash_value_index0 ] += values_32bit[ value_32bit_index ]; \
-	hash_values[ hash_value_index0 ] += libhmac_md5_context_sines[ block_index ]; \
+#define libhmac_md5_context_transform_calculate_hash_value_round2( values_32bit, value_32bit_index, hash_values, hash_value_index0, hash_value_index1, hash_value_index2, hash_value_index3, sine, bit_shift ) \
+	hash_values[ hash_value_index0 ] += values_32bit[ value_32bit_index ] + sine; \
+	hash_values[ hash_value_index0 ] += hash_values[ hash_value_index2 ] & ~( hash_values[ hash_value_index3 ] ); \
+	hash_values[ hash_value_index0 ] += hash_values[ hash_value_index1 ] & hash_values[ hash_value_index3 ]; \
 \
 	hash_values[ hash_value_index0 ] = byte_stream_bit_rotate_left_32bit( \
-	                                    hash_values[ hash_value_index0 ],  \
-	                                    libhmac_md5_context_bit_shifts[ block_index ] ); \
+	                                    hash_values[ hash_value_index0 ], \
+	                                    bit_shift ); \
 \
 	hash_values[ hash_value_index0 ] += hash_values[ hash_value_index1 ];
 
-#define libhmac_md5_context_transform_unfolded_calculate_hash_value_round3( values_32bit, value_32bit_index, hash_values, hash_value_index0, hash_value_index1, hash_value_index2, hash_value_index3, block_index ) \
-	hash_values[ hash_value_index0 ] += hash_values[ hash_value_index1 ] \
-	                                  ^ hash_values[ hash_value_index2 ] \
-	                                  ^ hash_values[ hash_value_index3 ]; \
-	hash_values[ hash_value_index0 ] += values_32bit[ value_32bit_index ]; \
-	hash_values[ hash_value_index0 ] += libhmac_md5_context_sines[ block_index ]; \
+#define libhmac_md5_context_transform_calculate_hash_value_round3( values_32bit, value_32bit_index, hash_values, hash_value_index0, hash_value_index1, hash_value_index2, hash_value_index3, sine, bit_shift ) \
+	hash_values[ hash_value_index0 ] += values_32bit[ value_32bit_index ] + sine; \
+	hash_values[ hash_value_index0 ] += ( hash_values[ hash_value_index2 ] ^ hash_values[ hash_value_index3 ] ) \
+	                                  ^ hash_values[ hash_value_index1 ]; \
 \
 	hash_values[ hash_value_index0 ] = byte_stream_bit_rotate_left_32bit( \
-	                                    hash_values[ hash_value_index0 ],  \
-	                                    libhmac_md5_context_bit_shifts[ block_index ] ); \
+	                                    hash_values[ hash_value_index0 ], \
+	                                    bit_shift ); \
 \
 	hash_values[ hash_value_index0 ] += hash_values[ hash_value_index1 ];
 
-#define libhmac_md5_context_transform_unfolded_calculate_hash_value_round4( values_32bit, value_32bit_index, hash_values, hash_value_index0, hash_value_index1, hash_value_index2, hash_value_index3, block_index ) \
+#define libhmac_md5_context_transform_calculate_hash_value_round4( values_32bit, value_32bit_index, hash_values, hash_value_index0, hash_value_index1, hash_value_index2, hash_value_index3, sine, bit_shift ) \
+	hash_values[ hash_value_index0 ] += values_32bit[ value_32bit_index ] + sine; \
 	hash_values[ hash_value_index0 ] += hash_values[ hash_value_index2 ] \
 	                                  ^ ( hash_values[ hash_value_index1 ] | ~( hash_values[ hash_value_index3 ] ) ); \
-	hash_values[ hash_value_index0 ] += values_32bit[ value_32bit_index ]; \
-	hash_values[ hash_value_index0 ] += libhmac_md5_context_sines[ block_index ]; \
 \
 	hash_values[ hash_value_index0 ] = byte_stream_bit_rotate_left_32bit( \
-	                                    hash_values[ hash_value_index0 ],  \
-	                                    libhmac_md5_context_bit_shifts[ block_index ] ); \
+	                                    hash_values[ hash_value_index0 ], \
+	                                    bit_shift ); \
 \
 	hash_values[ hash_value_index0 ] += hash_values[ hash_value_index1 ];
 
-#define libhmac_md5_context_transform_unfolded_calculate_hash_values( values_32bit, hash_values ) \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round1( values_32bit, 0, hash_values, 0, 1, 2, 3, 0 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round1( values_32bit, 1, hash_values, 3, 0, 1, 2, 1 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round1( values_32bit, 2, hash_values, 2, 3, 0, 1, 2 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round1( values_32bit, 3, hash_values, 1, 2, 3, 0, 3 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round1( values_32bit, 4, hash_values, 0, 1, 2, 3, 4 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round1( values_32bit, 5, hash_values, 3, 0, 1, 2, 5 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round1( values_32bit, 6, hash_values, 2, 3, 0, 1, 6 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round1( values_32bit, 7, hash_values, 1, 2, 3, 0, 7 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round1( values_32bit, 8, hash_values, 0, 1, 2, 3, 8 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round1( values_32bit, 9, hash_values, 3, 0, 1, 2, 9 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round1( values_32bit, 10, hash_values, 2, 3, 0, 1, 10 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round1( values_32bit, 11, hash_values, 1, 2, 3, 0, 11 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round1( values_32bit, 12, hash_values, 0, 1, 2, 3, 12 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round1( values_32bit, 13, hash_values, 3, 0, 1, 2, 13 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round1( values_32bit, 14, hash_values, 2, 3, 0, 1, 14 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round1( values_32bit, 15, hash_values, 1, 2, 3, 0, 15 ); \
+/* The 32-bit values indexes of the rounds are
+ * [  0, 15 ] => index
+ * [ 16, 31 ] => ( ( 5 x index ) + 1 ) mod 16
+ * [ 32, 47 ] => ( ( 3 x index ) + 5 ) mod 16
+ * [ 48, 63 ] => ( 7 x index ) mod 16
+ */
+#define libhmac_md5_context_transform_calculate_hash_values( values_32bit, hash_values ) \
+	libhmac_md5_context_transform_calculate_hash_value_round1( values_32bit, 0, hash_values, 0, 1, 2, 3, 0xd76aa478UL, 7 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round1( values_32bit, 1, hash_values, 3, 0, 1, 2, 0xe8c7b756UL, 12 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round1( values_32bit, 2, hash_values, 2, 3, 0, 1, 0x242070dbUL, 17 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round1( values_32bit, 3, hash_values, 1, 2, 3, 0, 0xc1bdceeeUL, 22 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round1( values_32bit, 4, hash_values, 0, 1, 2, 3, 0xf57c0fafUL, 7 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round1( values_32bit, 5, hash_values, 3, 0, 1, 2, 0x4787c62aUL, 12 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round1( values_32bit, 6, hash_values, 2, 3, 0, 1, 0xa8304613UL, 17 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round1( values_32bit, 7, hash_values, 1, 2, 3, 0, 0xfd469501UL, 22 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round1( values_32bit, 8, hash_values, 0, 1, 2, 3, 0x698098d8UL, 7 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round1( values_32bit, 9, hash_values, 3, 0, 1, 2, 0x8b44f7afUL, 12 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round1( values_32bit, 10, hash_values, 2, 3, 0, 1, 0xffff5bb1UL, 17 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round1( values_32bit, 11, hash_values, 1, 2, 3, 0, 0x895cd7beUL, 22 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round1( values_32bit, 12, hash_values, 0, 1, 2, 3, 0x6b901122UL, 7 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round1( values_32bit, 13, hash_values, 3, 0, 1, 2, 0xfd987193UL, 12 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round1( values_32bit, 14, hash_values, 2, 3, 0, 1, 0xa679438eUL, 17 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round1( values_32bit, 15, hash_values, 1, 2, 3, 0, 0x49b40821UL, 22 ); \
 \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round2( values_32bit, 1, hash_values, 0, 1, 2, 3, 16 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round2( values_32bit, 6, hash_values, 3, 0, 1, 2, 17 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round2( values_32bit, 11, hash_values, 2, 3, 0, 1, 18 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round2( values_32bit, 0, hash_values, 1, 2, 3, 0, 19 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round2( values_32bit, 5, hash_values, 0, 1, 2, 3, 20 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round2( values_32bit, 10, hash_values, 3, 0, 1, 2, 21 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round2( values_32bit, 15, hash_values, 2, 3, 0, 1, 22 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round2( values_32bit, 4, hash_values, 1, 2, 3, 0, 23 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round2( values_32bit, 9, hash_values, 0, 1, 2, 3, 24 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round2( values_32bit, 14, hash_values, 3, 0, 1, 2, 25 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round2( values_32bit, 3, hash_values, 2, 3, 0, 1, 26 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round2( values_32bit, 8, hash_values, 1, 2, 3, 0, 27 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round2( values_32bit, 13, hash_values, 0, 1, 2, 3, 28 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round2( values_32bit, 2, hash_values, 3, 0, 1, 2, 29 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round2( values_32bit, 7, hash_values, 2, 3, 0, 1, 30 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round2( values_32bit, 12, hash_values, 1, 2, 3, 0, 31 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round2( values_32bit, 1, hash_values, 0, 1, 2, 3, 0xf61e2562UL, 5 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round2( values_32bit, 6, hash_values, 3, 0, 1, 2, 0xc040b340UL, 9 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round2( values_32bit, 11, hash_values, 2, 3, 0, 1, 0x265e5a51UL, 14 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round2( values_32bit, 0, hash_values, 1, 2, 3, 0, 0xe9b6c7aaUL, 20 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round2( values_32bit, 5, hash_values, 0, 1, 2, 3, 0xd62f105dUL, 5 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round2( values_32bit, 10, hash_values, 3, 0, 1, 2, 0x02441453UL, 9 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round2( values_32bit, 15, hash_values, 2, 3, 0, 1, 0xd8a1e681UL, 14 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round2( values_32bit, 4, hash_values, 1, 2, 3, 0, 0xe7d3fbc8UL, 20 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round2( values_32bit, 9, hash_values, 0, 1, 2, 3, 0x21e1cde6UL, 5 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round2( values_32bit, 14, hash_values, 3, 0, 1, 2, 0xc33707d6UL, 9 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round2( values_32bit, 3, hash_values, 2, 3, 0, 1, 0xf4d50d87UL, 14 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round2( values_32bit, 8, hash_values, 1, 2, 3, 0, 0x455a14edUL, 20 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round2( values_32bit, 13, hash_values, 0, 1, 2, 3, 0xa9e3e905UL, 5 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round2( values_32bit, 2, hash_values, 3, 0, 1, 2, 0xfcefa3f8UL, 9 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round2( values_32bit, 7, hash_values, 2, 3, 0, 1, 0x676f02d9UL, 14 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round2( values_32bit, 12, hash_values, 1, 2, 3, 0, 0x8d2a4c8aUL, 20 ); \
 \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round3( values_32bit, 5, hash_values, 0, 1, 2, 3, 32 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round3( values_32bit, 8, hash_values, 3, 0, 1, 2, 33 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round3( values_32bit, 11, hash_values, 2, 3, 0, 1, 34 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round3( values_32bit, 14, hash_values, 1, 2, 3, 0, 35 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round3( values_32bit, 1, hash_values, 0, 1, 2, 3, 36 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round3( values_32bit, 4, hash_values, 3, 0, 1, 2, 37 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round3( values_32bit, 7, hash_values, 2, 3, 0, 1, 38 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round3( values_32bit, 10, hash_values, 1, 2, 3, 0, 39 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round3( values_32bit, 13, hash_values, 0, 1, 2, 3, 40 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round3( values_32bit, 0, hash_values, 3, 0, 1, 2, 41 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round3( values_32bit, 3, hash_values, 2, 3, 0, 1, 42 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round3( values_32bit, 6, hash_values, 1, 2, 3, 0, 43 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round3( values_32bit, 9, hash_values, 0, 1, 2, 3, 44 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round3( values_32bit, 12, hash_values, 3, 0, 1, 2, 45 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round3( values_32bit, 15, hash_values, 2, 3, 0, 1, 46 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round3( values_32bit, 2, hash_values, 1, 2, 3, 0, 47 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round3( values_32bit, 5, hash_values, 0, 1, 2, 3, 0xfffa3942UL, 4 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round3( values_32bit, 8, hash_values, 3, 0, 1, 2, 0x8771f681UL, 11 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round3( values_32bit, 11, hash_values, 2, 3, 0, 1, 0x6d9d6122UL, 16 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round3( values_32bit, 14, hash_values, 1, 2, 3, 0, 0xfde5380cUL, 23 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round3( values_32bit, 1, hash_values, 0, 1, 2, 3, 0xa4beea44UL, 4 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round3( values_32bit, 4, hash_values, 3, 0, 1, 2, 0x4bdecfa9UL, 11 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round3( values_32bit, 7, hash_values, 2, 3, 0, 1, 0xf6bb4b60UL, 16 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round3( values_32bit, 10, hash_values, 1, 2, 3, 0, 0xbebfbc70UL, 23 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round3( values_32bit, 13, hash_values, 0, 1, 2, 3, 0x289b7ec6UL, 4 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round3( values_32bit, 0, hash_values, 3, 0, 1, 2, 0xeaa127faUL, 11 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round3( values_32bit, 3, hash_values, 2, 3, 0, 1, 0xd4ef3085UL, 16 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round3( values_32bit, 6, hash_values, 1, 2, 3, 0, 0x04881d05UL, 23 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round3( values_32bit, 9, hash_values, 0, 1, 2, 3, 0xd9d4d039UL, 4 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round3( values_32bit, 12, hash_values, 3, 0, 1, 2, 0xe6db99e5UL, 11 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round3( values_32bit, 15, hash_values, 2, 3, 0, 1, 0x1fa27cf8UL, 16 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round3( values_32bit, 2, hash_values, 1, 2, 3, 0, 0xc4ac5665UL, 23 ); \
 \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round4( values_32bit, 0, hash_values, 0, 1, 2, 3, 48 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round4( values_32bit, 7, hash_values, 3, 0, 1, 2, 49 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round4( values_32bit, 14, hash_values, 2, 3, 0, 1, 50 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round4( values_32bit, 5, hash_values, 1, 2, 3, 0, 51 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round4( values_32bit, 12, hash_values, 0, 1, 2, 3, 52 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round4( values_32bit, 3, hash_values, 3, 0, 1, 2, 53 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round4( values_32bit, 10, hash_values, 2, 3, 0, 1, 54 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round4( values_32bit, 1, hash_values, 1, 2, 3, 0, 55 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round4( values_32bit, 8, hash_values, 0, 1, 2, 3, 56 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round4( values_32bit, 15, hash_values, 3, 0, 1, 2, 57 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round4( values_32bit, 6, hash_values, 2, 3, 0, 1, 58 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round4( values_32bit, 13, hash_values, 1, 2, 3, 0, 59 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round4( values_32bit, 4, hash_values, 0, 1, 2, 3, 60 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round4( values_32bit, 11, hash_values, 3, 0, 1, 2, 61 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round4( values_32bit, 2, hash_values, 2, 3, 0, 1, 62 ); \
-	libhmac_md5_context_transform_unfolded_calculate_hash_value_round4( values_32bit, 9, hash_values, 1, 2, 3, 0, 63 );
+	libhmac_md5_context_transform_calculate_hash_value_round4( values_32bit, 0, hash_values, 0, 1, 2, 3, 0xf4292244UL, 6 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round4( values_32bit, 7, hash_values, 3, 0, 1, 2, 0x432aff97UL, 10 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round4( values_32bit, 14, hash_values, 2, 3, 0, 1, 0xab9423a7UL, 15 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round4( values_32bit, 5, hash_values, 1, 2, 3, 0, 0xfc93a039UL, 21 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round4( values_32bit, 12, hash_values, 0, 1, 2, 3, 0x655b59c3UL, 6 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round4( values_32bit, 3, hash_values, 3, 0, 1, 2, 0x8f0ccc92UL, 10 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round4( values_32bit, 10, hash_values, 2, 3, 0, 1, 0xffeff47dUL, 15 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round4( values_32bit, 1, hash_values, 1, 2, 3, 0, 0x85845dd1UL, 21 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round4( values_32bit, 8, hash_values, 0, 1, 2, 3, 0x6fa87e4fUL, 6 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round4( values_32bit, 15, hash_values, 3, 0, 1, 2, 0xfe2ce6e0UL, 10 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round4( values_32bit, 6, hash_values, 2, 3, 0, 1, 0xa3014314UL, 15 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round4( values_32bit, 13, hash_values, 1, 2, 3, 0, 0x4e0811a1UL, 21 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round4( values_32bit, 4, hash_values, 0, 1, 2, 3, 0xf7537e82UL, 6 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round4( values_32bit, 11, hash_values, 3, 0, 1, 2, 0xbd3af235UL, 10 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round4( values_32bit, 2, hash_values, 2, 3, 0, 1, 0x2ad7d2bbUL, 15 ); \
+	libhmac_md5_context_transform_calculate_hash_value_round4( values_32bit, 9, hash_values, 1, 2, 3, 0, 0xeb86d391UL, 21 );
 
 /* Calculates the MD5 of 64 byte sized blocks of data in a buffer
- * Returns the number of bytes used if successful or -1 on error
+ * This is the portable kernel
+ * Returns 1 if successful or -1 on error
  */
-ssize_t libhmac_md5_context_transform(
-         libhmac_internal_md5_context_t *internal_context,
-         const uint8_t *buffer,
-         size_t size,
-         libcerror_error_t **error )
+int libhmac_md5_context_transform_portable(
+     uint32_t *context_hash_values,
+     const uint8_t *buffer,
+     size_t number_of_blocks )
 {
 	uint32_t hash_values[ 4 ];
 	uint32_t values_32bit[ 16 ];
 
-	static char *function     = "libhmac_md5_context_transform";
-	size_t buffer_offset      = 0;
-
-#if !defined( LIBHMAC_UNFOLLED_LOOPS )
-	uint32_t hash_value       = 0;
-	uint8_t block_index       = 0;
-	uint8_t hash_values_index = 0;
-	uint8_t value_32bit_index = 0;
-#endif
-
-	if( internal_context == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid internal context.",
-		 function );
-
-		return( -1 );
-	}
-	if( buffer == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid buffer.",
-		 function );
-
-		return( -1 );
-	}
-	if( size > (size_t) SSIZE_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid size value exceeds maximum.",
-		 function );
+	size_t buffer_offset = 0;
 
-		return( -1 );
-	}
-	while( size >= LIBHMAC_MD5_BLOCK_SIZE )
+	while( number_of_blocks > 0 )
 	{
 		if( memory_copy(
 		     hash_values,
-		     internal_context->hash_values,
+		     context_hash_values,
 		     sizeof( uint32_t ) * 4 ) == NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy hash values.",
-			 function );
-
 			goto on_error;
 		}
-#if defined( LIBHMAC_UNFOLLED_LOOPS )
 		/* Break the block into 16 x 32-bit values
 		 */
+#if defined( _BYTE_STREAM_HOST_BYTE_ORDER ) && ( _BYTE_STREAM_HOST_BYTE_ORDER == _BYTE_STREAM_ENDIAN_LITTLE )
+		/* On a little-endian host the block can be copied without conversion
+		 */
+		if( memory_copy(
+		     values_32bit,
+		     &( buffer[ buffer_offset ] ),
+		     LIBHMAC_MD5_BLOCK_SIZE ) == NULL )
+		{
+			goto on_error;
+		}
+#else
 		libhmac_byte_stream_copy_to_16x_uint32_little_endian(
 		 &( buffer[ buffer_offset ] ),
 		 values_32bit );
-
+#endif
 		buffer_offset += LIBHMAC_MD5_BLOCK_SIZE;
 
 		/* Calculate the hash values for the 32-bit values
 		 */
-		libhmac_md5_context_transform_unfolded_calculate_hash_values(
+		libhmac_md5_context_transform_calculate_hash_values(
 		 values_32bit,
 		 hash_values );
 
 		/* Update the hash values in the context
 		 */
-		internal_context->hash_values[ 0 ] += hash_values[ 0 ];
-		internal_context->hash_values[ 1 ] += hash_values[ 1 ];
-		internal_context->hash_values[ 2 ] += hash_values[ 2 ];
-		internal_context->hash_values[ 3 ] += hash_values[ 3 ];
-
-#else
-		/* Break the block into 16 x 32-bit values
-		 */
-		for( value_32bit_index = 0;
-		     value_32bit_index < 16;
-		     value_32bit_index++ )
-		{
-			byte_stream_copy_to_uint32_little_endian(
-			 &( buffer[ buffer_offset ] ),
-			 values_32bit[ value_32bit_index ] );
-
-			buffer_offset += sizeof( uint32_t );
-		}
-		/* Calculate the hash values for the 32-bit values
-		 */
-		for( block_index = 0;
-		     block_index < 64;
-		     block_index++ )
-		{
-			if( block_index < 16 )
-			{
-				hash_values[ 0 ] += ( hash_values[ 1 ] & hash_values[ 2 ] )
-				                  | ( ~( hash_values[ 1 ] ) & hash_values[ 3 ] );
-			}
-			else if( block_index < 32 )
-			{
-				hash_values[ 0 ] += ( hash_values[ 1 ] & hash_values[ 3 ] )
-				                  | ( hash_values[ 2 ] & ~( hash_values[ 3 ] ) );
-			}
-			else if( block_index < 48 )
-			{
-				hash_values[ 0 ] += hash_values[ 1 ]
-				                  ^ hash_values[ 2 ]
-				                  ^ hash_values[ 3 ];
-			}
-			else
-			{
-				hash_values[ 0 ] += hash_values[ 2 ]
-				                  ^ ( hash_values[ 1 ] | ~( hash_values[ 3 ] ) );
-			}
-			value_32bit_index = libhmac_md5_context_values_32bit_index[ block_index ];
-
-			hash_values[ 0 ] += values_32bit[ value_32bit_index ];
-			hash_values[ 0 ] += libhmac_md5_context_sines[ block_index ];
-			hash_values[ 0 ]  = byte_stream_bit_rotate_left_32bit(
-			                     hash_values[ 0 ],
-			                     libhmac_md5_context_bit_shifts[ block_index ] );
-
-			hash_value        = hash_values[ 3 ];
-			hash_values[ 3 ]  = hash_values[ 2 ];
-			hash_values[ 2 ]  = hash_values[ 1 ];
-			hash_values[ 1 ] += hash_values[ 0 ];
-			hash_values[ 0 ]  = hash_value;
-		}
-		/* Update the hash values in the context
-		 */
-		for( hash_values_index = 0;
-		     hash_values_index < 4;
-		     hash_values_index++ )
-		{
-			internal_context->hash_values[ hash_values_index ] += hash_values[ hash_values_index ];
-		}
-#endif /* defined( LIBHMAC_UNFOLLED_LOOPS ) */
+		context_hash_values[ 0 ] += hash_values[ 0 ];
+		context_hash_values[ 1 ] += hash_values[ 1 ];
+		context_hash_values[ 2 ] += hash_values[ 2 ];
+		context_hash_values[ 3 ] += hash_values[ 3 ];
 
-		size -= LIBHMAC_MD5_BLOCK_SIZE;
+		number_of_blocks--;
 	}
 	/* Prevent sensitive data from leaking
 	 */
@@ -380,13 +262,6 @@ ssize_t libhmac_md5_context_transform(
 	     0,
 	     sizeof( uint32_t ) * 4 ) == NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear hash values.",
-		 function );
-
 		goto on_error;
 	}
 	if( memory_set(
@@ -394,16 +269,9 @@ ssize_t libhmac_md5_context_transform(
 	     0,
 	     sizeof( uint32_t ) * 16 ) == NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear 32-bit values.",
-		 function );
-
 		goto on_error;
 	}
-	return( (ssize_t) buffer_offset );
+	return( 1 );
 
 on_error:
 	memory_set(
@@ -419,119 +287,270 @@ on_error:
 	return( -1 );
 }
 
-#endif /* !defined( LIBHMAC_HAVE_MD5_SUPPORT ) */
+/* The MD5 kernels in order of preference
+ * The portable kernel is expected to be last
+ */
+static int libhmac_md5_context_kernel_types[ ] = {
+	LIBHMAC_KERNEL_TYPE_PORTABLE };
 
-/* Creates a MD5 context
- * Make sure the value context is referencing, is set to NULL
- * Returns 1 if successful or -1 on error
+static libhmac_kernel_transform_32bit_function_t libhmac_md5_context_kernel_functions[ ] = {
+	libhmac_md5_context_transform_portable };
+
+#define LIBHMAC_MD5_CONTEXT_NUMBER_OF_KERNELS \
+	(int) ( sizeof( libhmac_md5_context_kernel_types ) / sizeof( int ) )
+
+/* The index of the selected kernel or -1 if not yet selected
  */
-int libhmac_md5_context_initialize(
-     libhmac_md5_context_t **context,
-     libcerror_error_t **error )
+static int libhmac_md5_context_kernel_index = -1;
+
+/* Retrieves the index of the selected kernel
+ * The kernel is selected on first use, concurrent callers select the same kernel
+ * Returns the kernel index
+ */
+static int libhmac_md5_context_get_kernel_index(
+            void )
 {
-	libhmac_internal_md5_context_t *internal_context = NULL;
-	static char *function                            = "libhmac_md5_context_initialize";
+	int kernel_index = libhmac_atomic_get_32bit( &libhmac_md5_context_kernel_index );
 
-#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_MD5 )
-	const EVP_MD *evp_md_type                        = NULL;
-#endif
+	if( kernel_index < 0 )
+	{
+		kernel_index = libhmac_kernel_select(
+		                libhmac_md5_context_kernel_types,
+		                LIBHMAC_MD5_CONTEXT_NUMBER_OF_KERNELS );
 
-	if( context == NULL )
+		libhmac_atomic_set_32bit(
+		 &libhmac_md5_context_kernel_index,
+		 kernel_index );
+	}
+	return( kernel_index );
+}
+
+/* Retrieves the transform function of a specific kernel
+ * Returns 1 if successful, 0 if the kernel is not available or -1 on error
+ */
+int libhmac_md5_context_get_transform_function(
+     int kernel_type,
+     libhmac_kernel_transform_32bit_function_t *transform_function,
+     libcerror_error_t **error )
+{
+	static char *function = "libhmac_md5_context_get_transform_function";
+	int kernel_index      = 0;
+
+	if( transform_function == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid context.",
+		 "%s: invalid transform function.",
 		 function );
 
 		return( -1 );
 	}
-	if( *context != NULL )
+	for( kernel_index = 0;
+	     kernel_index < LIBHMAC_MD5_CONTEXT_NUMBER_OF_KERNELS;
+	     kernel_index++ )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid context value already set.",
-		 function );
+		if( libhmac_md5_context_kernel_types[ kernel_index ] == kernel_type )
+		{
+			if( libhmac_kernel_is_supported(
+			     kernel_type ) == 0 )
+			{
+				break;
+			}
+			*transform_function = libhmac_md5_context_kernel_functions[ kernel_index ];
 
-		return( -1 );
+			return( 1 );
+		}
 	}
-	internal_context = memory_allocate_structure(
-	                    libhmac_internal_md5_context_t );
+	return( 0 );
+}
+
+#if !defined( LIBHMAC_HAVE_MD5_SUPPORT )
+
+/* Calculates the MD5 of 64 byte sized blocks of data in a buffer
+ * Returns the number of bytes used if successful or -1 on error
+ */
+ssize_t libhmac_md5_context_transform(
+         libhmac_internal_md5_context_t *internal_context,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	static char *function   = "libhmac_md5_context_transform";
+	size_t number_of_blocks = 0;
+	int kernel_index        = 0;
 
 	if( internal_context == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create context.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal context.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( memory_set(
-	     internal_context,
-	     0,
-	     sizeof( libhmac_internal_md5_context_t ) ) == NULL )
+	if( buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear context.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
 		 function );
 
-		memory_free(
-		 internal_context );
-
 		return( -1 );
 	}
-#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_MD5_H ) && defined( MD5_DIGEST_LENGTH )
-	if( MD5_Init(
-	     &( internal_context->md5_context ) ) != 1 )
+	if( size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to initialize context.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
+	number_of_blocks = size / LIBHMAC_MD5_BLOCK_SIZE;
 
-#elif defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_MD5 )
-#if defined( HAVE_EVP_MD_CTX_INIT )
-	EVP_MD_CTX_init(
-	 &( internal_context->internal_evp_md_context ) );
-
-	internal_context->evp_md_context = &( internal_context->internal_evp_md_context );
-#else
-	internal_context->evp_md_context = EVP_MD_CTX_new();
-
-	if( internal_context->evp_md_context == NULL )
+	if( number_of_blocks > 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create EVP message digest context.",
-		 function );
+		kernel_index = libhmac_md5_context_get_kernel_index();
 
-		goto on_error;
+		if( libhmac_md5_context_kernel_functions[ kernel_index ](
+		     internal_context->hash_values,
+		     buffer,
+		     number_of_blocks ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to transform blocks.",
+			 function );
+
+			return( -1 );
+		}
 	}
-#endif /* defined( HAVE_EVP_MD_CTX_INIT ) */
+	return( (ssize_t) ( number_of_blocks * LIBHMAC_MD5_BLOCK_SIZE ) );
+}
 
-/* TODO use EVP_MD_fetch for EVP_DigestInit_ex2 */
-	evp_md_type = EVP_md5();
+#endif /* !defined( LIBHMAC_HAVE_MD5_SUPPORT ) */
 
-#if defined( HAVE_EVP_DIGESTINIT_EX2 )
-	if( EVP_DigestInit_ex2(
-	     internal_context->evp_md_context,
-	     evp_md_type,
+/* Calculates the MD5 of 64 byte sized blocks of data using the selected kernel
+ * The hash values are updated in place, no padding is added
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_md5_context_transform_blocks(
+     uint32_t *hash_values,
+     const uint8_t *blocks,
+     size_t number_of_blocks )
+{
+	int kernel_index = libhmac_md5_context_get_kernel_index();
+
+	return( libhmac_md5_context_kernel_functions[ kernel_index ](
+	         hash_values,
+	         blocks,
+	         number_of_blocks ) );
+}
+
+/* Retrieves the type of the kernel used by the MD5 context
+ * Returns the kernel type
+ */
+int libhmac_md5_context_get_kernel_type(
+     void )
+{
+#if defined( LIBHMAC_HAVE_MD5_SUPPORT )
+	return( LIBHMAC_KERNEL_TYPE_LIBCRYPTO );
+#else
+	return( libhmac_md5_context_kernel_types[ libhmac_md5_context_get_kernel_index() ] );
+#endif
+}
+
+/* Initializes the MD5 context values in the internal context
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_internal_md5_context_initialize(
+     libhmac_internal_md5_context_t *internal_context,
+     libcerror_error_t **error )
+{
+	static char *function     = "libhmac_internal_md5_context_initialize";
+
+#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_MD5 )
+	const EVP_MD *evp_md_type = NULL;
+#endif
+
+	if( internal_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     internal_context,
+	     0,
+	     sizeof( libhmac_internal_md5_context_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear context.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_MD5_H ) && defined( MD5_DIGEST_LENGTH )
+	if( MD5_Init(
+	     &( internal_context->md5_context ) ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize context.",
+		 function );
+
+		return( -1 );
+	}
+
+#elif defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_MD5 )
+#if defined( HAVE_EVP_MD_CTX_INIT )
+	EVP_MD_CTX_init(
+	 &( internal_context->internal_evp_md_context ) );
+
+	internal_context->evp_md_context = &( internal_context->internal_evp_md_context );
+#else
+	internal_context->evp_md_context = EVP_MD_CTX_new();
+
+	if( internal_context->evp_md_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create EVP message digest context.",
+		 function );
+
+		return( -1 );
+	}
+#endif /* defined( HAVE_EVP_MD_CTX_INIT ) */
+
+/* TODO use EVP_MD_fetch for EVP_DigestInit_ex2 */
+	evp_md_type = EVP_md5();
+
+#if defined( HAVE_EVP_DIGESTINIT_EX2 )
+	if( EVP_DigestInit_ex2(
+	     internal_context->evp_md_context,
+	     evp_md_type,
 	     NULL ) != 1 )
 #else
 	if( EVP_DigestInit_ex(
@@ -558,7 +577,7 @@ int libhmac_md5_context_initialize(
 #endif
 		internal_context->evp_md_context = NULL;
 
-		goto on_error;
+		return( -1 );
 	}
 #else
 	if( memory_copy(
@@ -573,34 +592,25 @@ int libhmac_md5_context_initialize(
 		 "%s: unable to copy fixed constants to hash values.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 #endif /* defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_MD5_H ) && defined( MD5_DIGEST_LENGTH ) */
 
-	*context = (libhmac_md5_context_t *) internal_context;
-
 	return( 1 );
-
-on_error:
-	if( internal_context != NULL )
-	{
-		memory_free(
-		 internal_context );
-	}
-	return( -1 );
 }
 
-/* Frees a MD5 context
+/* Clears the MD5 context values in the internal context
+ * Releases the resources held by the context values but not the internal context itself
  * Returns 1 if successful or -1 on error
  */
-int libhmac_md5_context_free(
-     libhmac_md5_context_t **context,
+int libhmac_internal_md5_context_clear(
+     libhmac_internal_md5_context_t *internal_context,
      libcerror_error_t **error )
 {
-	libhmac_internal_md5_context_t *internal_context = NULL;
-	static char *function                            = "libhmac_md5_context_free";
+	static char *function = "libhmac_internal_md5_context_clear";
+	int result            = 1;
 
-	if( context == NULL )
+	if( internal_context == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -611,139 +621,120 @@ int libhmac_md5_context_free(
 
 		return( -1 );
 	}
-	if( *context != NULL )
-	{
-		internal_context = (libhmac_internal_md5_context_t *) *context;
-		*context         = NULL;
-
 #if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_MD5_H ) && defined( MD5_DIGEST_LENGTH )
-		/* No additional clean up necessary
-		 */
+	/* No additional clean up necessary
+	 */
 
 #elif defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_MD5 )
 #if defined( HAVE_EVP_MD_CTX_CLEANUP )
-		if( EVP_MD_CTX_cleanup(
-		     &( internal_context->internal_evp_md_context ) ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to clean up EVP message digest context.",
-			 function );
-		}
-		/* Make sure the error state is removed otherwise OpenSSL will leak memory
-		 */
-		ERR_remove_thread_state(
-		 NULL );
+	if( EVP_MD_CTX_cleanup(
+	     &( internal_context->internal_evp_md_context ) ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clean up EVP message digest context.",
+		 function );
+
+		result = -1;
+	}
+	/* Make sure the error state is removed otherwise OpenSSL will leak memory
+	 */
+	ERR_remove_thread_state(
+	 NULL );
 #else
-		EVP_MD_CTX_free(
-		 internal_context->evp_md_context );
+	EVP_MD_CTX_free(
+	 internal_context->evp_md_context );
 
 #endif /* defined( HAVE_EVP_MD_CTX_CLEANUP ) */
 
-		internal_context->evp_md_context = NULL;
+	internal_context->evp_md_context = NULL;
 #else
-		/* No additional clean up necessary
-		 */
+	/* No additional clean up necessary
+	 */
 #endif /* defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_MD5_H ) && defined( MD5_DIGEST_LENGTH ) */
 
-		memory_free(
-		 internal_context );
-	}
-	return( 1 );
+	return( result );
 }
 
-#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_MD5_H ) && defined( MD5_DIGEST_LENGTH )
-
-/* Updates the MD5 context using OpenSSL
+/* Copies the MD5 context values of the source to the destination internal context
+ * The destination internal context must have been initialized
  * Returns 1 if successful or -1 on error
  */
-int libhmac_md5_context_update(
-     libhmac_md5_context_t *context,
-     const uint8_t *buffer,
-     size_t size,
+int libhmac_internal_md5_context_copy(
+     libhmac_internal_md5_context_t *destination_internal_context,
+     libhmac_internal_md5_context_t *source_internal_context,
      libcerror_error_t **error )
 {
-	libhmac_internal_md5_context_t *internal_context = NULL;
-	static char *function                            = "libhmac_md5_context_update";
-	unsigned long safe_hash_size                     = 0;
+	static char *function = "libhmac_internal_md5_context_copy";
 
-	if( context == NULL )
+	if( destination_internal_context == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid context.",
+		 "%s: invalid destination context.",
 		 function );
 
 		return( -1 );
 	}
-	internal_context = (libhmac_internal_md5_context_t *) context;
-
-	if( buffer == NULL )
+	if( source_internal_context == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid buffer.",
+		 "%s: invalid source context.",
 		 function );
 
 		return( -1 );
 	}
-#if ( SIZEOF_LONG < SIZEOF_SIZE_T )
-	if( size > (size_t) ULONG_MAX )
-#else
-	if( size > (size_t) SSIZE_MAX )
-#endif
+#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_MD5 )
+	if( EVP_MD_CTX_copy_ex(
+	     destination_internal_context->evp_md_context,
+	     source_internal_context->evp_md_context ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid size value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy EVP message digest context.",
 		 function );
 
 		return( -1 );
 	}
-	if( size == 0 )
-	{
-		return( 1 );
-	}
-	safe_hash_size = (unsigned long) size;
-
-	if( MD5_Update(
-	     &( internal_context->md5_context ),
-	     (const void *) buffer,
-	     size ) != 1 )
+#else
+	if( memory_copy(
+	     destination_internal_context,
+	     source_internal_context,
+	     sizeof( libhmac_internal_md5_context_t ) ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to update context.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy source to destination context.",
 		 function );
 
 		return( -1 );
 	}
+#endif /* defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_MD5 ) */
+
 	return( 1 );
 }
 
-#elif defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_MD5 )
-
-/* Updates the MD5 context using OpenSSL EVP
+/* Creates a MD5 context
+ * Make sure the value context is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
  */
-int libhmac_md5_context_update(
-     libhmac_md5_context_t *context,
-     const uint8_t *buffer,
-     size_t size,
+int libhmac_md5_context_initialize(
+     libhmac_md5_context_t **context,
      libcerror_error_t **error )
 {
 	libhmac_internal_md5_context_t *internal_context = NULL;
-	static char *function                            = "libhmac_md5_context_update";
+	static char *function                            = "libhmac_md5_context_initialize";
 
 	if( context == NULL )
 	{
@@ -756,67 +747,67 @@ int libhmac_md5_context_update(
 
 		return( -1 );
 	}
-	internal_context = (libhmac_internal_md5_context_t *) context;
-
-	if( buffer == NULL )
+	if( *context != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid buffer.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid context value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( size > (size_t) SSIZE_MAX )
+	internal_context = memory_allocate_structure(
+	                    libhmac_internal_md5_context_t );
+
+	if( internal_context == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid size value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create context.",
 		 function );
 
-		return( -1 );
-	}
-	if( size == 0 )
-	{
-		return( 1 );
+		goto on_error;
 	}
-	if( EVP_DigestUpdate(
-	     internal_context->evp_md_context,
-	     (const void *) buffer,
-	     size ) != 1 )
+	if( libhmac_internal_md5_context_initialize(
+	     internal_context,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to update context.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize context.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
+	*context = (libhmac_md5_context_t *) internal_context;
+
 	return( 1 );
-}
 
-#else
+on_error:
+	if( internal_context != NULL )
+	{
+		memory_free(
+		 internal_context );
+	}
+	return( -1 );
+}
 
-/* Updates the MD5 context using fallback implementation
+/* Frees a MD5 context
  * Returns 1 if successful or -1 on error
  */
-int libhmac_md5_context_update(
-     libhmac_md5_context_t *context,
-     const uint8_t *buffer,
-     size_t size,
+int libhmac_md5_context_free(
+     libhmac_md5_context_t **context,
      libcerror_error_t **error )
 {
 	libhmac_internal_md5_context_t *internal_context = NULL;
-	static char *function                            = "libhmac_md5_context_update";
-	size_t buffer_offset                             = 0;
-	size_t remaining_block_size                      = 0;
-	ssize_t process_count                            = 0;
+	static char *function                            = "libhmac_md5_context_free";
+	int result                                       = 1;
 
 	if( context == NULL )
 	{
@@ -829,167 +820,1373 @@ int libhmac_md5_context_update(
 
 		return( -1 );
 	}
-	internal_context = (libhmac_internal_md5_context_t *) context;
+	if( *context != NULL )
+	{
+		internal_context = (libhmac_internal_md5_context_t *) *context;
+		*context         = NULL;
 
-	if( buffer == NULL )
+		if( libhmac_internal_md5_context_clear(
+		     internal_context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear context.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_context );
+	}
+	return( result );
+}
+
+/* Retrieves the size and alignment of the memory of a MD5 context
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_md5_context_get_size(
+     size_t *context_size,
+     size_t *context_alignment,
+     libcerror_error_t **error )
+{
+	static char *function = "libhmac_md5_context_get_size";
+
+	if( context_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid buffer.",
+		 "%s: invalid context size.",
 		 function );
 
 		return( -1 );
 	}
-	if( size > (size_t) SSIZE_MAX )
+	if( context_alignment == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context alignment.",
+		 function );
+
+		return( -1 );
+	}
+	*context_size      = sizeof( libhmac_internal_md5_context_t );
+	*context_alignment = sizeof( libhmac_md5_context_alignment_t ) - sizeof( libhmac_internal_md5_context_t );
+
+	return( 1 );
+}
+
+/* Creates a MD5 context in caller provided memory
+ * The memory must be at least the size and have the alignment retrieved
+ * by libhmac_md5_context_get_size and must remain available until the
+ * context is freed with libhmac_md5_context_free_in_place
+ * Make sure the value context is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_md5_context_initialize_in_place(
+     libhmac_md5_context_t **context,
+     uint8_t *memory,
+     size_t memory_size,
+     libcerror_error_t **error )
+{
+	libhmac_internal_md5_context_t *internal_context = NULL;
+	static char *function                            = "libhmac_md5_context_initialize_in_place";
+	size_t context_alignment                         = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid context value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid size value exceeds maximum.",
+		 "%s: invalid memory size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( size == 0 )
+	if( memory_size < sizeof( libhmac_internal_md5_context_t ) )
 	{
-		return( 1 );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid memory size value too small.",
+		 function );
+
+		return( -1 );
 	}
-	if( internal_context->block_offset > 0 )
+	context_alignment = sizeof( libhmac_md5_context_alignment_t ) - sizeof( libhmac_internal_md5_context_t );
+
+	if( ( (intptr_t) memory % (intptr_t) context_alignment ) != 0 )
 	{
-		if( internal_context->block_offset >= LIBHMAC_MD5_BLOCK_SIZE )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid context - block offset value out of bounds.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid memory value not aligned.",
+		 function );
 
-			return( -1 );
-		}
-		remaining_block_size = LIBHMAC_MD5_BLOCK_SIZE - internal_context->block_offset;
+		return( -1 );
+	}
+	internal_context = (libhmac_internal_md5_context_t *) memory;
 
-		if( remaining_block_size > size )
-		{
-			remaining_block_size = size;
-		}
-		if( memory_copy(
-		     &( internal_context->block[ internal_context->block_offset ] ),
-		     buffer,
-		     remaining_block_size ) == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy data to context block.",
-			 function );
+	if( libhmac_internal_md5_context_initialize(
+	     internal_context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize context.",
+		 function );
 
-			return( -1 );
-		}
-		internal_context->block_offset += remaining_block_size;
+		return( -1 );
+	}
+	*context = (libhmac_md5_context_t *) internal_context;
 
-		if( internal_context->block_offset < LIBHMAC_MD5_BLOCK_SIZE )
-		{
-			return( 1 );
-		}
-		buffer_offset += remaining_block_size;
-		size          -= remaining_block_size;
+	return( 1 );
+}
 
-		process_count = libhmac_md5_context_transform(
-		                 internal_context,
-		                 internal_context->block,
-		                 LIBHMAC_MD5_BLOCK_SIZE,
-		                 error );
+/* Frees a MD5 context created in caller provided memory
+ * The memory itself is not freed
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_md5_context_free_in_place(
+     libhmac_md5_context_t **context,
+     libcerror_error_t **error )
+{
+	libhmac_internal_md5_context_t *internal_context = NULL;
+	static char *function                            = "libhmac_md5_context_free_in_place";
+	int result                                       = 1;
 
-		if( process_count == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to transform context block.",
-			 function );
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
 
-			return( -1 );
-		}
-		internal_context->hash_count  += process_count;
-		internal_context->block_offset = 0;
+		return( -1 );
 	}
-	if( size > 0 )
+	if( *context != NULL )
 	{
-		process_count = libhmac_md5_context_transform(
-		                 internal_context,
-		                 &( buffer[ buffer_offset ] ),
-		                 size,
-		                 error );
+		internal_context = (libhmac_internal_md5_context_t *) *context;
+		*context         = NULL;
 
-		if( process_count == -1 )
+		if( libhmac_internal_md5_context_clear(
+		     internal_context,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to transform buffer.",
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear context.",
 			 function );
 
-			return( -1 );
+			result = -1;
 		}
-		internal_context->hash_count += process_count;
+	}
+	return( result );
+}
 
-		buffer_offset += process_count;
-		size          -= process_count;
+/* Resets a MD5 context
+ * The context can be reused to calculate a new hash without being freed and reinitialized
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_md5_context_reset(
+     libhmac_md5_context_t *context,
+     libcerror_error_t **error )
+{
+	libhmac_internal_md5_context_t *internal_context = NULL;
+	static char *function                            = "libhmac_md5_context_reset";
+
+#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_MD5 )
+	const EVP_MD *evp_md_type                        = NULL;
+#endif
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
 	}
-	if( size > 0 )
+	internal_context = (libhmac_internal_md5_context_t *) context;
+
+#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_MD5_H ) && defined( MD5_DIGEST_LENGTH )
+	if( MD5_Init(
+	     &( internal_context->md5_context ) ) != 1 )
 	{
-		if( size >= LIBHMAC_MD5_BLOCK_SIZE )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid size value out of bounds.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize context.",
+		 function );
 
-			return( -1 );
-		}
-		if( memory_copy(
-		     internal_context->block,
-		     &( buffer[ buffer_offset ] ),
-		     size ) == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		return( -1 );
+	}
+
+#elif defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_MD5 )
+/* TODO use EVP_MD_fetch for EVP_DigestInit_ex2 */
+	evp_md_type = EVP_md5();
+
+#if defined( HAVE_EVP_DIGESTINIT_EX2 )
+	if( EVP_DigestInit_ex2(
+	     internal_context->evp_md_context,
+	     evp_md_type,
+	     NULL ) != 1 )
+#else
+	if( EVP_DigestInit_ex(
+	     internal_context->evp_md_context,
+	     evp_md_type,
+	     NULL ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize EVP message digest context.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	if( memory_copy(
+	     internal_context->hash_values,
+	     libhmac_md5_context_fixed_constants,
+	     sizeof( uint32_t ) * 4 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy fixed constants to hash values.",
+		 function );
+
+		return( -1 );
+	}
+	internal_context->hash_count   = 0;
+	internal_context->block_offset = 0;
+#endif /* defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_MD5_H ) && defined( MD5_DIGEST_LENGTH ) */
+
+	return( 1 );
+}
+
+/* Clones (duplicates) the MD5 context
+ * The clone continues from the state of the source context
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_md5_context_clone(
+     libhmac_md5_context_t **destination_context,
+     libhmac_md5_context_t *source_context,
+     libcerror_error_t **error )
+{
+	libhmac_internal_md5_context_t *internal_destination_context = NULL;
+	libhmac_internal_md5_context_t *internal_source_context      = NULL;
+	static char *function                                        = "libhmac_md5_context_clone";
+
+	if( destination_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination context value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_context == NULL )
+	{
+		*destination_context = NULL;
+
+		return( 1 );
+	}
+	internal_source_context = (libhmac_internal_md5_context_t *) source_context;
+
+	internal_destination_context = memory_allocate_structure(
+	                                libhmac_internal_md5_context_t );
+
+	if( internal_destination_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create destination context.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_MD5 )
+	if( memory_set(
+	     internal_destination_context,
+	     0,
+	     sizeof( libhmac_internal_md5_context_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear destination context.",
+		 function );
+
+		memory_free(
+		 internal_destination_context );
+
+		return( -1 );
+	}
+#if defined( HAVE_EVP_MD_CTX_INIT )
+	EVP_MD_CTX_init(
+	 &( internal_destination_context->internal_evp_md_context ) );
+
+	internal_destination_context->evp_md_context = &( internal_destination_context->internal_evp_md_context );
+#else
+	internal_destination_context->evp_md_context = EVP_MD_CTX_new();
+
+	if( internal_destination_context->evp_md_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create EVP message digest context.",
+		 function );
+
+		goto on_error;
+	}
+#endif /* defined( HAVE_EVP_MD_CTX_INIT ) */
+
+	if( EVP_MD_CTX_copy_ex(
+	     internal_destination_context->evp_md_context,
+	     internal_source_context->evp_md_context ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy EVP message digest context.",
+		 function );
+
+		goto on_error;
+	}
+#else
+	if( memory_copy(
+	     internal_destination_context,
+	     internal_source_context,
+	     sizeof( libhmac_internal_md5_context_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy source to destination context.",
+		 function );
+
+		goto on_error;
+	}
+#endif /* defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_MD5 ) */
+
+	*destination_context = (libhmac_md5_context_t *) internal_destination_context;
+
+	return( 1 );
+
+on_error:
+	if( internal_destination_context != NULL )
+	{
+		libhmac_internal_md5_context_clear(
+		 internal_destination_context,
+		 NULL );
+
+		memory_free(
+		 internal_destination_context );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_MD5_H ) && defined( MD5_DIGEST_LENGTH )
+
+/* Updates the MD5 context using OpenSSL
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_md5_context_update(
+     libhmac_md5_context_t *context,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	libhmac_internal_md5_context_t *internal_context = NULL;
+	static char *function                            = "libhmac_md5_context_update";
+	unsigned long safe_hash_size                     = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	internal_context = (libhmac_internal_md5_context_t *) context;
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+#if ( SIZEOF_LONG < SIZEOF_SIZE_T )
+	if( size > (size_t) ULONG_MAX )
+#else
+	if( size > (size_t) SSIZE_MAX )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == 0 )
+	{
+		return( 1 );
+	}
+	safe_hash_size = (unsigned long) size;
+
+	if( MD5_Update(
+	     &( internal_context->md5_context ),
+	     (const void *) buffer,
+	     size ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update context.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#elif defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_MD5 )
+
+/* Updates the MD5 context using OpenSSL EVP
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_md5_context_update(
+     libhmac_md5_context_t *context,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	libhmac_internal_md5_context_t *internal_context = NULL;
+	static char *function                            = "libhmac_md5_context_update";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	internal_context = (libhmac_internal_md5_context_t *) context;
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == 0 )
+	{
+		return( 1 );
+	}
+	if( EVP_DigestUpdate(
+	     internal_context->evp_md_context,
+	     (const void *) buffer,
+	     size ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update context.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#else
+
+/* Updates the MD5 context using fallback implementation
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_md5_context_update(
+     libhmac_md5_context_t *context,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	libhmac_internal_md5_context_t *internal_context = NULL;
+	static char *function                            = "libhmac_md5_context_update";
+	size_t buffer_offset                             = 0;
+	size_t remaining_block_size                      = 0;
+	ssize_t process_count                            = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	internal_context = (libhmac_internal_md5_context_t *) context;
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == 0 )
+	{
+		return( 1 );
+	}
+	if( internal_context->block_offset > 0 )
+	{
+		if( internal_context->block_offset >= LIBHMAC_MD5_BLOCK_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid context - block offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		remaining_block_size = LIBHMAC_MD5_BLOCK_SIZE - internal_context->block_offset;
+
+		if( remaining_block_size > size )
+		{
+			remaining_block_size = size;
+		}
+		if( memory_copy(
+		     &( internal_context->block[ internal_context->block_offset ] ),
+		     buffer,
+		     remaining_block_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data to context block.",
+			 function );
+
+			return( -1 );
+		}
+		internal_context->block_offset += remaining_block_size;
+
+		if( internal_context->block_offset < LIBHMAC_MD5_BLOCK_SIZE )
+		{
+			return( 1 );
+		}
+		buffer_offset += remaining_block_size;
+		size          -= remaining_block_size;
+
+		process_count = libhmac_md5_context_transform(
+		                 internal_context,
+		                 internal_context->block,
+		                 LIBHMAC_MD5_BLOCK_SIZE,
+		                 error );
+
+		if( process_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to transform context block.",
+			 function );
+
+			return( -1 );
+		}
+		internal_context->hash_count  += process_count;
+		internal_context->block_offset = 0;
+	}
+	if( size > 0 )
+	{
+		process_count = libhmac_md5_context_transform(
+		                 internal_context,
+		                 &( buffer[ buffer_offset ] ),
+		                 size,
+		                 error );
+
+		if( process_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to transform buffer.",
+			 function );
+
+			return( -1 );
+		}
+		internal_context->hash_count += process_count;
+
+		buffer_offset += process_count;
+		size          -= process_count;
+	}
+	if( size > 0 )
+	{
+		if( size >= LIBHMAC_MD5_BLOCK_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     internal_context->block,
+		     &( buffer[ buffer_offset ] ),
+		     size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
 			 "%s: unable to copy remaining data to context block.",
 			 function );
 
-			return( -1 );
-		}
-		internal_context->block_offset = size;
+			return( -1 );
+		}
+		internal_context->block_offset = size;
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_MD5_H ) && defined( MD5_DIGEST_LENGTH ) */
+
+/* Updates the MD5 context using multiple buffers
+ * The buffers are hashed as if they were a single contiguous buffer, where only
+ * the data that crosses a block boundary is copied into the context block
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_md5_context_update_iov(
+     libhmac_md5_context_t *context,
+     const uint8_t **buffers,
+     const size_t *sizes,
+     int number_of_buffers,
+     libcerror_error_t **error )
+{
+	libhmac_internal_md5_context_t *internal_context = NULL;
+	static char *function                            = "libhmac_md5_context_update_iov";
+	int buffer_index                                 = 0;
+
+#if !defined( LIBHMAC_HAVE_MD5_SUPPORT )
+	const uint8_t *buffer                            = NULL;
+	size_t buffer_offset                             = 0;
+	size_t remaining_block_size                      = 0;
+	size_t size                                      = 0;
+	ssize_t process_count                            = 0;
+#endif
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	internal_context = (libhmac_internal_md5_context_t *) context;
+
+	if( buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffers.",
+		 function );
+
+		return( -1 );
+	}
+	if( sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_buffers < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of buffers value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	/* All the buffers are checked before any of them is hashed
+	 * so that the context is not partially updated on error
+	 */
+	for( buffer_index = 0;
+	     buffer_index < number_of_buffers;
+	     buffer_index++ )
+	{
+		if( buffers[ buffer_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid buffer: %d.",
+			 function,
+			 buffer_index );
+
+			return( -1 );
+		}
+		if( sizes[ buffer_index ] > (size_t) SSIZE_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid size: %d value exceeds maximum.",
+			 function,
+			 buffer_index );
+
+			return( -1 );
+		}
+	}
+	for( buffer_index = 0;
+	     buffer_index < number_of_buffers;
+	     buffer_index++ )
+	{
+		if( sizes[ buffer_index ] == 0 )
+		{
+			continue;
+		}
+#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_MD5_H ) && defined( MD5_DIGEST_LENGTH )
+		if( MD5_Update(
+		     &( internal_context->md5_context ),
+		     (const void *) buffers[ buffer_index ],
+		     sizes[ buffer_index ] ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update context.",
+			 function );
+
+			return( -1 );
+		}
+#elif defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_MD5 )
+		if( EVP_DigestUpdate(
+		     internal_context->evp_md_context,
+		     (const void *) buffers[ buffer_index ],
+		     sizes[ buffer_index ] ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update context.",
+			 function );
+
+			return( -1 );
+		}
+#else
+		buffer        = buffers[ buffer_index ];
+		size          = sizes[ buffer_index ];
+		buffer_offset = 0;
+
+		if( internal_context->block_offset > 0 )
+		{
+			if( internal_context->block_offset >= LIBHMAC_MD5_BLOCK_SIZE )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid context - block offset value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			/* Stitch the start of the buffer to the data of the previous buffers
+			 */
+			remaining_block_size = LIBHMAC_MD5_BLOCK_SIZE - internal_context->block_offset;
+
+			if( remaining_block_size > size )
+			{
+				remaining_block_size = size;
+			}
+			if( memory_copy(
+			     &( internal_context->block[ internal_context->block_offset ] ),
+			     buffer,
+			     remaining_block_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy data to context block.",
+				 function );
+
+				return( -1 );
+			}
+			internal_context->block_offset += remaining_block_size;
+
+			if( internal_context->block_offset < LIBHMAC_MD5_BLOCK_SIZE )
+			{
+				continue;
+			}
+			buffer_offset += remaining_block_size;
+			size          -= remaining_block_size;
+
+			process_count = libhmac_md5_context_transform(
+			                 internal_context,
+			                 internal_context->block,
+			                 LIBHMAC_MD5_BLOCK_SIZE,
+			                 error );
+
+			if( process_count == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to transform context block.",
+				 function );
+
+				return( -1 );
+			}
+			internal_context->hash_count  += process_count;
+			internal_context->block_offset = 0;
+		}
+		/* The whole blocks are transformed directly from the buffer
+		 */
+		if( size >= LIBHMAC_MD5_BLOCK_SIZE )
+		{
+			process_count = libhmac_md5_context_transform(
+			                 internal_context,
+			                 &( buffer[ buffer_offset ] ),
+			                 size,
+			                 error );
+
+			if( process_count == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to transform buffer: %d.",
+				 function,
+				 buffer_index );
+
+				return( -1 );
+			}
+			internal_context->hash_count += process_count;
+
+			buffer_offset += process_count;
+			size          -= process_count;
+		}
+		if( size > 0 )
+		{
+			if( size >= LIBHMAC_MD5_BLOCK_SIZE )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid size value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			if( memory_copy(
+			     internal_context->block,
+			     &( buffer[ buffer_offset ] ),
+			     size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy remaining data to context block.",
+				 function );
+
+				return( -1 );
+			}
+			internal_context->block_offset = size;
+		}
+#endif /* defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_MD5_H ) && defined( MD5_DIGEST_LENGTH ) */
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_MD5_H ) && defined( MD5_DIGEST_LENGTH )
+
+/* Finalizes the MD5 context using OpenSSL
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_md5_context_finalize(
+     libhmac_md5_context_t *context,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error )
+{
+	libhmac_internal_md5_context_t *internal_context = NULL;
+	static char *function                            = "libhmac_md5_context_finalize";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	internal_context = (libhmac_internal_md5_context_t *) context;
+
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid hash size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_size < (size_t) LIBHMAC_MD5_HASH_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid hash size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( MD5_Final(
+	     hash,
+	     &( internal_context->md5_context ) ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize context.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#elif defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_MD5 )
+
+/* Finalizes the MD5 context using OpenSSL EVP
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_md5_context_finalize(
+     libhmac_md5_context_t *context,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error )
+{
+	libhmac_internal_md5_context_t *internal_context = NULL;
+	static char *function                            = "libhmac_md5_context_finalize";
+	unsigned int safe_hash_size                      = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	internal_context = (libhmac_internal_md5_context_t *) context;
+
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( hash_size < (size_t) LIBHMAC_MD5_HASH_SIZE )
+	 || ( hash_size > (size_t) UINT_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid hash size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	safe_hash_size = (unsigned int) hash_size;
+
+	if( EVP_DigestFinal_ex(
+	     internal_context->evp_md_context,
+	     (unsigned char *) hash,
+	     &safe_hash_size ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize context.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#else
+
+/* Finalizes the MD5 context using fallback implementation
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_md5_context_finalize(
+     libhmac_md5_context_t *context,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error )
+{
+	libhmac_internal_md5_context_t *internal_context = NULL;
+	static char *function                            = "libhmac_md5_context_finalize";
+	size_t block_size                                = 0;
+	size_t number_of_blocks                          = 0;
+	ssize_t process_count                            = 0;
+	uint64_t bit_size                                = 0;
+
+#if !defined( LIBHMAC_UNFOLLED_LOOPS )
+	size_t hash_index                                = 0;
+	int hash_values_index                            = 0;
+#endif
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	internal_context = (libhmac_internal_md5_context_t *) context;
+
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid hash size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_size < (size_t) LIBHMAC_MD5_HASH_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid hash size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	/* Add padding with a size of 56 mod 64
+	 */
+	number_of_blocks = 1;
+
+	if( internal_context->block_offset > 55 )
+	{
+		number_of_blocks += 1;
+	}
+	block_size = number_of_blocks * LIBHMAC_MD5_BLOCK_SIZE;
+
+	if( memory_set(
+	     &( internal_context->block[ internal_context->block_offset ] ),
+	     0,
+	     block_size - internal_context->block_offset ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear context block.",
+		 function );
+
+		return( -1 );
+	}
+	/* The first byte of the padding contains 0x80
+	 */
+	internal_context->block[ internal_context->block_offset ] = 0x80;
+
+	bit_size = ( internal_context->hash_count + internal_context->block_offset ) * 8;
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( internal_context->block[ block_size - 8 ] ),
+	 bit_size );
+
+	process_count = libhmac_md5_context_transform(
+	                 internal_context,
+	                 internal_context->block,
+	                 block_size,
+	                 error );
+
+	if( process_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to transform context block.",
+		 function );
+
+		return( -1 );
+	}
+#if !defined( LIBHMAC_UNFOLLED_LOOPS )
+	for( hash_values_index = 0;
+	     hash_values_index < 4;
+	     hash_values_index++ )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 &( hash[ hash_index ] ),
+		 internal_context->hash_values[ hash_values_index ] );
+
+		hash_index += sizeof( uint32_t );
+	}
+#else
+	byte_stream_copy_from_uint32_little_endian(
+	 &( hash[ 0 ] ),
+	 internal_context->hash_values[ 0 ] );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( hash[ 4 ] ),
+	 internal_context->hash_values[ 1 ] );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( hash[ 8 ] ),
+	 internal_context->hash_values[ 2 ] );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( hash[ 12 ] ),
+	 internal_context->hash_values[ 3 ] );
+
+#endif /* !defined( LIBHMAC_UNFOLLED_LOOPS ) */
+
+	/* Prevent sensitive data from leaking
+	 */
+	if( memory_set(
+	     internal_context,
+	     0,
+	     sizeof( libhmac_internal_md5_context_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear context.",
+		 function );
+
+		return( -1 );
 	}
 	return( 1 );
 }
 
 #endif /* defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_MD5_H ) && defined( MD5_DIGEST_LENGTH ) */
 
-#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_MD5_H ) && defined( MD5_DIGEST_LENGTH )
+#if defined( LIBHMAC_HAVE_MD5_SUPPORT )
 
-/* Finalizes the MD5 context using OpenSSL
- * Returns 1 if successful or -1 on error
+/* Exports the MD5 context state using OpenSSL
+ * The state of an OpenSSL context is opaque and cannot be exported
+ * Returns -1 on error
  */
-int libhmac_md5_context_finalize(
+int libhmac_md5_context_export_state(
      libhmac_md5_context_t *context,
-     uint8_t *hash,
-     size_t hash_size,
+     uint8_t *state,
+     size_t state_size,
      libcerror_error_t **error )
 {
-	libhmac_internal_md5_context_t *internal_context = NULL;
-	static char *function                            = "libhmac_md5_context_finalize";
+	static char *function = "libhmac_md5_context_export_state";
 
 	if( context == NULL )
 	{
@@ -1002,71 +2199,110 @@ int libhmac_md5_context_finalize(
 
 		return( -1 );
 	}
-	internal_context = (libhmac_internal_md5_context_t *) context;
-
-	if( hash == NULL )
+	if( state == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid hash.",
+		 "%s: invalid state.",
 		 function );
 
 		return( -1 );
 	}
-	if( hash_size > (size_t) SSIZE_MAX )
+	if( state_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid hash size value exceeds maximum.",
+		 "%s: invalid state size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( hash_size < (size_t) LIBHMAC_MD5_HASH_SIZE )
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: exporting the state of an OpenSSL context is not supported.",
+	 function );
+
+	return( -1 );
+}
+
+/* Imports the MD5 context state using OpenSSL
+ * The state of an OpenSSL context is opaque and cannot be imported
+ * Returns -1 on error
+ */
+int libhmac_md5_context_import_state(
+     libhmac_md5_context_t *context,
+     const uint8_t *state,
+     size_t state_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libhmac_md5_context_import_state";
+
+	if( context == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: invalid hash size value too small.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
 		 function );
 
 		return( -1 );
 	}
-	if( MD5_Final(
-	     hash,
-	     &( internal_context->md5_context ) ) != 1 )
+	if( state == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to finalize context.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid state.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
+	if( state_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid state size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: importing the state of an OpenSSL context is not supported.",
+	 function );
+
+	return( -1 );
 }
 
-#elif defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_MD5 )
+#else
 
-/* Finalizes the MD5 context using OpenSSL EVP
+/* Exports the MD5 context state using fallback implementation
+ * The state contains the data hashed so far, including the data of a partial block,
+ * and can be imported to continue hashing, for example in another process
  * Returns 1 if successful or -1 on error
  */
-int libhmac_md5_context_finalize(
+int libhmac_md5_context_export_state(
      libhmac_md5_context_t *context,
-     uint8_t *hash,
-     size_t hash_size,
+     uint8_t *state,
+     size_t state_size,
      libcerror_error_t **error )
 {
 	libhmac_internal_md5_context_t *internal_context = NULL;
-	static char *function                            = "libhmac_md5_context_finalize";
-	unsigned int safe_hash_size                      = 0;
+	static char *function                            = "libhmac_md5_context_export_state";
+	size_t state_offset                              = 0;
+	int value_index                                  = 0;
 
 	if( context == NULL )
 	{
@@ -1081,70 +2317,138 @@ int libhmac_md5_context_finalize(
 	}
 	internal_context = (libhmac_internal_md5_context_t *) context;
 
-	if( hash == NULL )
+	if( internal_context->block_offset >= LIBHMAC_MD5_BLOCK_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid context - block offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( state == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid hash.",
+		 "%s: invalid state.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( hash_size < (size_t) LIBHMAC_MD5_HASH_SIZE )
-	 || ( hash_size > (size_t) UINT_MAX ) )
+	if( state_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid hash size value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid state size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	safe_hash_size = (unsigned int) hash_size;
+	if( state_size < (size_t) LIBHMAC_MD5_CONTEXT_STATE_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid state size value too small.",
+		 function );
 
-	if( EVP_DigestFinal_ex(
-	     internal_context->evp_md_context,
-	     (unsigned char *) hash,
-	     &safe_hash_size ) != 1 )
+		return( -1 );
+	}
+	if( memory_set(
+	     state,
+	     0,
+	     LIBHMAC_MD5_CONTEXT_STATE_SIZE ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to finalize context.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear state.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     state,
+	     LIBHMAC_CONTEXT_STATE_SIGNATURE,
+	     4 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature to state.",
 		 function );
 
 		return( -1 );
 	}
+	state[ 4 ] = LIBHMAC_CONTEXT_STATE_FORMAT_VERSION;
+	state[ 5 ] = LIBHMAC_HASH_ALGORITHM_MD5;
+
+	byte_stream_copy_from_uint16_big_endian(
+	 &( state[ 6 ] ),
+	 (uint16_t) internal_context->block_offset );
+
+	byte_stream_copy_from_uint64_big_endian(
+	 &( state[ 8 ] ),
+	 internal_context->hash_count );
+
+	state_offset = 16;
+
+	for( value_index = 0;
+	     value_index < 4;
+	     value_index++ )
+	{
+		byte_stream_copy_from_uint32_big_endian(
+		 &( state[ state_offset ] ),
+		 internal_context->hash_values[ value_index ] );
+
+		state_offset += 4;
+	}
+	if( internal_context->block_offset > 0 )
+	{
+		if( memory_copy(
+		     &( state[ state_offset ] ),
+		     internal_context->block,
+		     internal_context->block_offset ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy block to state.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	return( 1 );
 }
 
-#else
-
-/* Finalizes the MD5 context using fallback implementation
+/* Imports the MD5 context state using fallback implementation
+ * The state must have been exported with libhmac_md5_context_export_state
+ * The context is not modified if the state is not valid
  * Returns 1 if successful or -1 on error
  */
-int libhmac_md5_context_finalize(
+int libhmac_md5_context_import_state(
      libhmac_md5_context_t *context,
-     uint8_t *hash,
-     size_t hash_size,
+     const uint8_t *state,
+     size_t state_size,
      libcerror_error_t **error )
 {
 	libhmac_internal_md5_context_t *internal_context = NULL;
-	static char *function                            = "libhmac_md5_context_finalize";
-	size_t block_size                                = 0;
-	size_t number_of_blocks                          = 0;
-	ssize_t process_count                            = 0;
-	uint64_t bit_size                                = 0;
-
-#if !defined( LIBHMAC_UNFOLLED_LOOPS )
-	size_t hash_index                                = 0;
-	int hash_values_index                            = 0;
-#endif
+	static char *function                            = "libhmac_md5_context_import_state";
+	size_t state_offset                              = 0;
+	uint64_t hash_count                              = 0;
+	uint16_t block_offset                            = 0;
+	int value_index                                  = 0;
 
 	if( context == NULL )
 	{
@@ -1159,138 +2463,137 @@ int libhmac_md5_context_finalize(
 	}
 	internal_context = (libhmac_internal_md5_context_t *) context;
 
-	if( hash == NULL )
+	if( state == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid hash.",
+		 "%s: invalid state.",
 		 function );
 
 		return( -1 );
 	}
-	if( hash_size > (size_t) SSIZE_MAX )
+	if( state_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid hash size value exceeds maximum.",
+		 "%s: invalid state size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( hash_size < (size_t) LIBHMAC_MD5_HASH_SIZE )
+	if( state_size < (size_t) LIBHMAC_MD5_CONTEXT_STATE_SIZE )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: invalid hash size value too small.",
+		 "%s: invalid state size value too small.",
 		 function );
 
 		return( -1 );
 	}
-	/* Add padding with a size of 56 mod 64
-	 */
-	number_of_blocks = 1;
-
-	if( internal_context->block_offset > 55 )
-	{
-		number_of_blocks += 1;
-	}
-	block_size = number_of_blocks * LIBHMAC_MD5_BLOCK_SIZE;
-
-	if( memory_set(
-	     &( internal_context->block[ internal_context->block_offset ] ),
-	     0,
-	     block_size - internal_context->block_offset ) == NULL )
+	if( memory_compare(
+	     state,
+	     LIBHMAC_CONTEXT_STATE_SIGNATURE,
+	     4 ) != 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear context block.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid state - unsupported signature.",
 		 function );
 
 		return( -1 );
 	}
-	/* The first byte of the padding contains 0x80
-	 */
-	internal_context->block[ internal_context->block_offset ] = 0x80;
+	if( state[ 4 ] != LIBHMAC_CONTEXT_STATE_FORMAT_VERSION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid state - unsupported format version: %" PRIu8 ".",
+		 function,
+		 state[ 4 ] );
 
-	bit_size = ( internal_context->hash_count + internal_context->block_offset ) * 8;
+		return( -1 );
+	}
+	if( state[ 5 ] != LIBHMAC_HASH_ALGORITHM_MD5 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid state - unsupported hash algorithm: %" PRIu8 ".",
+		 function,
+		 state[ 5 ] );
 
-	byte_stream_copy_from_uint64_little_endian(
-	 &( internal_context->block[ block_size - 8 ] ),
-	 bit_size );
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_big_endian(
+	 &( state[ 6 ] ),
+	 block_offset );
 
-	process_count = libhmac_md5_context_transform(
-	                 internal_context,
-	                 internal_context->block,
-	                 block_size,
-	                 error );
+	byte_stream_copy_to_uint64_big_endian(
+	 &( state[ 8 ] ),
+	 hash_count );
 
-	if( process_count == -1 )
+	if( block_offset >= LIBHMAC_MD5_BLOCK_SIZE )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to transform context block.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid state - block offset value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-#if !defined( LIBHMAC_UNFOLLED_LOOPS )
-	for( hash_values_index = 0;
-	     hash_values_index < 4;
-	     hash_values_index++ )
+	if( ( hash_count % LIBHMAC_MD5_BLOCK_SIZE ) != 0 )
 	{
-		byte_stream_copy_from_uint32_little_endian(
-		 &( hash[ hash_index ] ),
-		 internal_context->hash_values[ hash_values_index ] );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid state - hash count value not a multiple of the block size.",
+		 function );
 
-		hash_index += sizeof( uint32_t );
+		return( -1 );
 	}
-#else
-	byte_stream_copy_from_uint32_little_endian(
-	 &( hash[ 0 ] ),
-	 internal_context->hash_values[ 0 ] );
-
-	byte_stream_copy_from_uint32_little_endian(
-	 &( hash[ 4 ] ),
-	 internal_context->hash_values[ 1 ] );
-
-	byte_stream_copy_from_uint32_little_endian(
-	 &( hash[ 8 ] ),
-	 internal_context->hash_values[ 2 ] );
-
-	byte_stream_copy_from_uint32_little_endian(
-	 &( hash[ 12 ] ),
-	 internal_context->hash_values[ 3 ] );
+	state_offset = 16;
 
-#endif /* !defined( LIBHMAC_UNFOLLED_LOOPS ) */
+	for( value_index = 0;
+	     value_index < 4;
+	     value_index++ )
+	{
+		byte_stream_copy_to_uint32_big_endian(
+		 &( state[ state_offset ] ),
+		 internal_context->hash_values[ value_index ] );
 
-	/* Prevent sensitive data from leaking
-	 */
-	if( memory_set(
-	     internal_context,
-	     0,
-	     sizeof( libhmac_internal_md5_context_t ) ) == NULL )
+		state_offset += 4;
+	}
+	if( memory_copy(
+	     internal_context->block,
+	     &( state[ state_offset ] ),
+	     LIBHMAC_MD5_BLOCK_SIZE ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear context.",
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy block from state.",
 		 function );
 
 		return( -1 );
 	}
+	internal_context->hash_count   = hash_count;
+	internal_context->block_offset = (size_t) block_offset;
+
 	return( 1 );
 }
 
-#endif /* defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_MD5_H ) && defined( MD5_DIGEST_LENGTH ) */
-
+#endif /* defined( LIBHMAC_HAVE_MD5_SUPPORT ) */
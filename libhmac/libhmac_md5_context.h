@@ -32,7 +32,9 @@
 #include <openssl/evp.h>
 #endif
 
+#include "libhmac_definitions.h"
 #include "libhmac_extern.h"
+#include "libhmac_kernel.h"
 #include "libhmac_libcerror.h"
 #include "libhmac_types.h"
 
@@ -48,8 +50,6 @@ extern "C" {
 
 #endif
 
-#define LIBHMAC_MD5_BLOCK_SIZE	64
-
 typedef struct libhmac_internal_md5_context libhmac_internal_md5_context_t;
 
 struct libhmac_internal_md5_context
@@ -88,9 +88,19 @@ struct libhmac_internal_md5_context
 #endif /* defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_MD5_H ) && defined( MD5_DIGEST_LENGTH ) */
 };
 
+int libhmac_md5_context_transform_portable(
+     uint32_t *context_hash_values,
+     const uint8_t *buffer,
+     size_t number_of_blocks );
+
+int libhmac_md5_context_get_transform_function(
+     int kernel_type,
+     libhmac_kernel_transform_32bit_function_t *transform_function,
+     libcerror_error_t **error );
+
 #if !defined( LIBHMAC_HAVE_MD5_SUPPORT )
 
-ssize_t libhmac_context_md5_transform(
+ssize_t libhmac_md5_context_transform(
          libhmac_internal_md5_context_t *internal_context,
          const uint8_t *buffer,
          size_t size,
@@ -98,6 +108,27 @@ ssize_t libhmac_context_md5_transform(
 
 #endif /* !defined( LIBHMAC_HAVE_MD5_SUPPORT ) */
 
+int libhmac_md5_context_transform_blocks(
+     uint32_t *hash_values,
+     const uint8_t *blocks,
+     size_t number_of_blocks );
+
+int libhmac_md5_context_get_kernel_type(
+     void );
+
+int libhmac_internal_md5_context_initialize(
+     libhmac_internal_md5_context_t *internal_context,
+     libcerror_error_t **error );
+
+int libhmac_internal_md5_context_clear(
+     libhmac_internal_md5_context_t *internal_context,
+     libcerror_error_t **error );
+
+int libhmac_internal_md5_context_copy(
+     libhmac_internal_md5_context_t *destination_internal_context,
+     libhmac_internal_md5_context_t *source_internal_context,
+     libcerror_error_t **error );
+
 LIBHMAC_EXTERN \
 int libhmac_md5_context_initialize(
      libhmac_md5_context_t **context,
@@ -108,6 +139,35 @@ int libhmac_md5_context_free(
      libhmac_md5_context_t **context,
      libcerror_error_t **error );
 
+LIBHMAC_EXTERN \
+int libhmac_md5_context_get_size(
+     size_t *context_size,
+     size_t *context_alignment,
+     libcerror_error_t **error );
+
+LIBHMAC_EXTERN \
+int libhmac_md5_context_initialize_in_place(
+     libhmac_md5_context_t **context,
+     uint8_t *memory,
+     size_t memory_size,
+     libcerror_error_t **error );
+
+LIBHMAC_EXTERN \
+int libhmac_md5_context_free_in_place(
+     libhmac_md5_context_t **context,
+     libcerror_error_t **error );
+
+LIBHMAC_EXTERN \
+int libhmac_md5_context_reset(
+     libhmac_md5_context_t *context,
+     libcerror_error_t **error );
+
+LIBHMAC_EXTERN \
+int libhmac_md5_context_clone(
+     libhmac_md5_context_t **destination_context,
+     libhmac_md5_context_t *source_context,
+     libcerror_error_t **error );
+
 LIBHMAC_EXTERN \
 int libhmac_md5_context_update(
      libhmac_md5_context_t *context,
@@ -115,6 +175,14 @@ int libhmac_md5_context_update(
      size_t size,
      libcerror_error_t **error );
 
+LIBHMAC_EXTERN \
+int libhmac_md5_context_update_iov(
+     libhmac_md5_context_t *context,
+     const uint8_t **buffers,
+     const size_t *sizes,
+     int number_of_buffers,
+     libcerror_error_t **error );
+
 LIBHMAC_EXTERN \
 int libhmac_md5_context_finalize(
      libhmac_md5_context_t *context,
@@ -122,6 +190,20 @@ int libhmac_md5_context_finalize(
      size_t hash_size,
      libcerror_error_t **error );
 
+LIBHMAC_EXTERN \
+int libhmac_md5_context_export_state(
+     libhmac_md5_context_t *context,
+     uint8_t *state,
+     size_t state_size,
+     libcerror_error_t **error );
+
+LIBHMAC_EXTERN \
+int libhmac_md5_context_import_state(
+     libhmac_md5_context_t *context,
+     const uint8_t *state,
+     size_t state_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
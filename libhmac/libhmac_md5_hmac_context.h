@@ -0,0 +1,82 @@
+/*
+ * MD5 HMAC context functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBHMAC_MD5_HMAC_CONTEXT_H )
+#define _LIBHMAC_MD5_HMAC_CONTEXT_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libhmac_extern.h"
+#include "libhmac_libcerror.h"
+#include "libhmac_md5_context.h"
+#include "libhmac_md5_key.h"
+#include "libhmac_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libhmac_internal_md5_hmac_context libhmac_internal_md5_hmac_context_t;
+
+struct libhmac_internal_md5_hmac_context
+{
+	/* The key, contains the states after hashing the inner and outer padding blocks
+	 */
+	libhmac_internal_md5_key_t key;
+
+	/* The context, contains the state of the inner hash
+	 */
+	libhmac_internal_md5_context_t context;
+};
+
+LIBHMAC_EXTERN \
+int libhmac_md5_hmac_context_initialize(
+     libhmac_md5_hmac_context_t **hmac_context,
+     const uint8_t *key_data,
+     size_t key_data_size,
+     libcerror_error_t **error );
+
+LIBHMAC_EXTERN \
+int libhmac_md5_hmac_context_free(
+     libhmac_md5_hmac_context_t **hmac_context,
+     libcerror_error_t **error );
+
+LIBHMAC_EXTERN \
+int libhmac_md5_hmac_context_update(
+     libhmac_md5_hmac_context_t *hmac_context,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error );
+
+LIBHMAC_EXTERN \
+int libhmac_md5_hmac_context_finalize(
+     libhmac_md5_hmac_context_t *hmac_context,
+     uint8_t *hmac,
+     size_t hmac_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBHMAC_MD5_HMAC_CONTEXT_H ) */
+
@@ -0,0 +1,289 @@
+/*
+ * MD5 AVX2 multi-buffer kernel functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libhmac_cpu.h"
+#include "libhmac_md5_multi_buffer_avx2.h"
+
+#if defined( LIBHMAC_HAVE_X86_KERNELS )
+
+#include <immintrin.h>
+
+/* Rotates the 8 x 32-bit values to the left, AVX2 has no 32-bit vector rotate
+ */
+#define libhmac_md5_multi_buffer_avx2_rotate_left( values, number_of_bits ) \
+	_mm256_or_si256( \
+	 _mm256_slli_epi32( values, number_of_bits ), \
+	 _mm256_srli_epi32( values, 32 - number_of_bits ) )
+
+/* The round functions
+ * F( b, c, d ) = d ^ ( b & ( c ^ d ) )
+ * G( b, c, d ) = c ^ ( d & ( b ^ c ) )
+ * H( b, c, d ) = b ^ c ^ d
+ * I( b, c, d ) = c ^ ( b | ~d )
+ */
+#define libhmac_md5_multi_buffer_avx2_f( values1, values2, values3 ) \
+	_mm256_xor_si256( \
+	 values3, \
+	 _mm256_and_si256( \
+	  values1, \
+	  _mm256_xor_si256( values2, values3 ) ) )
+
+#define libhmac_md5_multi_buffer_avx2_g( values1, values2, values3 ) \
+	_mm256_xor_si256( \
+	 values2, \
+	 _mm256_and_si256( \
+	  values3, \
+	  _mm256_xor_si256( values1, values2 ) ) )
+
+#define libhmac_md5_multi_buffer_avx2_h( values1, values2, values3 ) \
+	_mm256_xor_si256( \
+	 _mm256_xor_si256( values1, values2 ), \
+	 values3 )
+
+#define libhmac_md5_multi_buffer_avx2_i( values1, values2, values3 ) \
+	_mm256_xor_si256( \
+	 values2, \
+	 _mm256_or_si256( \
+	  values1, \
+	  _mm256_xor_si256( values3, _mm256_set1_epi32( -1 ) ) ) )
+
+/* Calculates a round of the 8 lanes
+ */
+#define libhmac_md5_multi_buffer_avx2_calculate_hash_value( round_function, message_values, message_value_index, hash_values, hash_value_index0, hash_value_index1, hash_value_index2, hash_value_index3, sine, bit_shift ) \
+	hash_values[ hash_value_index0 ] = _mm256_add_epi32( \
+	 hash_values[ hash_value_index0 ], \
+	 _mm256_add_epi32( \
+	  message_values[ message_value_index ], \
+	  _mm256_set1_epi32( (int) sine ) ) ); \
+	hash_values[ hash_value_index0 ] = _mm256_add_epi32( \
+	 hash_values[ hash_value_index0 ], \
+	 round_function( hash_values[ hash_value_index1 ], hash_values[ hash_value_index2 ], hash_values[ hash_value_index3 ] ) ); \
+	hash_values[ hash_value_index0 ] = libhmac_md5_multi_buffer_avx2_rotate_left( \
+	 hash_values[ hash_value_index0 ], \
+	 bit_shift ); \
+	hash_values[ hash_value_index0 ] = _mm256_add_epi32( \
+	 hash_values[ hash_value_index0 ], \
+	 hash_values[ hash_value_index1 ] );
+
+/* Calculates the 64 rounds of the 8 lanes
+ * The sines and bit shifts are the same as in libhmac_md5_context_transform_calculate_hash_values
+ */
+#define libhmac_md5_multi_buffer_avx2_calculate_hash_values( message_values, hash_values ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_f, message_values, 0, hash_values, 0, 1, 2, 3, 0xd76aa478UL, 7 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_f, message_values, 1, hash_values, 3, 0, 1, 2, 0xe8c7b756UL, 12 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_f, message_values, 2, hash_values, 2, 3, 0, 1, 0x242070dbUL, 17 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_f, message_values, 3, hash_values, 1, 2, 3, 0, 0xc1bdceeeUL, 22 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_f, message_values, 4, hash_values, 0, 1, 2, 3, 0xf57c0fafUL, 7 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_f, message_values, 5, hash_values, 3, 0, 1, 2, 0x4787c62aUL, 12 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_f, message_values, 6, hash_values, 2, 3, 0, 1, 0xa8304613UL, 17 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_f, message_values, 7, hash_values, 1, 2, 3, 0, 0xfd469501UL, 22 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_f, message_values, 8, hash_values, 0, 1, 2, 3, 0x698098d8UL, 7 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_f, message_values, 9, hash_values, 3, 0, 1, 2, 0x8b44f7afUL, 12 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_f, message_values, 10, hash_values, 2, 3, 0, 1, 0xffff5bb1UL, 17 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_f, message_values, 11, hash_values, 1, 2, 3, 0, 0x895cd7beUL, 22 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_f, message_values, 12, hash_values, 0, 1, 2, 3, 0x6b901122UL, 7 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_f, message_values, 13, hash_values, 3, 0, 1, 2, 0xfd987193UL, 12 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_f, message_values, 14, hash_values, 2, 3, 0, 1, 0xa679438eUL, 17 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_f, message_values, 15, hash_values, 1, 2, 3, 0, 0x49b40821UL, 22 ) \
+\
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_g, message_values, 1, hash_values, 0, 1, 2, 3, 0xf61e2562UL, 5 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_g, message_values, 6, hash_values, 3, 0, 1, 2, 0xc040b340UL, 9 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_g, message_values, 11, hash_values, 2, 3, 0, 1, 0x265e5a51UL, 14 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_g, message_values, 0, hash_values, 1, 2, 3, 0, 0xe9b6c7aaUL, 20 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_g, message_values, 5, hash_values, 0, 1, 2, 3, 0xd62f105dUL, 5 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_g, message_values, 10, hash_values, 3, 0, 1, 2, 0x02441453UL, 9 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_g, message_values, 15, hash_values, 2, 3, 0, 1, 0xd8a1e681UL, 14 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_g, message_values, 4, hash_values, 1, 2, 3, 0, 0xe7d3fbc8UL, 20 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_g, message_values, 9, hash_values, 0, 1, 2, 3, 0x21e1cde6UL, 5 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_g, message_values, 14, hash_values, 3, 0, 1, 2, 0xc33707d6UL, 9 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_g, message_values, 3, hash_values, 2, 3, 0, 1, 0xf4d50d87UL, 14 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_g, message_values, 8, hash_values, 1, 2, 3, 0, 0x455a14edUL, 20 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_g, message_values, 13, hash_values, 0, 1, 2, 3, 0xa9e3e905UL, 5 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_g, message_values, 2, hash_values, 3, 0, 1, 2, 0xfcefa3f8UL, 9 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_g, message_values, 7, hash_values, 2, 3, 0, 1, 0x676f02d9UL, 14 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_g, message_values, 12, hash_values, 1, 2, 3, 0, 0x8d2a4c8aUL, 20 ) \
+\
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_h, message_values, 5, hash_values, 0, 1, 2, 3, 0xfffa3942UL, 4 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_h, message_values, 8, hash_values, 3, 0, 1, 2, 0x8771f681UL, 11 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_h, message_values, 11, hash_values, 2, 3, 0, 1, 0x6d9d6122UL, 16 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_h, message_values, 14, hash_values, 1, 2, 3, 0, 0xfde5380cUL, 23 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_h, message_values, 1, hash_values, 0, 1, 2, 3, 0xa4beea44UL, 4 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_h, message_values, 4, hash_values, 3, 0, 1, 2, 0x4bdecfa9UL, 11 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_h, message_values, 7, hash_values, 2, 3, 0, 1, 0xf6bb4b60UL, 16 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_h, message_values, 10, hash_values, 1, 2, 3, 0, 0xbebfbc70UL, 23 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_h, message_values, 13, hash_values, 0, 1, 2, 3, 0x289b7ec6UL, 4 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_h, message_values, 0, hash_values, 3, 0, 1, 2, 0xeaa127faUL, 11 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_h, message_values, 3, hash_values, 2, 3, 0, 1, 0xd4ef3085UL, 16 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_h, message_values, 6, hash_values, 1, 2, 3, 0, 0x04881d05UL, 23 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_h, message_values, 9, hash_values, 0, 1, 2, 3, 0xd9d4d039UL, 4 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_h, message_values, 12, hash_values, 3, 0, 1, 2, 0xe6db99e5UL, 11 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_h, message_values, 15, hash_values, 2, 3, 0, 1, 0x1fa27cf8UL, 16 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_h, message_values, 2, hash_values, 1, 2, 3, 0, 0xc4ac5665UL, 23 ) \
+\
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_i, message_values, 0, hash_values, 0, 1, 2, 3, 0xf4292244UL, 6 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_i, message_values, 7, hash_values, 3, 0, 1, 2, 0x432aff97UL, 10 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_i, message_values, 14, hash_values, 2, 3, 0, 1, 0xab9423a7UL, 15 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_i, message_values, 5, hash_values, 1, 2, 3, 0, 0xfc93a039UL, 21 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_i, message_values, 12, hash_values, 0, 1, 2, 3, 0x655b59c3UL, 6 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_i, message_values, 3, hash_values, 3, 0, 1, 2, 0x8f0ccc92UL, 10 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_i, message_values, 10, hash_values, 2, 3, 0, 1, 0xffeff47dUL, 15 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_i, message_values, 1, hash_values, 1, 2, 3, 0, 0x85845dd1UL, 21 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_i, message_values, 8, hash_values, 0, 1, 2, 3, 0x6fa87e4fUL, 6 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_i, message_values, 15, hash_values, 3, 0, 1, 2, 0xfe2ce6e0UL, 10 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_i, message_values, 6, hash_values, 2, 3, 0, 1, 0xa3014314UL, 15 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_i, message_values, 13, hash_values, 1, 2, 3, 0, 0x4e0811a1UL, 21 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_i, message_values, 4, hash_values, 0, 1, 2, 3, 0xf7537e82UL, 6 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_i, message_values, 11, hash_values, 3, 0, 1, 2, 0xbd3af235UL, 10 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_i, message_values, 2, hash_values, 2, 3, 0, 1, 0x2ad7d2bbUL, 15 ) \
+	libhmac_md5_multi_buffer_avx2_calculate_hash_value( libhmac_md5_multi_buffer_avx2_i, message_values, 9, hash_values, 1, 2, 3, 0, 0xeb86d391UL, 21 )
+
+/* Calculates the MD5 of 64 byte sized blocks of data of 8 independent messages at the same time
+ * Every lane of the 256-bit registers contains the values of one message
+ * lanes_hash_values contains the 8 x 32-bit hash values per word, hash value 0 of the 8 lanes
+ * followed by hash value 1 of the 8 lanes, etc.
+ * lanes_buffer contains a pointer to the blocks of data of every lane
+ * This kernel requires the AVX and AVX2 extensions
+ * Returns 1 if successful or -1 on error
+ */
+LIBHMAC_X86_TARGET( "avx,avx2" ) \
+int libhmac_md5_multi_buffer_avx2_transform(
+     uint32_t *lanes_hash_values,
+     const uint8_t **lanes_buffer,
+     size_t number_of_blocks )
+{
+	__m256i hash_values[ 4 ];
+	__m256i lane_values[ 8 ];
+	__m256i message_values[ 16 ];
+	__m256i previous_hash_values[ 4 ];
+	__m256i temporary_values[ 8 ];
+
+	size_t buffer_offset = 0;
+	int lane_index       = 0;
+	int values_index     = 0;
+
+	for( values_index = 0;
+	     values_index < 4;
+	     values_index++ )
+	{
+		hash_values[ values_index ] = _mm256_loadu_si256(
+		                               (const __m256i *) &( lanes_hash_values[ values_index * 8 ] ) );
+	}
+	while( number_of_blocks > 0 )
+	{
+		/* Break the blocks into 16 x 32-bit little-endian values per lane by transposing 2 times 8 x 8 x 32-bit values
+		 */
+		for( values_index = 0;
+		     values_index < 16;
+		     values_index += 8 )
+		{
+			for( lane_index = 0;
+			     lane_index < 8;
+			     lane_index++ )
+			{
+				lane_values[ lane_index ] = _mm256_loadu_si256(
+				                             (const __m256i *) &( ( lanes_buffer[ lane_index ] )[ buffer_offset + ( values_index * 4 ) ] ) );
+			}
+			temporary_values[ 0 ] = _mm256_unpacklo_epi32( lane_values[ 0 ], lane_values[ 1 ] );
+			temporary_values[ 1 ] = _mm256_unpackhi_epi32( lane_values[ 0 ], lane_values[ 1 ] );
+			temporary_values[ 2 ] = _mm256_unpacklo_epi32( lane_values[ 2 ], lane_values[ 3 ] );
+			temporary_values[ 3 ] = _mm256_unpackhi_epi32( lane_values[ 2 ], lane_values[ 3 ] );
+			temporary_values[ 4 ] = _mm256_unpacklo_epi32( lane_values[ 4 ], lane_values[ 5 ] );
+			temporary_values[ 5 ] = _mm256_unpackhi_epi32( lane_values[ 4 ], lane_values[ 5 ] );
+			temporary_values[ 6 ] = _mm256_unpacklo_epi32( lane_values[ 6 ], lane_values[ 7 ] );
+			temporary_values[ 7 ] = _mm256_unpackhi_epi32( lane_values[ 6 ], lane_values[ 7 ] );
+
+			lane_values[ 0 ] = _mm256_unpacklo_epi64( temporary_values[ 0 ], temporary_values[ 2 ] );
+			lane_values[ 1 ] = _mm256_unpackhi_epi64( temporary_values[ 0 ], temporary_values[ 2 ] );
+			lane_values[ 2 ] = _mm256_unpacklo_epi64( temporary_values[ 1 ], temporary_values[ 3 ] );
+			lane_values[ 3 ] = _mm256_unpackhi_epi64( temporary_values[ 1 ], temporary_values[ 3 ] );
+			lane_values[ 4 ] = _mm256_unpacklo_epi64( temporary_values[ 4 ], temporary_values[ 6 ] );
+			lane_values[ 5 ] = _mm256_unpackhi_epi64( temporary_values[ 4 ], temporary_values[ 6 ] );
+			lane_values[ 6 ] = _mm256_unpacklo_epi64( temporary_values[ 5 ], temporary_values[ 7 ] );
+			lane_values[ 7 ] = _mm256_unpackhi_epi64( temporary_values[ 5 ], temporary_values[ 7 ] );
+
+			message_values[ values_index + 0 ] = _mm256_permute2x128_si256( lane_values[ 0 ], lane_values[ 4 ], 0x20 );
+			message_values[ values_index + 1 ] = _mm256_permute2x128_si256( lane_values[ 1 ], lane_values[ 5 ], 0x20 );
+			message_values[ values_index + 2 ] = _mm256_permute2x128_si256( lane_values[ 2 ], lane_values[ 6 ], 0x20 );
+			message_values[ values_index + 3 ] = _mm256_permute2x128_si256( lane_values[ 3 ], lane_values[ 7 ], 0x20 );
+			message_values[ values_index + 4 ] = _mm256_permute2x128_si256( lane_values[ 0 ], lane_values[ 4 ], 0x31 );
+			message_values[ values_index + 5 ] = _mm256_permute2x128_si256( lane_values[ 1 ], lane_values[ 5 ], 0x31 );
+			message_values[ values_index + 6 ] = _mm256_permute2x128_si256( lane_values[ 2 ], lane_values[ 6 ], 0x31 );
+			message_values[ values_index + 7 ] = _mm256_permute2x128_si256( lane_values[ 3 ], lane_values[ 7 ], 0x31 );
+		}
+		for( values_index = 0;
+		     values_index < 4;
+		     values_index++ )
+		{
+			previous_hash_values[ values_index ] = hash_values[ values_index ];
+		}
+		libhmac_md5_multi_buffer_avx2_calculate_hash_values( message_values, hash_values )
+
+		for( values_index = 0;
+		     values_index < 4;
+		     values_index++ )
+		{
+			hash_values[ values_index ] = _mm256_add_epi32(
+			                               hash_values[ values_index ],
+			                               previous_hash_values[ values_index ] );
+		}
+		buffer_offset    += 64;
+		number_of_blocks -= 1;
+	}
+	for( values_index = 0;
+	     values_index < 4;
+	     values_index++ )
+	{
+		_mm256_storeu_si256(
+		 (__m256i *) &( lanes_hash_values[ values_index * 8 ] ),
+		 hash_values[ values_index ] );
+	}
+	/* Prevent sensitive data from leaking
+	 */
+	if( memory_set(
+	     message_values,
+	     0,
+	     sizeof( __m256i ) * 16 ) == NULL )
+	{
+		return( -1 );
+	}
+	if( memory_set(
+	     lane_values,
+	     0,
+	     sizeof( __m256i ) * 8 ) == NULL )
+	{
+		return( -1 );
+	}
+	if( memory_set(
+	     temporary_values,
+	     0,
+	     sizeof( __m256i ) * 8 ) == NULL )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( LIBHMAC_HAVE_X86_KERNELS ) */
+
@@ -0,0 +1,108 @@
+/*
+ * SHA1 HMAC key functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBHMAC_SHA1_KEY_H )
+#define _LIBHMAC_SHA1_KEY_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libhmac_extern.h"
+#include "libhmac_libcerror.h"
+#include "libhmac_sha1_context.h"
+#include "libhmac_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define LIBHMAC_SHA1_KEY_VERIFY_BATCH_SIZE	32
+
+typedef struct libhmac_internal_sha1_key libhmac_internal_sha1_key_t;
+
+struct libhmac_internal_sha1_key
+{
+	/* The inner context, contains the state after hashing the inner padding block
+	 */
+	libhmac_internal_sha1_context_t inner_context;
+
+	/* The outer context, contains the state after hashing the outer padding block
+	 */
+	libhmac_internal_sha1_context_t outer_context;
+};
+
+int libhmac_internal_sha1_key_initialize(
+     libhmac_internal_sha1_key_t *internal_key,
+     const uint8_t *key_data,
+     size_t key_data_size,
+     libcerror_error_t **error );
+
+int libhmac_internal_sha1_key_clear(
+     libhmac_internal_sha1_key_t *internal_key,
+     libcerror_error_t **error );
+
+int libhmac_internal_sha1_key_calculate_hmac(
+     libhmac_internal_sha1_key_t *internal_key,
+     const uint8_t *buffer,
+     size_t size,
+     uint8_t *hmac,
+     size_t hmac_size,
+     libcerror_error_t **error );
+
+LIBHMAC_EXTERN \
+int libhmac_sha1_key_initialize(
+     libhmac_sha1_key_t **key,
+     const uint8_t *key_data,
+     size_t key_data_size,
+     libcerror_error_t **error );
+
+LIBHMAC_EXTERN \
+int libhmac_sha1_key_free(
+     libhmac_sha1_key_t **key,
+     libcerror_error_t **error );
+
+LIBHMAC_EXTERN \
+int libhmac_sha1_key_calculate_hmac(
+     libhmac_sha1_key_t *key,
+     const uint8_t *buffer,
+     size_t size,
+     uint8_t *hmac,
+     size_t hmac_size,
+     libcerror_error_t **error );
+
+LIBHMAC_EXTERN \
+int libhmac_sha1_key_verify_hmac_batch(
+     libhmac_sha1_key_t *key,
+     const uint8_t **buffers,
+     const size_t *sizes,
+     int number_of_buffers,
+     const uint8_t *hmacs,
+     size_t hmacs_size,
+     uint8_t *results,
+     size_t results_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBHMAC_SHA1_KEY_H ) */
+
@@ -0,0 +1,1201 @@
+/*
+ * SHA-1 multi-buffer functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libhmac_atomic.h"
+#include "libhmac_definitions.h"
+#include "libhmac_kernel.h"
+#include "libhmac_libcerror.h"
+#include "libhmac_sha1_context.h"
+#include "libhmac_sha1_multi_buffer.h"
+#include "libhmac_sha1_multi_buffer_avx2.h"
+#include "libhmac_sha1_multi_buffer_avx512.h"
+
+#if !defined( LIBHMAC_HAVE_SHA1_SUPPORT )
+
+/* The initial hash values
+ */
+static const uint32_t libhmac_sha1_multi_buffer_initial_hash_values[ 5 ] = {
+	0x67452301UL, 0xefcdab89UL, 0x98badcfeUL, 0x10325476UL, 0xc3d2e1f0UL
+};
+
+/* The SHA-1 multi-buffer kernels in order of preference
+ * The portable kernel is expected to be last, it has no multi-buffer transform
+ * and indicates that the messages are transformed one at a time
+ */
+static int libhmac_sha1_multi_buffer_kernel_types[ ] = {
+#if defined( LIBHMAC_HAVE_X86_KERNELS )
+	LIBHMAC_KERNEL_TYPE_AVX512,
+	LIBHMAC_KERNEL_TYPE_AVX2,
+#endif
+	LIBHMAC_KERNEL_TYPE_PORTABLE };
+
+static libhmac_kernel_multi_buffer_transform_32bit_function_t libhmac_sha1_multi_buffer_kernel_functions[ ] = {
+#if defined( LIBHMAC_HAVE_X86_KERNELS )
+	libhmac_sha1_multi_buffer_avx512_transform,
+	libhmac_sha1_multi_buffer_avx2_transform,
+#endif
+	NULL };
+
+static int libhmac_sha1_multi_buffer_kernel_number_of_lanes[ ] = {
+#if defined( LIBHMAC_HAVE_X86_KERNELS )
+	LIBHMAC_SHA1_MULTI_BUFFER_AVX512_NUMBER_OF_LANES,
+	LIBHMAC_SHA1_MULTI_BUFFER_AVX2_NUMBER_OF_LANES,
+#endif
+	0 };
+
+/* The minimum number of active lanes for which the multi-buffer kernel is faster
+ * than the single-stream kernel, with fewer active lanes the remaining blocks
+ * are transformed one message at a time
+ */
+static int libhmac_sha1_multi_buffer_kernel_minimum_number_of_active_lanes[ ] = {
+#if defined( LIBHMAC_HAVE_X86_KERNELS )
+	3,
+	3,
+#endif
+	0 };
+
+/* The minimum number of active lanes when the single-stream kernel uses the SHA
+ * extensions, a value larger than the number of lanes indicates that the single-stream
+ * kernel is always faster
+ */
+static int libhmac_sha1_multi_buffer_kernel_sha_ni_minimum_number_of_active_lanes[ ] = {
+#if defined( LIBHMAC_HAVE_X86_KERNELS )
+	7,
+	9,
+#endif
+	0 };
+
+#define LIBHMAC_SHA1_MULTI_BUFFER_NUMBER_OF_KERNELS \
+	(int) ( sizeof( libhmac_sha1_multi_buffer_kernel_types ) / sizeof( int ) )
+
+/* The index of the selected kernel or -1 if not yet selected
+ */
+static int libhmac_sha1_multi_buffer_kernel_index = -1;
+
+/* Retrieves the index of the selected kernel
+ * The kernel is selected on first use, concurrent callers select the same kernel
+ * Returns the kernel index
+ */
+static int libhmac_sha1_multi_buffer_get_kernel_index(
+            void )
+{
+	int kernel_index = libhmac_atomic_get_32bit( &libhmac_sha1_multi_buffer_kernel_index );
+
+	if( kernel_index < 0 )
+	{
+		kernel_index = libhmac_kernel_select(
+		                libhmac_sha1_multi_buffer_kernel_types,
+		                LIBHMAC_SHA1_MULTI_BUFFER_NUMBER_OF_KERNELS );
+
+		libhmac_atomic_set_32bit(
+		 &libhmac_sha1_multi_buffer_kernel_index,
+		 kernel_index );
+	}
+	return( kernel_index );
+}
+
+/* Retrieves the multi-buffer transform function of a specific kernel
+ * Returns 1 if successful, 0 if the kernel is not available or -1 on error
+ */
+int libhmac_sha1_multi_buffer_get_transform_function(
+     int kernel_type,
+     libhmac_kernel_multi_buffer_transform_32bit_function_t *transform_function,
+     int *number_of_lanes,
+     libcerror_error_t **error )
+{
+	static char *function = "libhmac_sha1_multi_buffer_get_transform_function";
+	int kernel_index      = 0;
+
+	if( transform_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid transform function.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_lanes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of lanes.",
+		 function );
+
+		return( -1 );
+	}
+	for( kernel_index = 0;
+	     kernel_index < LIBHMAC_SHA1_MULTI_BUFFER_NUMBER_OF_KERNELS;
+	     kernel_index++ )
+	{
+		if( libhmac_sha1_multi_buffer_kernel_types[ kernel_index ] == kernel_type )
+		{
+			if( ( libhmac_sha1_multi_buffer_kernel_functions[ kernel_index ] == NULL )
+			 || ( libhmac_kernel_is_supported(
+			       kernel_type ) == 0 ) )
+			{
+				break;
+			}
+			*transform_function = libhmac_sha1_multi_buffer_kernel_functions[ kernel_index ];
+			*number_of_lanes    = libhmac_sha1_multi_buffer_kernel_number_of_lanes[ kernel_index ];
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Retrieves the type of the kernel used by the SHA-1 multi-buffer functions
+ * Returns the kernel type, where the portable kernel indicates that no multi-buffer kernel is used
+ */
+int libhmac_sha1_multi_buffer_get_kernel_type(
+     void )
+{
+	return( libhmac_sha1_multi_buffer_kernel_types[ libhmac_sha1_multi_buffer_get_kernel_index() ] );
+}
+
+/* Initializes a multi-buffer scheduler
+ * Selects the multi-buffer kernel and the single-stream kernel that transforms
+ * the remaining blocks when too few lanes are active
+ * Returns 1 if successful, 0 if the multi-buffer kernel is not available or never faster or -1 on error
+ */
+int libhmac_sha1_multi_buffer_scheduler_initialize(
+     libhmac_sha1_multi_buffer_scheduler_t *scheduler,
+     libcerror_error_t **error )
+{
+	static char *function         = "libhmac_sha1_multi_buffer_scheduler_initialize";
+	int kernel_index              = 0;
+	int lane_index                = 0;
+	int single_stream_kernel_type = 0;
+
+	if( scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     scheduler,
+	     0,
+	     sizeof( libhmac_sha1_multi_buffer_scheduler_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	kernel_index = libhmac_sha1_multi_buffer_get_kernel_index();
+
+	if( libhmac_sha1_multi_buffer_kernel_functions[ kernel_index ] == NULL )
+	{
+		return( 0 );
+	}
+	single_stream_kernel_type = libhmac_sha1_context_get_kernel_type();
+
+	if( single_stream_kernel_type == LIBHMAC_KERNEL_TYPE_SHA_NI )
+	{
+		scheduler->minimum_number_of_active_lanes = libhmac_sha1_multi_buffer_kernel_sha_ni_minimum_number_of_active_lanes[ kernel_index ];
+	}
+	else
+	{
+		scheduler->minimum_number_of_active_lanes = libhmac_sha1_multi_buffer_kernel_minimum_number_of_active_lanes[ kernel_index ];
+	}
+	scheduler->number_of_lanes = libhmac_sha1_multi_buffer_kernel_number_of_lanes[ kernel_index ];
+
+	if( scheduler->minimum_number_of_active_lanes > scheduler->number_of_lanes )
+	{
+		return( 0 );
+	}
+	if( libhmac_sha1_context_get_transform_function(
+	     single_stream_kernel_type,
+	     &( scheduler->single_stream_transform_function ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve single-stream transform function.",
+		 function );
+
+		return( -1 );
+	}
+	scheduler->transform_function = libhmac_sha1_multi_buffer_kernel_functions[ kernel_index ];
+
+	for( lane_index = 0;
+	     lane_index < scheduler->number_of_lanes;
+	     lane_index++ )
+	{
+		scheduler->lanes[ lane_index ].message_index = -1;
+	}
+	return( 1 );
+}
+
+/* Clears a multi-buffer scheduler
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_sha1_multi_buffer_scheduler_clear(
+     libhmac_sha1_multi_buffer_scheduler_t *scheduler,
+     libcerror_error_t **error )
+{
+	static char *function = "libhmac_sha1_multi_buffer_scheduler_clear";
+
+	if( scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	/* Prevent sensitive data from leaking
+	 */
+	if( memory_set(
+	     scheduler,
+	     0,
+	     sizeof( libhmac_sha1_multi_buffer_scheduler_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the index of an empty lane
+ * Returns 1 if successful, 0 if no empty lane is available or -1 on error
+ */
+int libhmac_sha1_multi_buffer_scheduler_get_empty_lane(
+     libhmac_sha1_multi_buffer_scheduler_t *scheduler,
+     int *lane_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libhmac_sha1_multi_buffer_scheduler_get_empty_lane";
+	int safe_lane_index   = 0;
+
+	if( scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( lane_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lane index.",
+		 function );
+
+		return( -1 );
+	}
+	for( safe_lane_index = 0;
+	     safe_lane_index < scheduler->number_of_lanes;
+	     safe_lane_index++ )
+	{
+		if( scheduler->lanes[ safe_lane_index ].message_index == -1 )
+		{
+			*lane_index = safe_lane_index;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Assigns a message to an empty lane, continuing from the hash values
+ * The prefix size is the number of bytes already hashed into the hash values,
+ * which must be a multiple of the block size
+ * The buffer must remain available until the hash of the lane has been retrieved
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_sha1_multi_buffer_scheduler_set_lane_message_with_state(
+     libhmac_sha1_multi_buffer_scheduler_t *scheduler,
+     int lane_index,
+     int message_index,
+     const uint8_t *buffer,
+     size_t size,
+     const uint32_t *hash_values,
+     uint64_t prefix_size,
+     libcerror_error_t **error )
+{
+	libhmac_sha1_multi_buffer_lane_t *lane = NULL;
+	static char *function                    = "libhmac_sha1_multi_buffer_scheduler_set_lane_message_with_state";
+	size_t number_of_blocks                  = 0;
+	size_t remaining_size                    = 0;
+	uint64_t bit_size                        = 0;
+	int hash_values_index                    = 0;
+
+	if( scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( lane_index < 0 )
+	 || ( lane_index >= scheduler->number_of_lanes ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid lane index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	lane = &( scheduler->lanes[ lane_index ] );
+
+	if( lane->message_index != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid lane: %d - message already set.",
+		 function,
+		 lane_index );
+
+		return( -1 );
+	}
+	if( message_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid message index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( prefix_size % LIBHMAC_SHA1_BLOCK_SIZE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported prefix size value not a multiple of the block size.",
+		 function );
+
+		return( -1 );
+	}
+	for( hash_values_index = 0;
+	     hash_values_index < 5;
+	     hash_values_index++ )
+	{
+		scheduler->lanes_hash_values[ ( hash_values_index * scheduler->number_of_lanes ) + lane_index ] = hash_values[ hash_values_index ];
+	}
+	number_of_blocks = size / LIBHMAC_SHA1_BLOCK_SIZE;
+	remaining_size   = size % LIBHMAC_SHA1_BLOCK_SIZE;
+
+	/* Prepare the final blocks, which contain the remaining data, the padding
+	 * and the size of the message in bits
+	 */
+	if( memory_set(
+	     lane->final_blocks,
+	     0,
+	     2 * LIBHMAC_SHA1_BLOCK_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear final blocks.",
+		 function );
+
+		return( -1 );
+	}
+	if( remaining_size > 0 )
+	{
+		if( memory_copy(
+		     lane->final_blocks,
+		     &( buffer[ number_of_blocks * LIBHMAC_SHA1_BLOCK_SIZE ] ),
+		     remaining_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy remaining data to final blocks.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	lane->final_blocks[ remaining_size ] = 0x80;
+
+	lane->number_of_final_blocks = 1;
+
+	if( remaining_size > ( LIBHMAC_SHA1_BLOCK_SIZE - 9 ) )
+	{
+		lane->number_of_final_blocks += 1;
+	}
+	bit_size = ( prefix_size + (uint64_t) size ) * 8;
+
+	byte_stream_copy_from_uint64_big_endian(
+	 &( lane->final_blocks[ ( lane->number_of_final_blocks * LIBHMAC_SHA1_BLOCK_SIZE ) - 8 ] ),
+	 bit_size );
+
+	if( number_of_blocks > 0 )
+	{
+		lane->buffer           = buffer;
+		lane->number_of_blocks = number_of_blocks;
+		lane->is_final         = 0;
+	}
+	else
+	{
+		lane->buffer           = lane->final_blocks;
+		lane->number_of_blocks = lane->number_of_final_blocks;
+		lane->is_final         = 1;
+	}
+	lane->message_index = message_index;
+
+	scheduler->number_of_active_lanes += 1;
+
+	return( 1 );
+}
+
+/* Assigns a message to an empty lane
+ * The buffer must remain available until the hash of the lane has been retrieved
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_sha1_multi_buffer_scheduler_set_lane_message(
+     libhmac_sha1_multi_buffer_scheduler_t *scheduler,
+     int lane_index,
+     int message_index,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "libhmac_sha1_multi_buffer_scheduler_set_lane_message";
+
+	if( libhmac_sha1_multi_buffer_scheduler_set_lane_message_with_state(
+	     scheduler,
+	     lane_index,
+	     message_index,
+	     buffer,
+	     size,
+	     libhmac_sha1_multi_buffer_initial_hash_values,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set message in lane: %d.",
+		 function,
+		 lane_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Determines if the message of a lane is complete
+ * Returns 1 if the message is complete, 0 if not or if the lane is empty
+ */
+int libhmac_sha1_multi_buffer_scheduler_lane_is_complete(
+     libhmac_sha1_multi_buffer_scheduler_t *scheduler,
+     int lane_index )
+{
+	libhmac_sha1_multi_buffer_lane_t *lane = NULL;
+
+	if( ( scheduler == NULL )
+	 || ( lane_index < 0 )
+	 || ( lane_index >= scheduler->number_of_lanes ) )
+	{
+		return( 0 );
+	}
+	lane = &( scheduler->lanes[ lane_index ] );
+
+	if( ( lane->message_index == -1 )
+	 || ( lane->is_final == 0 )
+	 || ( lane->number_of_blocks > 0 ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Transforms the blocks of all active lanes up to the first lane that requires a new buffer
+ * Empty lanes transform the blocks of an active lane and their hash values are ignored
+ * Afterwards at least one lane has a complete message or continues with its final blocks
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_sha1_multi_buffer_scheduler_transform(
+     libhmac_sha1_multi_buffer_scheduler_t *scheduler,
+     libcerror_error_t **error )
+{
+	libhmac_sha1_multi_buffer_lane_t *lane = NULL;
+	const uint8_t *active_lane_buffer        = NULL;
+	static char *function                    = "libhmac_sha1_multi_buffer_scheduler_transform";
+	size_t number_of_blocks                  = 0;
+	int lane_index                           = 0;
+
+	if( scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( scheduler->transform_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid scheduler - missing transform function.",
+		 function );
+
+		return( -1 );
+	}
+	for( lane_index = 0;
+	     lane_index < scheduler->number_of_lanes;
+	     lane_index++ )
+	{
+		lane = &( scheduler->lanes[ lane_index ] );
+
+		if( lane->message_index == -1 )
+		{
+			continue;
+		}
+		if( lane->number_of_blocks == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid lane: %d - message is complete.",
+			 function,
+			 lane_index );
+
+			return( -1 );
+		}
+		if( ( number_of_blocks == 0 )
+		 || ( lane->number_of_blocks < number_of_blocks ) )
+		{
+			number_of_blocks = lane->number_of_blocks;
+		}
+		active_lane_buffer = lane->buffer;
+	}
+	if( number_of_blocks == 0 )
+	{
+		return( 1 );
+	}
+	for( lane_index = 0;
+	     lane_index < scheduler->number_of_lanes;
+	     lane_index++ )
+	{
+		if( scheduler->lanes[ lane_index ].message_index == -1 )
+		{
+			scheduler->lanes_buffer[ lane_index ] = active_lane_buffer;
+		}
+		else
+		{
+			scheduler->lanes_buffer[ lane_index ] = scheduler->lanes[ lane_index ].buffer;
+		}
+	}
+	if( scheduler->transform_function(
+	     scheduler->lanes_hash_values,
+	     scheduler->lanes_buffer,
+	     number_of_blocks ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to transform blocks.",
+		 function );
+
+		return( -1 );
+	}
+	for( lane_index = 0;
+	     lane_index < scheduler->number_of_lanes;
+	     lane_index++ )
+	{
+		lane = &( scheduler->lanes[ lane_index ] );
+
+		if( lane->message_index == -1 )
+		{
+			continue;
+		}
+		lane->buffer           += number_of_blocks * LIBHMAC_SHA1_BLOCK_SIZE;
+		lane->number_of_blocks -= number_of_blocks;
+
+		if( ( lane->number_of_blocks == 0 )
+		 && ( lane->is_final == 0 ) )
+		{
+			lane->buffer           = lane->final_blocks;
+			lane->number_of_blocks = lane->number_of_final_blocks;
+			lane->is_final         = 1;
+		}
+	}
+	return( 1 );
+}
+
+/* Transforms the remaining blocks of a lane using the single-stream kernel
+ * Afterwards the message of the lane is complete
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_sha1_multi_buffer_scheduler_transform_lane(
+     libhmac_sha1_multi_buffer_scheduler_t *scheduler,
+     int lane_index,
+     libcerror_error_t **error )
+{
+	libhmac_sha1_multi_buffer_lane_t *lane = NULL;
+	static char *function                    = "libhmac_sha1_multi_buffer_scheduler_transform_lane";
+	int hash_values_index                    = 0;
+
+	if( scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( scheduler->single_stream_transform_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid scheduler - missing single-stream transform function.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( lane_index < 0 )
+	 || ( lane_index >= scheduler->number_of_lanes ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid lane index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	lane = &( scheduler->lanes[ lane_index ] );
+
+	if( lane->message_index == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid lane: %d - missing message.",
+		 function,
+		 lane_index );
+
+		return( -1 );
+	}
+	for( hash_values_index = 0;
+	     hash_values_index < 5;
+	     hash_values_index++ )
+	{
+		scheduler->hash_values[ hash_values_index ] = scheduler->lanes_hash_values[ ( hash_values_index * scheduler->number_of_lanes ) + lane_index ];
+	}
+	if( lane->number_of_blocks > 0 )
+	{
+		if( scheduler->single_stream_transform_function(
+		     scheduler->hash_values,
+		     lane->buffer,
+		     lane->number_of_blocks ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to transform blocks.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( lane->is_final == 0 )
+	{
+		if( scheduler->single_stream_transform_function(
+		     scheduler->hash_values,
+		     lane->final_blocks,
+		     lane->number_of_final_blocks ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to transform final blocks.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	for( hash_values_index = 0;
+	     hash_values_index < 5;
+	     hash_values_index++ )
+	{
+		scheduler->lanes_hash_values[ ( hash_values_index * scheduler->number_of_lanes ) + lane_index ] = scheduler->hash_values[ hash_values_index ];
+	}
+	lane->buffer           = lane->final_blocks;
+	lane->number_of_blocks = 0;
+	lane->is_final         = 1;
+
+	return( 1 );
+}
+
+/* Retrieves the hash of the complete message of a lane and empties the lane
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_sha1_multi_buffer_scheduler_get_lane_hash(
+     libhmac_sha1_multi_buffer_scheduler_t *scheduler,
+     int lane_index,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libhmac_sha1_multi_buffer_scheduler_get_lane_hash";
+	int hash_values_index = 0;
+
+	if( scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( libhmac_sha1_multi_buffer_scheduler_lane_is_complete(
+	     scheduler,
+	     lane_index ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid lane: %d - message is not complete.",
+		 function,
+		 lane_index );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_size < (size_t) LIBHMAC_SHA1_HASH_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid hash value too small.",
+		 function );
+
+		return( -1 );
+	}
+	for( hash_values_index = 0;
+	     hash_values_index < 5;
+	     hash_values_index++ )
+	{
+		byte_stream_copy_from_uint32_big_endian(
+		 &( hash[ hash_values_index * 4 ] ),
+		 scheduler->lanes_hash_values[ ( hash_values_index * scheduler->number_of_lanes ) + lane_index ] );
+	}
+	scheduler->lanes[ lane_index ].message_index = -1;
+
+	scheduler->number_of_active_lanes -= 1;
+
+	return( 1 );
+}
+
+/* Calculates the SHA-1 of multiple independent messages using a multi-buffer kernel,
+ * continuing from the hash values
+ * The prefix size is the number of bytes already hashed into the hash values,
+ * which must be a multiple of the block size
+ * Every lane of the kernel transforms the blocks of one message, when the message of a lane
+ * is complete the next message is assigned to the lane, so messages of different sizes
+ * are balanced over the lanes
+ * The hashes are stored consecutively in the order of the buffers
+ * Returns 1 if successful, 0 if the multi-buffer kernel is not available or not faster for the messages or -1 on error
+ */
+int libhmac_sha1_multi_buffer_calculate_with_state(
+     const uint8_t **buffers,
+     const size_t *sizes,
+     int number_of_buffers,
+     const uint32_t *hash_values,
+     uint64_t prefix_size,
+     uint8_t *hashes,
+     libcerror_error_t **error )
+{
+	libhmac_sha1_multi_buffer_scheduler_t scheduler;
+
+	static char *function  = "libhmac_sha1_multi_buffer_calculate_with_state";
+	int lane_index         = 0;
+	int lane_message_index = 0;
+	int message_index      = 0;
+	int result             = 0;
+
+	if( buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffers.",
+		 function );
+
+		return( -1 );
+	}
+	if( sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_buffers < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of buffers value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash values.",
+		 function );
+
+		return( -1 );
+	}
+	if( hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hashes.",
+		 function );
+
+		return( -1 );
+	}
+	result = libhmac_sha1_multi_buffer_scheduler_initialize(
+	          &scheduler,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	else if( ( result == 0 )
+	      || ( number_of_buffers < scheduler.minimum_number_of_active_lanes ) )
+	{
+		return( 0 );
+	}
+	while( ( scheduler.number_of_active_lanes > 0 )
+	    || ( message_index < number_of_buffers ) )
+	{
+		/* Assign the next messages to the empty lanes
+		 */
+		for( lane_index = 0;
+		     lane_index < scheduler.number_of_lanes;
+		     lane_index++ )
+		{
+			if( message_index >= number_of_buffers )
+			{
+				break;
+			}
+			if( scheduler.lanes[ lane_index ].message_index != -1 )
+			{
+				continue;
+			}
+			if( libhmac_sha1_multi_buffer_scheduler_set_lane_message_with_state(
+			     &scheduler,
+			     lane_index,
+			     message_index,
+			     buffers[ message_index ],
+			     sizes[ message_index ],
+			     hash_values,
+			     prefix_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set message: %d in lane: %d.",
+				 function,
+				 message_index,
+				 lane_index );
+
+				goto on_error;
+			}
+			message_index++;
+		}
+		/* When the remaining messages occupy too few lanes the single-stream kernel
+		 * is faster, hence the remaining blocks are transformed one message at a time
+		 */
+		if( ( message_index >= number_of_buffers )
+		 && ( scheduler.number_of_active_lanes < scheduler.minimum_number_of_active_lanes ) )
+		{
+			for( lane_index = 0;
+			     lane_index < scheduler.number_of_lanes;
+			     lane_index++ )
+			{
+				if( scheduler.lanes[ lane_index ].message_index == -1 )
+				{
+					continue;
+				}
+				if( libhmac_sha1_multi_buffer_scheduler_transform_lane(
+				     &scheduler,
+				     lane_index,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to transform lane: %d.",
+					 function,
+					 lane_index );
+
+					goto on_error;
+				}
+			}
+		}
+		else if( libhmac_sha1_multi_buffer_scheduler_transform(
+		          &scheduler,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to transform lanes.",
+			 function );
+
+			goto on_error;
+		}
+		for( lane_index = 0;
+		     lane_index < scheduler.number_of_lanes;
+		     lane_index++ )
+		{
+			if( libhmac_sha1_multi_buffer_scheduler_lane_is_complete(
+			     &scheduler,
+			     lane_index ) == 0 )
+			{
+				continue;
+			}
+			lane_message_index = scheduler.lanes[ lane_index ].message_index;
+
+			if( libhmac_sha1_multi_buffer_scheduler_get_lane_hash(
+			     &scheduler,
+			     lane_index,
+			     &( hashes[ lane_message_index * LIBHMAC_SHA1_HASH_SIZE ] ),
+			     LIBHMAC_SHA1_HASH_SIZE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve hash of lane: %d.",
+				 function,
+				 lane_index );
+
+				goto on_error;
+			}
+		}
+	}
+	if( libhmac_sha1_multi_buffer_scheduler_clear(
+	     &scheduler,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear scheduler.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libhmac_sha1_multi_buffer_scheduler_clear(
+	 &scheduler,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Calculates the SHA-1 of multiple independent messages using a multi-buffer kernel
+ * Every lane of the kernel transforms the blocks of one message, when the message of a lane
+ * is complete the next message is assigned to the lane, so messages of different sizes
+ * are balanced over the lanes
+ * The hashes are stored consecutively in the order of the buffers
+ * Returns 1 if successful, 0 if the multi-buffer kernel is not available or not faster for the messages or -1 on error
+ */
+int libhmac_sha1_multi_buffer_calculate(
+     const uint8_t **buffers,
+     const size_t *sizes,
+     int number_of_buffers,
+     uint8_t *hashes,
+     libcerror_error_t **error )
+{
+	static char *function = "libhmac_sha1_multi_buffer_calculate";
+	int result            = 0;
+
+	result = libhmac_sha1_multi_buffer_calculate_with_state(
+	          buffers,
+	          sizes,
+	          number_of_buffers,
+	          libhmac_sha1_multi_buffer_initial_hash_values,
+	          0,
+	          hashes,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate hashes.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+#endif /* !defined( LIBHMAC_HAVE_SHA1_SUPPORT ) */
+
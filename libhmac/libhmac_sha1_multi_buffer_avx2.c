@@ -0,0 +1,277 @@
+/*
+ * SHA-1 AVX2 multi-buffer kernel functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libhmac_cpu.h"
+#include "libhmac_sha1_multi_buffer_avx2.h"
+
+#if defined( LIBHMAC_HAVE_X86_KERNELS )
+
+#include <immintrin.h>
+
+/* Rotates the 8 x 32-bit values to the left, AVX2 has no 32-bit vector rotate
+ */
+#define libhmac_sha1_multi_buffer_avx2_rotate_left( values, number_of_bits ) \
+	_mm256_or_si256( \
+	 _mm256_slli_epi32( values, number_of_bits ), \
+	 _mm256_srli_epi32( values, 32 - number_of_bits ) )
+
+/* The round functions, Ch for rounds 0 to 19, parity for rounds 20 to 39 and 60 to 79
+ * and Maj for rounds 40 to 59
+ */
+#define libhmac_sha1_multi_buffer_avx2_choose( values1, values2, values3 ) \
+	_mm256_xor_si256( \
+	 values3, \
+	 _mm256_and_si256( \
+	  values1, \
+	  _mm256_xor_si256( values2, values3 ) ) )
+
+#define libhmac_sha1_multi_buffer_avx2_parity( values1, values2, values3 ) \
+	_mm256_xor_si256( \
+	 _mm256_xor_si256( values1, values2 ), \
+	 values3 )
+
+#define libhmac_sha1_multi_buffer_avx2_majority( values1, values2, values3 ) \
+	_mm256_or_si256( \
+	 _mm256_and_si256( values1, values2 ), \
+	 _mm256_and_si256( \
+	  values3, \
+	  _mm256_or_si256( values1, values2 ) ) )
+
+/* Retrieves the message value W[t] of the 8 lanes, where the 16 x 32-bit message values
+ * are used as a circular buffer containing W[t-16..t-1] and W[t] is extended from round 16
+ */
+#define libhmac_sha1_multi_buffer_avx2_get_message_value( message_values, round_index ) \
+	( ( ( round_index ) < 16 ) ? message_values[ ( round_index ) & 15 ] : \
+	 ( message_values[ ( round_index ) & 15 ] = libhmac_sha1_multi_buffer_avx2_rotate_left( \
+	    _mm256_xor_si256( \
+	     _mm256_xor_si256( \
+	      message_values[ ( ( round_index ) - 3 ) & 15 ], \
+	      message_values[ ( ( round_index ) - 8 ) & 15 ] ), \
+	     _mm256_xor_si256( \
+	      message_values[ ( ( round_index ) - 14 ) & 15 ], \
+	      message_values[ ( round_index ) & 15 ] ) ), \
+	    1 ) ) )
+
+/* Calculates a round of the 8 lanes
+ */
+#define libhmac_sha1_multi_buffer_avx2_calculate_hash_value( round_function, message_values, round_index, round_constant, hash_values, hash_value_index0, hash_value_index1, hash_value_index2, hash_value_index3, hash_value_index4 ) \
+	hash_values[ hash_value_index4 ] = _mm256_add_epi32( \
+	 _mm256_add_epi32( \
+	  hash_values[ hash_value_index4 ], \
+	  libhmac_sha1_multi_buffer_avx2_rotate_left( hash_values[ hash_value_index0 ], 5 ) ), \
+	 _mm256_add_epi32( \
+	  round_function( hash_values[ hash_value_index1 ], hash_values[ hash_value_index2 ], hash_values[ hash_value_index3 ] ), \
+	  _mm256_add_epi32( \
+	   libhmac_sha1_multi_buffer_avx2_get_message_value( message_values, round_index ), \
+	   round_constant ) ) ); \
+	hash_values[ hash_value_index1 ] = libhmac_sha1_multi_buffer_avx2_rotate_left( hash_values[ hash_value_index1 ], 30 );
+
+/* Calculates 5 rounds of the 8 lanes
+ */
+#define libhmac_sha1_multi_buffer_avx2_calculate_hash_values( round_function, message_values, round_index, round_constant, hash_values ) \
+	libhmac_sha1_multi_buffer_avx2_calculate_hash_value( round_function, message_values, ( round_index ) + 0, round_constant, hash_values, 0, 1, 2, 3, 4 ) \
+	libhmac_sha1_multi_buffer_avx2_calculate_hash_value( round_function, message_values, ( round_index ) + 1, round_constant, hash_values, 4, 0, 1, 2, 3 ) \
+	libhmac_sha1_multi_buffer_avx2_calculate_hash_value( round_function, message_values, ( round_index ) + 2, round_constant, hash_values, 3, 4, 0, 1, 2 ) \
+	libhmac_sha1_multi_buffer_avx2_calculate_hash_value( round_function, message_values, ( round_index ) + 3, round_constant, hash_values, 2, 3, 4, 0, 1 ) \
+	libhmac_sha1_multi_buffer_avx2_calculate_hash_value( round_function, message_values, ( round_index ) + 4, round_constant, hash_values, 1, 2, 3, 4, 0 )
+
+/* Calculates the SHA-1 of 64 byte sized blocks of data of 8 independent messages at the same time
+ * Every lane of the 256-bit registers contains the values of one message
+ * lanes_hash_values contains the 8 x 32-bit hash values per word, hash value 0 of the 8 lanes
+ * followed by hash value 1 of the 8 lanes, etc.
+ * lanes_buffer contains a pointer to the blocks of data of every lane
+ * This kernel requires the AVX and AVX2 extensions
+ * Returns 1 if successful or -1 on error
+ */
+LIBHMAC_X86_TARGET( "avx,avx2" ) \
+int libhmac_sha1_multi_buffer_avx2_transform(
+     uint32_t *lanes_hash_values,
+     const uint8_t **lanes_buffer,
+     size_t number_of_blocks )
+{
+	__m256i hash_values[ 5 ];
+	__m256i lane_values[ 8 ];
+	__m256i message_values[ 16 ];
+	__m256i previous_hash_values[ 5 ];
+	__m256i temporary_values[ 8 ];
+
+	__m256i byte_order_mask;
+	__m256i round_constant;
+
+	size_t buffer_offset = 0;
+	int lane_index       = 0;
+	int round_index      = 0;
+	int values_index     = 0;
+
+	byte_order_mask = _mm256_set_epi64x(
+	                   0x0c0d0e0f08090a0bULL,
+	                   0x0405060700010203ULL,
+	                   0x0c0d0e0f08090a0bULL,
+	                   0x0405060700010203ULL );
+
+	for( values_index = 0;
+	     values_index < 5;
+	     values_index++ )
+	{
+		hash_values[ values_index ] = _mm256_loadu_si256(
+		                               (const __m256i *) &( lanes_hash_values[ values_index * 8 ] ) );
+	}
+	while( number_of_blocks > 0 )
+	{
+		/* Break the blocks into 16 x 32-bit values per lane by transposing 2 times 8 x 8 x 32-bit values
+		 */
+		for( values_index = 0;
+		     values_index < 16;
+		     values_index += 8 )
+		{
+			for( lane_index = 0;
+			     lane_index < 8;
+			     lane_index++ )
+			{
+				lane_values[ lane_index ] = _mm256_loadu_si256(
+				                             (const __m256i *) &( ( lanes_buffer[ lane_index ] )[ buffer_offset + ( values_index * 4 ) ] ) );
+			}
+			temporary_values[ 0 ] = _mm256_unpacklo_epi32( lane_values[ 0 ], lane_values[ 1 ] );
+			temporary_values[ 1 ] = _mm256_unpackhi_epi32( lane_values[ 0 ], lane_values[ 1 ] );
+			temporary_values[ 2 ] = _mm256_unpacklo_epi32( lane_values[ 2 ], lane_values[ 3 ] );
+			temporary_values[ 3 ] = _mm256_unpackhi_epi32( lane_values[ 2 ], lane_values[ 3 ] );
+			temporary_values[ 4 ] = _mm256_unpacklo_epi32( lane_values[ 4 ], lane_values[ 5 ] );
+			temporary_values[ 5 ] = _mm256_unpackhi_epi32( lane_values[ 4 ], lane_values[ 5 ] );
+			temporary_values[ 6 ] = _mm256_unpacklo_epi32( lane_values[ 6 ], lane_values[ 7 ] );
+			temporary_values[ 7 ] = _mm256_unpackhi_epi32( lane_values[ 6 ], lane_values[ 7 ] );
+
+			lane_values[ 0 ] = _mm256_unpacklo_epi64( temporary_values[ 0 ], temporary_values[ 2 ] );
+			lane_values[ 1 ] = _mm256_unpackhi_epi64( temporary_values[ 0 ], temporary_values[ 2 ] );
+			lane_values[ 2 ] = _mm256_unpacklo_epi64( temporary_values[ 1 ], temporary_values[ 3 ] );
+			lane_values[ 3 ] = _mm256_unpackhi_epi64( temporary_values[ 1 ], temporary_values[ 3 ] );
+			lane_values[ 4 ] = _mm256_unpacklo_epi64( temporary_values[ 4 ], temporary_values[ 6 ] );
+			lane_values[ 5 ] = _mm256_unpackhi_epi64( temporary_values[ 4 ], temporary_values[ 6 ] );
+			lane_values[ 6 ] = _mm256_unpacklo_epi64( temporary_values[ 5 ], temporary_values[ 7 ] );
+			lane_values[ 7 ] = _mm256_unpackhi_epi64( temporary_values[ 5 ], temporary_values[ 7 ] );
+
+			message_values[ values_index + 0 ] = _mm256_permute2x128_si256( lane_values[ 0 ], lane_values[ 4 ], 0x20 );
+			message_values[ values_index + 1 ] = _mm256_permute2x128_si256( lane_values[ 1 ], lane_values[ 5 ], 0x20 );
+			message_values[ values_index + 2 ] = _mm256_permute2x128_si256( lane_values[ 2 ], lane_values[ 6 ], 0x20 );
+			message_values[ values_index + 3 ] = _mm256_permute2x128_si256( lane_values[ 3 ], lane_values[ 7 ], 0x20 );
+			message_values[ values_index + 4 ] = _mm256_permute2x128_si256( lane_values[ 0 ], lane_values[ 4 ], 0x31 );
+			message_values[ values_index + 5 ] = _mm256_permute2x128_si256( lane_values[ 1 ], lane_values[ 5 ], 0x31 );
+			message_values[ values_index + 6 ] = _mm256_permute2x128_si256( lane_values[ 2 ], lane_values[ 6 ], 0x31 );
+			message_values[ values_index + 7 ] = _mm256_permute2x128_si256( lane_values[ 3 ], lane_values[ 7 ], 0x31 );
+		}
+		for( values_index = 0;
+		     values_index < 16;
+		     values_index++ )
+		{
+			message_values[ values_index ] = _mm256_shuffle_epi8(
+			                                  message_values[ values_index ],
+			                                  byte_order_mask );
+		}
+		for( values_index = 0;
+		     values_index < 5;
+		     values_index++ )
+		{
+			previous_hash_values[ values_index ] = hash_values[ values_index ];
+		}
+		/* Calculate the hash values while extending to 80 x 32-bit values from round 16
+		 */
+		round_constant = _mm256_set1_epi32( (int) 0x5a827999UL );
+
+		for( round_index = 0;
+		     round_index < 20;
+		     round_index += 5 )
+		{
+			libhmac_sha1_multi_buffer_avx2_calculate_hash_values( libhmac_sha1_multi_buffer_avx2_choose, message_values, round_index, round_constant, hash_values )
+		}
+		round_constant = _mm256_set1_epi32( (int) 0x6ed9eba1UL );
+
+		for( round_index = 20;
+		     round_index < 40;
+		     round_index += 5 )
+		{
+			libhmac_sha1_multi_buffer_avx2_calculate_hash_values( libhmac_sha1_multi_buffer_avx2_parity, message_values, round_index, round_constant, hash_values )
+		}
+		round_constant = _mm256_set1_epi32( (int) 0x8f1bbcdcUL );
+
+		for( round_index = 40;
+		     round_index < 60;
+		     round_index += 5 )
+		{
+			libhmac_sha1_multi_buffer_avx2_calculate_hash_values( libhmac_sha1_multi_buffer_avx2_majority, message_values, round_index, round_constant, hash_values )
+		}
+		round_constant = _mm256_set1_epi32( (int) 0xca62c1d6UL );
+
+		for( round_index = 60;
+		     round_index < 80;
+		     round_index += 5 )
+		{
+			libhmac_sha1_multi_buffer_avx2_calculate_hash_values( libhmac_sha1_multi_buffer_avx2_parity, message_values, round_index, round_constant, hash_values )
+		}
+		for( values_index = 0;
+		     values_index < 5;
+		     values_index++ )
+		{
+			hash_values[ values_index ] = _mm256_add_epi32(
+			                               hash_values[ values_index ],
+			                               previous_hash_values[ values_index ] );
+		}
+		buffer_offset    += 64;
+		number_of_blocks -= 1;
+	}
+	for( values_index = 0;
+	     values_index < 5;
+	     values_index++ )
+	{
+		_mm256_storeu_si256(
+		 (__m256i *) &( lanes_hash_values[ values_index * 8 ] ),
+		 hash_values[ values_index ] );
+	}
+	/* Prevent sensitive data from leaking
+	 */
+	if( memory_set(
+	     message_values,
+	     0,
+	     sizeof( __m256i ) * 16 ) == NULL )
+	{
+		return( -1 );
+	}
+	if( memory_set(
+	     lane_values,
+	     0,
+	     sizeof( __m256i ) * 8 ) == NULL )
+	{
+		return( -1 );
+	}
+	if( memory_set(
+	     temporary_values,
+	     0,
+	     sizeof( __m256i ) * 8 ) == NULL )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( LIBHMAC_HAVE_X86_KERNELS ) */
+
@@ -0,0 +1,207 @@
+/*
+ * SHA-1 SHA-NI kernel functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libhmac_cpu.h"
+#include "libhmac_sha1_sha_ni.h"
+
+#if defined( LIBHMAC_HAVE_X86_KERNELS )
+
+#include <immintrin.h>
+
+/* Calculates the first 4 rounds, sha1rnds4 calculates 4 rounds using the round function and constant selected by function
+ */
+#define libhmac_sha1_sha_ni_calculate_first_rounds( state_abcd, state_e_next, state_e, message_values ) \
+	state_e      = _mm_add_epi32( state_e, message_values ); \
+	state_e_next = state_abcd; \
+	state_abcd   = _mm_sha1rnds4_epu32( state_abcd, state_e, 0 );
+
+/* Calculates 4 rounds, sha1nexte calculates the value of E after 4 rounds and adds the message values
+ */
+#define libhmac_sha1_sha_ni_calculate_rounds( state_abcd, state_e_next, state_e, message_values, function ) \
+	state_e      = _mm_sha1nexte_epu32( state_e, message_values ); \
+	state_e_next = state_abcd; \
+	state_abcd   = _mm_sha1rnds4_epu32( state_abcd, state_e, function );
+
+/* Calculates the first part of the extension of the message values
+ */
+#define libhmac_sha1_sha_ni_extend_message_values1( message_values_previous, message_values_current ) \
+	message_values_previous = _mm_sha1msg1_epu32( message_values_previous, message_values_current );
+
+/* Calculates the second part of the extension of the message values
+ */
+#define libhmac_sha1_sha_ni_extend_message_values2( message_values_next, message_values_current ) \
+	message_values_next = _mm_sha1msg2_epu32( message_values_next, message_values_current );
+
+/* Calculates the SHA1 of 64 byte sized blocks of data in a buffer
+ * This kernel requires the SHA, SSSE3 and SSE4.1 extensions
+ * Returns 1 if successful or -1 on error
+ */
+LIBHMAC_X86_TARGET( "sse2,ssse3,sse4.1,sha" ) \
+int libhmac_sha1_sha_ni_transform(
+     uint32_t *hash_values,
+     const uint8_t *buffer,
+     size_t number_of_blocks )
+{
+	__m128i byte_order_mask;
+	__m128i message_values0;
+	__m128i message_values1;
+	__m128i message_values2;
+	__m128i message_values3;
+	__m128i previous_state_abcd;
+	__m128i previous_state_e;
+	__m128i state_abcd;
+	__m128i state_e0;
+	__m128i state_e1;
+
+	byte_order_mask = _mm_set_epi64x(
+	                   0x0001020304050607ULL,
+	                   0x08090a0b0c0d0e0fULL );
+
+	/* The SHA instructions expect the state as DCBA and E in the upper 32-bits
+	 */
+	state_abcd = _mm_loadu_si128( (const __m128i *) &( hash_values[ 0 ] ) );
+	state_abcd = _mm_shuffle_epi32( state_abcd, 0x1b );
+	state_e0   = _mm_set_epi32( (int) hash_values[ 4 ], 0, 0, 0 );
+
+	while( number_of_blocks > 0 )
+	{
+		previous_state_abcd = state_abcd;
+		previous_state_e    = state_e0;
+
+		/* Break the block into 16 x 32-bit values
+		 */
+		message_values0 = _mm_shuffle_epi8( _mm_loadu_si128( (const __m128i *) &( buffer[ 0 ] ) ), byte_order_mask );
+		message_values1 = _mm_shuffle_epi8( _mm_loadu_si128( (const __m128i *) &( buffer[ 16 ] ) ), byte_order_mask );
+		message_values2 = _mm_shuffle_epi8( _mm_loadu_si128( (const __m128i *) &( buffer[ 32 ] ) ), byte_order_mask );
+		message_values3 = _mm_shuffle_epi8( _mm_loadu_si128( (const __m128i *) &( buffer[ 48 ] ) ), byte_order_mask );
+
+		/* Calculate the hash values while extending to 80 x 32-bit values
+		 */
+		libhmac_sha1_sha_ni_calculate_first_rounds( state_abcd, state_e1, state_e0, message_values0 )
+
+		libhmac_sha1_sha_ni_calculate_rounds( state_abcd, state_e0, state_e1, message_values1, 0 )
+		libhmac_sha1_sha_ni_extend_message_values1( message_values0, message_values1 )
+
+		libhmac_sha1_sha_ni_calculate_rounds( state_abcd, state_e1, state_e0, message_values2, 0 )
+		libhmac_sha1_sha_ni_extend_message_values1( message_values1, message_values2 )
+		message_values0 = _mm_xor_si128( message_values0, message_values2 );
+
+		libhmac_sha1_sha_ni_calculate_rounds( state_abcd, state_e0, state_e1, message_values3, 0 )
+		libhmac_sha1_sha_ni_extend_message_values2( message_values0, message_values3 )
+		libhmac_sha1_sha_ni_extend_message_values1( message_values2, message_values3 )
+		message_values1 = _mm_xor_si128( message_values1, message_values3 );
+
+		libhmac_sha1_sha_ni_calculate_rounds( state_abcd, state_e1, state_e0, message_values0, 0 )
+		libhmac_sha1_sha_ni_extend_message_values2( message_values1, message_values0 )
+		libhmac_sha1_sha_ni_extend_message_values1( message_values3, message_values0 )
+		message_values2 = _mm_xor_si128( message_values2, message_values0 );
+
+		libhmac_sha1_sha_ni_calculate_rounds( state_abcd, state_e0, state_e1, message_values1, 1 )
+		libhmac_sha1_sha_ni_extend_message_values2( message_values2, message_values1 )
+		libhmac_sha1_sha_ni_extend_message_values1( message_values0, message_values1 )
+		message_values3 = _mm_xor_si128( message_values3, message_values1 );
+
+		libhmac_sha1_sha_ni_calculate_rounds( state_abcd, state_e1, state_e0, message_values2, 1 )
+		libhmac_sha1_sha_ni_extend_message_values2( message_values3, message_values2 )
+		libhmac_sha1_sha_ni_extend_message_values1( message_values1, message_values2 )
+		message_values0 = _mm_xor_si128( message_values0, message_values2 );
+
+		libhmac_sha1_sha_ni_calculate_rounds( state_abcd, state_e0, state_e1, message_values3, 1 )
+		libhmac_sha1_sha_ni_extend_message_values2( message_values0, message_values3 )
+		libhmac_sha1_sha_ni_extend_message_values1( message_values2, message_values3 )
+		message_values1 = _mm_xor_si128( message_values1, message_values3 );
+
+		libhmac_sha1_sha_ni_calculate_rounds( state_abcd, state_e1, state_e0, message_values0, 1 )
+		libhmac_sha1_sha_ni_extend_message_values2( message_values1, message_values0 )
+		libhmac_sha1_sha_ni_extend_message_values1( message_values3, message_values0 )
+		message_values2 = _mm_xor_si128( message_values2, message_values0 );
+
+		libhmac_sha1_sha_ni_calculate_rounds( state_abcd, state_e0, state_e1, message_values1, 1 )
+		libhmac_sha1_sha_ni_extend_message_values2( message_values2, message_values1 )
+		libhmac_sha1_sha_ni_extend_message_values1( message_values0, message_values1 )
+		message_values3 = _mm_xor_si128( message_values3, message_values1 );
+
+		libhmac_sha1_sha_ni_calculate_rounds( state_abcd, state_e1, state_e0, message_values2, 2 )
+		libhmac_sha1_sha_ni_extend_message_values2( message_values3, message_values2 )
+		libhmac_sha1_sha_ni_extend_message_values1( message_values1, message_values2 )
+		message_values0 = _mm_xor_si128( message_values0, message_values2 );
+
+		libhmac_sha1_sha_ni_calculate_rounds( state_abcd, state_e0, state_e1, message_values3, 2 )
+		libhmac_sha1_sha_ni_extend_message_values2( message_values0, message_values3 )
+		libhmac_sha1_sha_ni_extend_message_values1( message_values2, message_values3 )
+		message_values1 = _mm_xor_si128( message_values1, message_values3 );
+
+		libhmac_sha1_sha_ni_calculate_rounds( state_abcd, state_e1, state_e0, message_values0, 2 )
+		libhmac_sha1_sha_ni_extend_message_values2( message_values1, message_values0 )
+		libhmac_sha1_sha_ni_extend_message_values1( message_values3, message_values0 )
+		message_values2 = _mm_xor_si128( message_values2, message_values0 );
+
+		libhmac_sha1_sha_ni_calculate_rounds( state_abcd, state_e0, state_e1, message_values1, 2 )
+		libhmac_sha1_sha_ni_extend_message_values2( message_values2, message_values1 )
+		libhmac_sha1_sha_ni_extend_message_values1( message_values0, message_values1 )
+		message_values3 = _mm_xor_si128( message_values3, message_values1 );
+
+		libhmac_sha1_sha_ni_calculate_rounds( state_abcd, state_e1, state_e0, message_values2, 2 )
+		libhmac_sha1_sha_ni_extend_message_values2( message_values3, message_values2 )
+		libhmac_sha1_sha_ni_extend_message_values1( message_values1, message_values2 )
+		message_values0 = _mm_xor_si128( message_values0, message_values2 );
+
+		libhmac_sha1_sha_ni_calculate_rounds( state_abcd, state_e0, state_e1, message_values3, 3 )
+		libhmac_sha1_sha_ni_extend_message_values2( message_values0, message_values3 )
+		libhmac_sha1_sha_ni_extend_message_values1( message_values2, message_values3 )
+		message_values1 = _mm_xor_si128( message_values1, message_values3 );
+
+		libhmac_sha1_sha_ni_calculate_rounds( state_abcd, state_e1, state_e0, message_values0, 3 )
+		libhmac_sha1_sha_ni_extend_message_values2( message_values1, message_values0 )
+		libhmac_sha1_sha_ni_extend_message_values1( message_values3, message_values0 )
+		message_values2 = _mm_xor_si128( message_values2, message_values0 );
+
+		libhmac_sha1_sha_ni_calculate_rounds( state_abcd, state_e0, state_e1, message_values1, 3 )
+		libhmac_sha1_sha_ni_extend_message_values2( message_values2, message_values1 )
+		message_values3 = _mm_xor_si128( message_values3, message_values1 );
+
+		libhmac_sha1_sha_ni_calculate_rounds( state_abcd, state_e1, state_e0, message_values2, 3 )
+		libhmac_sha1_sha_ni_extend_message_values2( message_values3, message_values2 )
+
+		libhmac_sha1_sha_ni_calculate_rounds( state_abcd, state_e0, state_e1, message_values3, 3 )
+
+		/* Update the hash values
+		 */
+		state_e0   = _mm_sha1nexte_epu32( state_e0, previous_state_e );
+		state_abcd = _mm_add_epi32( state_abcd, previous_state_abcd );
+
+		buffer           += 64;
+		number_of_blocks -= 1;
+	}
+	state_abcd = _mm_shuffle_epi32( state_abcd, 0x1b );
+
+	_mm_storeu_si128( (__m128i *) &( hash_values[ 0 ] ), state_abcd );
+
+	hash_values[ 4 ] = (uint32_t) _mm_extract_epi32( state_e0, 3 );
+
+	return( 1 );
+}
+
+#endif /* defined( LIBHMAC_HAVE_X86_KERNELS ) */
+
@@ -0,0 +1,366 @@
+/*
+ * SHA-1 SSSE3 kernel functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libhmac_cpu.h"
+#include "libhmac_sha1_ssse3.h"
+
+#if defined( LIBHMAC_HAVE_X86_KERNELS )
+
+#include <immintrin.h>
+
+/* Rotates the 32-bit values to the left
+ */
+#define libhmac_sha1_ssse3_rotate_left( values, number_of_bits ) \
+	_mm_or_si128( \
+	 _mm_slli_epi32( values, number_of_bits ), \
+	 _mm_srli_epi32( values, 32 - number_of_bits ) )
+
+/* Extends the message values with the next 4 x 32-bit values for W[16..31]
+ * W[t] = ( W[t-3] ^ W[t-8] ^ W[t-14] ^ W[t-16] ) <<< 1
+ * W[t+3] depends on W[t] hence it is corrected after the other values are calculated
+ */
+#define libhmac_sha1_ssse3_extend_message_values_first( message_values, message_values_minus4, message_values_minus8, message_values_minus12, message_values_minus16, temporary1, temporary2 ) \
+	temporary1     = _mm_srli_si128( message_values_minus4, 4 ); \
+	temporary1     = _mm_xor_si128( temporary1, message_values_minus8 ); \
+	temporary2     = _mm_alignr_epi8( message_values_minus12, message_values_minus16, 8 ); \
+	temporary1     = _mm_xor_si128( temporary1, temporary2 ); \
+	temporary1     = _mm_xor_si128( temporary1, message_values_minus16 ); \
+	temporary1     = libhmac_sha1_ssse3_rotate_left( temporary1, 1 ); \
+	temporary2     = _mm_slli_si128( temporary1, 12 ); \
+	message_values = _mm_xor_si128( temporary1, libhmac_sha1_ssse3_rotate_left( temporary2, 1 ) );
+
+/* Extends the message values with the next 4 x 32-bit values for W[32..79]
+ * W[t] = ( W[t-6] ^ W[t-16] ^ W[t-28] ^ W[t-32] ) <<< 2
+ * which has no dependencies between the 4 values
+ * message_values contains W[t-32..t-29] and is overwritten with W[t..t+3]
+ */
+#define libhmac_sha1_ssse3_extend_message_values( message_values, message_values_minus4, message_values_minus8, message_values_minus16, message_values_minus28, temporary1 ) \
+	temporary1     = _mm_alignr_epi8( message_values_minus4, message_values_minus8, 8 ); \
+	temporary1     = _mm_xor_si128( temporary1, message_values_minus16 ); \
+	temporary1     = _mm_xor_si128( temporary1, message_values_minus28 ); \
+	temporary1     = _mm_xor_si128( temporary1, message_values ); \
+	message_values = libhmac_sha1_ssse3_rotate_left( temporary1, 2 );
+
+/* Stores the 4 x 32-bit message values with the round constant added
+ */
+#define libhmac_sha1_ssse3_store_message_values_plus_k( message_values_plus_k, value_index, message_values, round_constant ) \
+	_mm_storeu_si128( \
+	 (__m128i *) &( message_values_plus_k[ value_index ] ), \
+	 _mm_add_epi32( message_values, round_constant ) );
+
+#define libhmac_sha1_ssse3_calculate_hash_value_choice( message_values_plus_k, value_index, hash_values, hash_value_index0, hash_value_index1, hash_value_index2, hash_value_index3, hash_value_index4 ) \
+	hash_values[ hash_value_index4 ] += ( ( hash_values[ hash_value_index2 ] ^ hash_values[ hash_value_index3 ] ) & hash_values[ hash_value_index1 ] ) \
+	                                  ^ hash_values[ hash_value_index3 ]; \
+	hash_values[ hash_value_index4 ] += byte_stream_bit_rotate_left_32bit( \
+	                                     hash_values[ hash_value_index0 ], \
+	                                     5 ); \
+	hash_values[ hash_value_index4 ] += message_values_plus_k[ value_index ]; \
+\
+	hash_values[ hash_value_index1 ] = byte_stream_bit_rotate_left_32bit( \
+	                                    hash_values[ hash_value_index1 ], \
+	                                    30 );
+
+#define libhmac_sha1_ssse3_calculate_hash_value_parity( message_values_plus_k, value_index, hash_values, hash_value_index0, hash_value_index1, hash_value_index2, hash_value_index3, hash_value_index4 ) \
+	hash_values[ hash_value_index4 ] += hash_values[ hash_value_index1 ] \
+	                                  ^ hash_values[ hash_value_index2 ] \
+	                                  ^ hash_values[ hash_value_index3 ]; \
+	hash_values[ hash_value_index4 ] += byte_stream_bit_rotate_left_32bit( \
+	                                     hash_values[ hash_value_index0 ], \
+	                                     5 ); \
+	hash_values[ hash_value_index4 ] += message_values_plus_k[ value_index ]; \
+\
+	hash_values[ hash_value_index1 ] = byte_stream_bit_rotate_left_32bit( \
+	                                    hash_values[ hash_value_index1 ], \
+	                                    30 );
+
+#define libhmac_sha1_ssse3_calculate_hash_value_majority( message_values_plus_k, value_index, hash_values, hash_value_index0, hash_value_index1, hash_value_index2, hash_value_index3, hash_value_index4 ) \
+	hash_values[ hash_value_index4 ] += ( ( hash_values[ hash_value_index1 ] | hash_values[ hash_value_index2 ] ) & hash_values[ hash_value_index3 ] ) \
+	                                  | ( hash_values[ hash_value_index1 ] & hash_values[ hash_value_index2 ] ); \
+	hash_values[ hash_value_index4 ] += byte_stream_bit_rotate_left_32bit( \
+	                                     hash_values[ hash_value_index0 ], \
+	                                     5 ); \
+	hash_values[ hash_value_index4 ] += message_values_plus_k[ value_index ]; \
+\
+	hash_values[ hash_value_index1 ] = byte_stream_bit_rotate_left_32bit( \
+	                                    hash_values[ hash_value_index1 ], \
+	                                    30 );
+
+/* Calculates the SHA1 of 64 byte sized blocks of data in a buffer
+ * The message schedule is calculated 4 x 32-bit values at a time with SSSE3
+ * and interleaved with the rounds of the preceding values
+ * This kernel requires the SSSE3 extensions
+ * Returns 1 if successful or -1 on error
+ */
+LIBHMAC_X86_TARGET( "sse2,ssse3" ) \
+int libhmac_sha1_ssse3_transform(
+     uint32_t *context_hash_values,
+     const uint8_t *buffer,
+     size_t number_of_blocks )
+{
+	uint32_t hash_values[ 5 ];
+	uint32_t message_values_plus_k[ 80 ];
+
+	__m128i byte_order_mask;
+	__m128i message_values0;
+	__m128i message_values1;
+	__m128i message_values2;
+	__m128i message_values3;
+	__m128i message_values4;
+	__m128i message_values5;
+	__m128i message_values6;
+	__m128i message_values7;
+	__m128i round_constant1;
+	__m128i round_constant2;
+	__m128i round_constant3;
+	__m128i round_constant4;
+	__m128i temporary1;
+	__m128i temporary2;
+
+	byte_order_mask = _mm_set_epi64x(
+	                   0x0c0d0e0f08090a0bULL,
+	                   0x0405060700010203ULL );
+
+	round_constant1 = _mm_set1_epi32( (int) 0x5a827999UL );
+	round_constant2 = _mm_set1_epi32( (int) 0x6ed9eba1UL );
+	round_constant3 = _mm_set1_epi32( (int) 0x8f1bbcdcUL );
+	round_constant4 = _mm_set1_epi32( (int) 0xca62c1d6UL );
+
+	while( number_of_blocks > 0 )
+	{
+		/* Break the block into 16 x 32-bit values
+		 */
+		message_values0 = _mm_shuffle_epi8( _mm_loadu_si128( (const __m128i *) &( buffer[ 0 ] ) ), byte_order_mask );
+		message_values1 = _mm_shuffle_epi8( _mm_loadu_si128( (const __m128i *) &( buffer[ 16 ] ) ), byte_order_mask );
+		message_values2 = _mm_shuffle_epi8( _mm_loadu_si128( (const __m128i *) &( buffer[ 32 ] ) ), byte_order_mask );
+		message_values3 = _mm_shuffle_epi8( _mm_loadu_si128( (const __m128i *) &( buffer[ 48 ] ) ), byte_order_mask );
+
+		libhmac_sha1_ssse3_store_message_values_plus_k( message_values_plus_k, 0, message_values0, round_constant1 )
+		libhmac_sha1_ssse3_store_message_values_plus_k( message_values_plus_k, 4, message_values1, round_constant1 )
+		libhmac_sha1_ssse3_store_message_values_plus_k( message_values_plus_k, 8, message_values2, round_constant1 )
+		libhmac_sha1_ssse3_store_message_values_plus_k( message_values_plus_k, 12, message_values3, round_constant1 )
+
+		if( memory_copy(
+		     hash_values,
+		     context_hash_values,
+		     sizeof( uint32_t ) * 5 ) == NULL )
+		{
+			goto on_error;
+		}
+		/* Extend to 80 x 32-bit values while calculating the hash values of the preceding 32-bit values
+		 */
+		libhmac_sha1_ssse3_extend_message_values_first( message_values4, message_values3, message_values2, message_values1, message_values0, temporary1, temporary2 )
+		libhmac_sha1_ssse3_store_message_values_plus_k( message_values_plus_k, 16, message_values4, round_constant1 )
+
+		libhmac_sha1_ssse3_calculate_hash_value_choice( message_values_plus_k, 0, hash_values, 0, 1, 2, 3, 4 )
+		libhmac_sha1_ssse3_calculate_hash_value_choice( message_values_plus_k, 1, hash_values, 4, 0, 1, 2, 3 )
+		libhmac_sha1_ssse3_calculate_hash_value_choice( message_values_plus_k, 2, hash_values, 3, 4, 0, 1, 2 )
+		libhmac_sha1_ssse3_calculate_hash_value_choice( message_values_plus_k, 3, hash_values, 2, 3, 4, 0, 1 )
+
+		libhmac_sha1_ssse3_extend_message_values_first( message_values5, message_values4, message_values3, message_values2, message_values1, temporary1, temporary2 )
+		libhmac_sha1_ssse3_store_message_values_plus_k( message_values_plus_k, 20, message_values5, round_constant2 )
+
+		libhmac_sha1_ssse3_calculate_hash_value_choice( message_values_plus_k, 4, hash_values, 1, 2, 3, 4, 0 )
+		libhmac_sha1_ssse3_calculate_hash_value_choice( message_values_plus_k, 5, hash_values, 0, 1, 2, 3, 4 )
+		libhmac_sha1_ssse3_calculate_hash_value_choice( message_values_plus_k, 6, hash_values, 4, 0, 1, 2, 3 )
+		libhmac_sha1_ssse3_calculate_hash_value_choice( message_values_plus_k, 7, hash_values, 3, 4, 0, 1, 2 )
+
+		libhmac_sha1_ssse3_extend_message_values_first( message_values6, message_values5, message_values4, message_values3, message_values2, temporary1, temporary2 )
+		libhmac_sha1_ssse3_store_message_values_plus_k( message_values_plus_k, 24, message_values6, round_constant2 )
+
+		libhmac_sha1_ssse3_calculate_hash_value_choice( message_values_plus_k, 8, hash_values, 2, 3, 4, 0, 1 )
+		libhmac_sha1_ssse3_calculate_hash_value_choice( message_values_plus_k, 9, hash_values, 1, 2, 3, 4, 0 )
+		libhmac_sha1_ssse3_calculate_hash_value_choice( message_values_plus_k, 10, hash_values, 0, 1, 2, 3, 4 )
+		libhmac_sha1_ssse3_calculate_hash_value_choice( message_values_plus_k, 11, hash_values, 4, 0, 1, 2, 3 )
+
+		libhmac_sha1_ssse3_extend_message_values_first( message_values7, message_values6, message_values5, message_values4, message_values3, temporary1, temporary2 )
+		libhmac_sha1_ssse3_store_message_values_plus_k( message_values_plus_k, 28, message_values7, round_constant2 )
+
+		libhmac_sha1_ssse3_calculate_hash_value_choice( message_values_plus_k, 12, hash_values, 3, 4, 0, 1, 2 )
+		libhmac_sha1_ssse3_calculate_hash_value_choice( message_values_plus_k, 13, hash_values, 2, 3, 4, 0, 1 )
+		libhmac_sha1_ssse3_calculate_hash_value_choice( message_values_plus_k, 14, hash_values, 1, 2, 3, 4, 0 )
+		libhmac_sha1_ssse3_calculate_hash_value_choice( message_values_plus_k, 15, hash_values, 0, 1, 2, 3, 4 )
+
+		libhmac_sha1_ssse3_extend_message_values( message_values0, message_values7, message_values6, message_values4, message_values1, temporary1 )
+		libhmac_sha1_ssse3_store_message_values_plus_k( message_values_plus_k, 32, message_values0, round_constant2 )
+
+		libhmac_sha1_ssse3_calculate_hash_value_choice( message_values_plus_k, 16, hash_values, 4, 0, 1, 2, 3 )
+		libhmac_sha1_ssse3_calculate_hash_value_choice( message_values_plus_k, 17, hash_values, 3, 4, 0, 1, 2 )
+		libhmac_sha1_ssse3_calculate_hash_value_choice( message_values_plus_k, 18, hash_values, 2, 3, 4, 0, 1 )
+		libhmac_sha1_ssse3_calculate_hash_value_choice( message_values_plus_k, 19, hash_values, 1, 2, 3, 4, 0 )
+
+		libhmac_sha1_ssse3_extend_message_values( message_values1, message_values0, message_values7, message_values5, message_values2, temporary1 )
+		libhmac_sha1_ssse3_store_message_values_plus_k( message_values_plus_k, 36, message_values1, round_constant2 )
+
+		libhmac_sha1_ssse3_calculate_hash_value_parity( message_values_plus_k, 20, hash_values, 0, 1, 2, 3, 4 )
+		libhmac_sha1_ssse3_calculate_hash_value_parity( message_values_plus_k, 21, hash_values, 4, 0, 1, 2, 3 )
+		libhmac_sha1_ssse3_calculate_hash_value_parity( message_values_plus_k, 22, hash_values, 3, 4, 0, 1, 2 )
+		libhmac_sha1_ssse3_calculate_hash_value_parity( message_values_plus_k, 23, hash_values, 2, 3, 4, 0, 1 )
+
+		libhmac_sha1_ssse3_extend_message_values( message_values2, message_values1, message_values0, message_values6, message_values3, temporary1 )
+		libhmac_sha1_ssse3_store_message_values_plus_k( message_values_plus_k, 40, message_values2, round_constant3 )
+
+		libhmac_sha1_ssse3_calculate_hash_value_parity( message_values_plus_k, 24, hash_values, 1, 2, 3, 4, 0 )
+		libhmac_sha1_ssse3_calculate_hash_value_parity( message_values_plus_k, 25, hash_values, 0, 1, 2, 3, 4 )
+		libhmac_sha1_ssse3_calculate_hash_value_parity( message_values_plus_k, 26, hash_values, 4, 0, 1, 2, 3 )
+		libhmac_sha1_ssse3_calculate_hash_value_parity( message_values_plus_k, 27, hash_values, 3, 4, 0, 1, 2 )
+
+		libhmac_sha1_ssse3_extend_message_values( message_values3, message_values2, message_values1, message_values7, message_values4, temporary1 )
+		libhmac_sha1_ssse3_store_message_values_plus_k( message_values_plus_k, 44, message_values3, round_constant3 )
+
+		libhmac_sha1_ssse3_calculate_hash_value_parity( message_values_plus_k, 28, hash_values, 2, 3, 4, 0, 1 )
+		libhmac_sha1_ssse3_calculate_hash_value_parity( message_values_plus_k, 29, hash_values, 1, 2, 3, 4, 0 )
+		libhmac_sha1_ssse3_calculate_hash_value_parity( message_values_plus_k, 30, hash_values, 0, 1, 2, 3, 4 )
+		libhmac_sha1_ssse3_calculate_hash_value_parity( message_values_plus_k, 31, hash_values, 4, 0, 1, 2, 3 )
+
+		libhmac_sha1_ssse3_extend_message_values( message_values4, message_values3, message_values2, message_values0, message_values5, temporary1 )
+		libhmac_sha1_ssse3_store_message_values_plus_k( message_values_plus_k, 48, message_values4, round_constant3 )
+
+		libhmac_sha1_ssse3_calculate_hash_value_parity( message_values_plus_k, 32, hash_values, 3, 4, 0, 1, 2 )
+		libhmac_sha1_ssse3_calculate_hash_value_parity( message_values_plus_k, 33, hash_values, 2, 3, 4, 0, 1 )
+		libhmac_sha1_ssse3_calculate_hash_value_parity( message_values_plus_k, 34, hash_values, 1, 2, 3, 4, 0 )
+		libhmac_sha1_ssse3_calculate_hash_value_parity( message_values_plus_k, 35, hash_values, 0, 1, 2, 3, 4 )
+
+		libhmac_sha1_ssse3_extend_message_values( message_values5, message_values4, message_values3, message_values1, message_values6, temporary1 )
+		libhmac_sha1_ssse3_store_message_values_plus_k( message_values_plus_k, 52, message_values5, round_constant3 )
+
+		libhmac_sha1_ssse3_calculate_hash_value_parity( message_values_plus_k, 36, hash_values, 4, 0, 1, 2, 3 )
+		libhmac_sha1_ssse3_calculate_hash_value_parity( message_values_plus_k, 37, hash_values, 3, 4, 0, 1, 2 )
+		libhmac_sha1_ssse3_calculate_hash_value_parity( message_values_plus_k, 38, hash_values, 2, 3, 4, 0, 1 )
+		libhmac_sha1_ssse3_calculate_hash_value_parity( message_values_plus_k, 39, hash_values, 1, 2, 3, 4, 0 )
+
+		libhmac_sha1_ssse3_extend_message_values( message_values6, message_values5, message_values4, message_values2, message_values7, temporary1 )
+		libhmac_sha1_ssse3_store_message_values_plus_k( message_values_plus_k, 56, message_values6, round_constant3 )
+
+		libhmac_sha1_ssse3_calculate_hash_value_majority( message_values_plus_k, 40, hash_values, 0, 1, 2, 3, 4 )
+		libhmac_sha1_ssse3_calculate_hash_value_majority( message_values_plus_k, 41, hash_values, 4, 0, 1, 2, 3 )
+		libhmac_sha1_ssse3_calculate_hash_value_majority( message_values_plus_k, 42, hash_values, 3, 4, 0, 1, 2 )
+		libhmac_sha1_ssse3_calculate_hash_value_majority( message_values_plus_k, 43, hash_values, 2, 3, 4, 0, 1 )
+
+		libhmac_sha1_ssse3_extend_message_values( message_values7, message_values6, message_values5, message_values3, message_values0, temporary1 )
+		libhmac_sha1_ssse3_store_message_values_plus_k( message_values_plus_k, 60, message_values7, round_constant4 )
+
+		libhmac_sha1_ssse3_calculate_hash_value_majority( message_values_plus_k, 44, hash_values, 1, 2, 3, 4, 0 )
+		libhmac_sha1_ssse3_calculate_hash_value_majority( message_values_plus_k, 45, hash_values, 0, 1, 2, 3, 4 )
+		libhmac_sha1_ssse3_calculate_hash_value_majority( message_values_plus_k, 46, hash_values, 4, 0, 1, 2, 3 )
+		libhmac_sha1_ssse3_calculate_hash_value_majority( message_values_plus_k, 47, hash_values, 3, 4, 0, 1, 2 )
+
+		libhmac_sha1_ssse3_extend_message_values( message_values0, message_values7, message_values6, message_values4, message_values1, temporary1 )
+		libhmac_sha1_ssse3_store_message_values_plus_k( message_values_plus_k, 64, message_values0, round_constant4 )
+
+		libhmac_sha1_ssse3_calculate_hash_value_majority( message_values_plus_k, 48, hash_values, 2, 3, 4, 0, 1 )
+		libhmac_sha1_ssse3_calculate_hash_value_majority( message_values_plus_k, 49, hash_values, 1, 2, 3, 4, 0 )
+		libhmac_sha1_ssse3_calculate_hash_value_majority( message_values_plus_k, 50, hash_values, 0, 1, 2, 3, 4 )
+		libhmac_sha1_ssse3_calculate_hash_value_majority( message_values_plus_k, 51, hash_values, 4, 0, 1, 2, 3 )
+
+		libhmac_sha1_ssse3_extend_message_values( message_values1, message_values0, message_values7, message_values5, message_values2, temporary1 )
+		libhmac_sha1_ssse3_store_message_values_plus_k( message_values_plus_k, 68, message_values1, round_constant4 )
+
+		libhmac_sha1_ssse3_calculate_hash_value_majority( message_values_plus_k, 52, hash_values, 3, 4, 0, 1, 2 )
+		libhmac_sha1_ssse3_calculate_hash_value_majority( message_values_plus_k, 53, hash_values, 2, 3, 4, 0, 1 )
+		libhmac_sha1_ssse3_calculate_hash_value_majority( message_values_plus_k, 54, hash_values, 1, 2, 3, 4, 0 )
+		libhmac_sha1_ssse3_calculate_hash_value_majority( message_values_plus_k, 55, hash_values, 0, 1, 2, 3, 4 )
+
+		libhmac_sha1_ssse3_extend_message_values( message_values2, message_values1, message_values0, message_values6, message_values3, temporary1 )
+		libhmac_sha1_ssse3_store_message_values_plus_k( message_values_plus_k, 72, message_values2, round_constant4 )
+
+		libhmac_sha1_ssse3_calculate_hash_value_majority( message_values_plus_k, 56, hash_values, 4, 0, 1, 2, 3 )
+		libhmac_sha1_ssse3_calculate_hash_value_majority( message_values_plus_k, 57, hash_values, 3, 4, 0, 1, 2 )
+		libhmac_sha1_ssse3_calculate_hash_value_majority( message_values_plus_k, 58, hash_values, 2, 3, 4, 0, 1 )
+		libhmac_sha1_ssse3_calculate_hash_value_majority( message_values_plus_k, 59, hash_values, 1, 2, 3, 4, 0 )
+
+		libhmac_sha1_ssse3_extend_message_values( message_values3, message_values2, message_values1, message_values7, message_values4, temporary1 )
+		libhmac_sha1_ssse3_store_message_values_plus_k( message_values_plus_k, 76, message_values3, round_constant4 )
+
+		libhmac_sha1_ssse3_calculate_hash_value_parity( message_values_plus_k, 60, hash_values, 0, 1, 2, 3, 4 )
+		libhmac_sha1_ssse3_calculate_hash_value_parity( message_values_plus_k, 61, hash_values, 4, 0, 1, 2, 3 )
+		libhmac_sha1_ssse3_calculate_hash_value_parity( message_values_plus_k, 62, hash_values, 3, 4, 0, 1, 2 )
+		libhmac_sha1_ssse3_calculate_hash_value_parity( message_values_plus_k, 63, hash_values, 2, 3, 4, 0, 1 )
+
+		libhmac_sha1_ssse3_calculate_hash_value_parity( message_values_plus_k, 64, hash_values, 1, 2, 3, 4, 0 )
+		libhmac_sha1_ssse3_calculate_hash_value_parity( message_values_plus_k, 65, hash_values, 0, 1, 2, 3, 4 )
+		libhmac_sha1_ssse3_calculate_hash_value_parity( message_values_plus_k, 66, hash_values, 4, 0, 1, 2, 3 )
+		libhmac_sha1_ssse3_calculate_hash_value_parity( message_values_plus_k, 67, hash_values, 3, 4, 0, 1, 2 )
+
+		libhmac_sha1_ssse3_calculate_hash_value_parity( message_values_plus_k, 68, hash_values, 2, 3, 4, 0, 1 )
+		libhmac_sha1_ssse3_calculate_hash_value_parity( message_values_plus_k, 69, hash_values, 1, 2, 3, 4, 0 )
+		libhmac_sha1_ssse3_calculate_hash_value_parity( message_values_plus_k, 70, hash_values, 0, 1, 2, 3, 4 )
+		libhmac_sha1_ssse3_calculate_hash_value_parity( message_values_plus_k, 71, hash_values, 4, 0, 1, 2, 3 )
+
+		libhmac_sha1_ssse3_calculate_hash_value_parity( message_values_plus_k, 72, hash_values, 3, 4, 0, 1, 2 )
+		libhmac_sha1_ssse3_calculate_hash_value_parity( message_values_plus_k, 73, hash_values, 2, 3, 4, 0, 1 )
+		libhmac_sha1_ssse3_calculate_hash_value_parity( message_values_plus_k, 74, hash_values, 1, 2, 3, 4, 0 )
+		libhmac_sha1_ssse3_calculate_hash_value_parity( message_values_plus_k, 75, hash_values, 0, 1, 2, 3, 4 )
+
+		libhmac_sha1_ssse3_calculate_hash_value_parity( message_values_plus_k, 76, hash_values, 4, 0, 1, 2, 3 )
+		libhmac_sha1_ssse3_calculate_hash_value_parity( message_values_plus_k, 77, hash_values, 3, 4, 0, 1, 2 )
+		libhmac_sha1_ssse3_calculate_hash_value_parity( message_values_plus_k, 78, hash_values, 2, 3, 4, 0, 1 )
+		libhmac_sha1_ssse3_calculate_hash_value_parity( message_values_plus_k, 79, hash_values, 1, 2, 3, 4, 0 )
+
+		/* Update the hash values in the context
+		 */
+		context_hash_values[ 0 ] += hash_values[ 0 ];
+		context_hash_values[ 1 ] += hash_values[ 1 ];
+		context_hash_values[ 2 ] += hash_values[ 2 ];
+		context_hash_values[ 3 ] += hash_values[ 3 ];
+		context_hash_values[ 4 ] += hash_values[ 4 ];
+
+		buffer           += 64;
+		number_of_blocks -= 1;
+	}
+	/* Prevent sensitive data from leaking
+	 */
+	if( memory_set(
+	     hash_values,
+	     0,
+	     sizeof( uint32_t ) * 5 ) == NULL )
+	{
+		goto on_error;
+	}
+	if( memory_set(
+	     message_values_plus_k,
+	     0,
+	     sizeof( uint32_t ) * 80 ) == NULL )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	memory_set(
+	 message_values_plus_k,
+	 0,
+	 sizeof( uint32_t ) * 80 );
+
+	memory_set(
+	 hash_values,
+	 0,
+	 sizeof( uint32_t ) * 5 );
+
+	return( -1 );
+}
+
+#endif /* defined( LIBHMAC_HAVE_X86_KERNELS ) */
+
@@ -33,6 +33,8 @@
 extern "C" {
 #endif
 
+#define LIBHMAC_SHA224_CALCULATE_BATCH_SIZE	32
+
 LIBHMAC_EXTERN \
 int libhmac_sha224_initialize(
      libhmac_sha224_context_t **context,
@@ -65,6 +67,15 @@ int libhmac_sha224_calculate(
      size_t hash_size,
      libcerror_error_t **error );
 
+LIBHMAC_EXTERN \
+int libhmac_sha224_calculate_batch(
+     const uint8_t **buffers,
+     const size_t *sizes,
+     int number_of_buffers,
+     uint8_t *hashes,
+     size_t hashes_size,
+     libcerror_error_t **error );
+
 LIBHMAC_EXTERN \
 int libhmac_sha224_calculate_hmac(
      const uint8_t *key,
@@ -75,6 +86,13 @@ int libhmac_sha224_calculate_hmac(
      size_t hmac_size,
      libcerror_error_t **error );
 
+LIBHMAC_EXTERN \
+int libhmac_sha224_compress_blocks(
+     uint32_t *hash_values,
+     const uint8_t *blocks,
+     size_t number_of_blocks,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -32,44 +32,43 @@
 #include <openssl/evp.h>
 #endif
 
+#include "libhmac_atomic.h"
 #include "libhmac_byte_stream.h"
 #include "libhmac_definitions.h"
+#include "libhmac_kernel.h"
 #include "libhmac_libcerror.h"
 #include "libhmac_sha224_context.h"
+#include "libhmac_sha256_avx2.h"
+#include "libhmac_sha256_context.h"
+#include "libhmac_sha256_sha_ni.h"
 
-#if !defined( LIBHMAC_HAVE_SHA224_SUPPORT )
+/* Structure used to determine the alignment of the internal context
+ */
+typedef struct libhmac_sha224_context_alignment libhmac_sha224_context_alignment_t;
+
+struct libhmac_sha224_context_alignment
+{
+	/* Dummy value to offset the internal context
+	 */
+	uint8_t dummy;
+
+	/* The internal context
+	 */
+	libhmac_internal_sha224_context_t internal_context;
+};
 
 /* FIPS 180-2 based SHA-224 functions
+ * SHA-224 uses the round constants of SHA-256
+ * The initial hash values are shared with the SHA-256 multi-buffer kernels
  */
 
 /* The first 32-bits of the fractional parts of the square roots of the first 8 primes [ 2, 19 ]
  */
-static uint32_t libhmac_sha224_context_prime_square_roots[ 8 ] = {
+const uint32_t libhmac_sha224_context_prime_square_roots[ 8 ] = {
 	0xc1059ed8UL, 0x367cd507UL, 0x3070dd17UL, 0xf70e5939UL,
 	0xffc00b31UL, 0x68581511UL, 0x64f98fa7UL, 0xbefa4fa4UL
 };
 
-/* The first 32-bits of the fractional parts of the cube roots of the first 64 primes [ 2, 311 ]
- */
-static uint32_t libhmac_sha224_context_prime_cube_roots[ 64 ] = {
-	0x428a2f98UL, 0x71374491UL, 0xb5c0fbcfUL, 0xe9b5dba5UL,
-	0x3956c25bUL, 0x59f111f1UL, 0x923f82a4UL, 0xab1c5ed5UL,
-	0xd807aa98UL, 0x12835b01UL, 0x243185beUL, 0x550c7dc3UL,
-	0x72be5d74UL, 0x80deb1feUL, 0x9bdc06a7UL, 0xc19bf174UL,
-	0xe49b69c1UL, 0xefbe4786UL, 0x0fc19dc6UL, 0x240ca1ccUL,
-	0x2de92c6fUL, 0x4a7484aaUL, 0x5cb0a9dcUL, 0x76f988daUL,
-	0x983e5152UL, 0xa831c66dUL, 0xb00327c8UL, 0xbf597fc7UL,
-	0xc6e00bf3UL, 0xd5a79147UL, 0x06ca6351UL, 0x14292967UL,
-	0x27b70a85UL, 0x2e1b2138UL, 0x4d2c6dfcUL, 0x53380d13UL,
-	0x650a7354UL, 0x766a0abbUL, 0x81c2c92eUL, 0x92722c85UL,
-	0xa2bfe8a1UL, 0xa81a664bUL, 0xc24b8b70UL, 0xc76c51a3UL,
-	0xd192e819UL, 0xd6990624UL, 0xf40e3585UL, 0x106aa070UL,
-	0x19a4c116UL, 0x1e376c08UL, 0x2748774cUL, 0x34b0bcb5UL,
-	0x391c0cb3UL, 0x4ed8aa4aUL, 0x5b9cca4fUL, 0x682e6ff3UL,
-	0x748f82eeUL, 0x78a5636fUL, 0x84c87814UL, 0x8cc70208UL,
-	0x90befffaUL, 0xa4506cebUL, 0xbef9a3f7UL, 0xc67178f2UL
-};
-
 #define libhmac_sha224_context_transform_extend_32bit_value( values_32bit, value_32bit_index, s0, s1 ) \
 	s0 = byte_stream_bit_rotate_right_32bit( values_32bit[ value_32bit_index - 15 ], 7 ) \
 	   ^ byte_stream_bit_rotate_right_32bit( values_32bit[ value_32bit_index - 15 ], 18 ) \
@@ -145,7 +144,7 @@ static uint32_t libhmac_sha224_context_prime_cube_roots[ 64 ] = {
 	t1 += s1; \
 	t1 += ( hash_values[ hash_value_index4 ] & hash_values[ hash_value_index5 ] ) \
 	    ^ ( ~( hash_values[ hash_value_index4 ] ) & hash_values[ hash_value_index6 ] ); \
-	t1 += libhmac_sha224_context_prime_cube_roots[ value_32bit_index ]; \
+	t1 += libhmac_sha256_context_prime_cube_roots[ value_32bit_index ]; \
 	t1 += values_32bit[ value_32bit_index ]; \
 	t2  = s0; \
 	t2 += ( hash_values[ hash_value_index0 ] & hash_values[ hash_value_index1 ] ) \
@@ -222,18 +221,17 @@ static uint32_t libhmac_sha224_context_prime_cube_roots[ 64 ] = {
 	libhmac_sha224_context_transform_unfolded_calculate_hash_value( values_32bit, 63, hash_values, 1, 2, 3, 4, 5, 6, 7, 0, s0, s1, t1, t2 )
 
 /* Calculates the SHA-224 of 64 byte sized blocks of data in a buffer
- * Returns the number of bytes used if successful or -1 on error
+ * This is the portable kernel
+ * Returns 1 if successful or -1 on error
  */
-ssize_t libhmac_sha224_context_transform(
-         libhmac_internal_sha224_context_t *internal_context,
-         const uint8_t *buffer,
-         size_t size,
-         libcerror_error_t **error )
+int libhmac_sha224_context_transform_portable(
+     uint32_t *context_hash_values,
+     const uint8_t *buffer,
+     size_t number_of_blocks )
 {
 	uint32_t hash_values[ 8 ];
 	uint32_t values_32bit[ 64 ];
 
-	static char *function     = "libhmac_sha224_context_transform";
 	uint32_t s0               = 0;
 	uint32_t s1               = 0;
 	uint32_t t1               = 0;
@@ -245,53 +243,13 @@ ssize_t libhmac_sha224_context_transform(
 	uint8_t value_32bit_index = 0;
 #endif
 
-	if( internal_context == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid internal context.",
-		 function );
-
-		return( -1 );
-	}
-	if( buffer == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid buffer.",
-		 function );
-
-		return( -1 );
-	}
-	if( size > (size_t) SSIZE_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid size value exceeds maximum.",
-		 function );
-
-		return( -1 );
-	}
-	while( size >= LIBHMAC_SHA224_BLOCK_SIZE )
+	while( number_of_blocks > 0 )
 	{
 		if( memory_copy(
 		     hash_values,
-		     internal_context->hash_values,
+		     context_hash_values,
 		     sizeof( uint32_t ) * 8 ) == NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy hash values.",
-			 function );
-
 			goto on_error;
 		}
 #if defined( LIBHMAC_UNFOLLED_LOOPS )
@@ -322,14 +280,14 @@ ssize_t libhmac_sha224_context_transform(
 
 		/* Update the hash values in the context
 		 */
-		internal_context->hash_values[ 0 ] += hash_values[ 0 ];
-		internal_context->hash_values[ 1 ] += hash_values[ 1 ];
-		internal_context->hash_values[ 2 ] += hash_values[ 2 ];
-		internal_context->hash_values[ 3 ] += hash_values[ 3 ];
-		internal_context->hash_values[ 4 ] += hash_values[ 4 ];
-		internal_context->hash_values[ 5 ] += hash_values[ 5 ];
-		internal_context->hash_values[ 6 ] += hash_values[ 6 ];
-		internal_context->hash_values[ 7 ] += hash_values[ 7 ];
+		context_hash_values[ 0 ] += hash_values[ 0 ];
+		context_hash_values[ 1 ] += hash_values[ 1 ];
+		context_hash_values[ 2 ] += hash_values[ 2 ];
+		context_hash_values[ 3 ] += hash_values[ 3 ];
+		context_hash_values[ 4 ] += hash_values[ 4 ];
+		context_hash_values[ 5 ] += hash_values[ 5 ];
+		context_hash_values[ 6 ] += hash_values[ 6 ];
+		context_hash_values[ 7 ] += hash_values[ 7 ];
 
 #else
 		/* Break the block into 16 x 32-bit values
@@ -373,7 +331,7 @@ ssize_t libhmac_sha224_context_transform(
 			t1 += s1;
 			t1 += ( hash_values[ 4 ] & hash_values[ 5 ] )
 			    ^ ( ~( hash_values[ 4 ] ) & hash_values[ 6 ] );
-			t1 += libhmac_sha224_context_prime_cube_roots[ value_32bit_index ];
+			t1 += libhmac_sha256_context_prime_cube_roots[ value_32bit_index ];
 			t1 += values_32bit[ value_32bit_index ];
 			t2  = s0;
 			t2 += ( hash_values[ 0 ] & hash_values[ 1 ] )
@@ -395,11 +353,11 @@ ssize_t libhmac_sha224_context_transform(
 		     hash_values_index < 8;
 		     hash_values_index++ )
 		{
-			internal_context->hash_values[ hash_values_index ] += hash_values[ hash_values_index ];
+			context_hash_values[ hash_values_index ] += hash_values[ hash_values_index ];
 		}
 #endif /* defined( LIBHMAC_UNFOLLED_LOOPS ) */
 
-		size -= LIBHMAC_SHA224_BLOCK_SIZE;
+		number_of_blocks--;
 	}
 	/* Prevent sensitive data from leaking
 	 */
@@ -408,13 +366,6 @@ ssize_t libhmac_sha224_context_transform(
 	     0,
 	     sizeof( uint32_t ) * 8 ) == NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear hash values.",
-		 function );
-
 		goto on_error;
 	}
 	if( memory_set(
@@ -422,16 +373,9 @@ ssize_t libhmac_sha224_context_transform(
 	     0,
 	     sizeof( uint32_t ) * 64 ) == NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear 32-bit values.",
-		 function );
-
 		goto on_error;
 	}
-	return( (ssize_t) buffer_offset );
+	return( 1 );
 
 on_error:
 	memory_set(
@@ -447,58 +391,221 @@ on_error:
 	return( -1 );
 }
 
-#endif /* !defined( LIBHMAC_HAVE_SHA224_SUPPORT ) */
+/* The SHA-224 kernels in order of preference
+ * SHA-224 uses the same block transform as SHA-256
+ * The portable kernel is expected to be last
+ */
+static int libhmac_sha224_context_kernel_types[ ] = {
+#if defined( LIBHMAC_HAVE_X86_KERNELS )
+	LIBHMAC_KERNEL_TYPE_SHA_NI,
+	LIBHMAC_KERNEL_TYPE_AVX2,
+#endif
+	LIBHMAC_KERNEL_TYPE_PORTABLE };
 
-/* Creates a SHA-224 context
- * Make sure the value context is referencing, is set to NULL
- * Returns 1 if successful or -1 on error
+static libhmac_kernel_transform_32bit_function_t libhmac_sha224_context_kernel_functions[ ] = {
+#if defined( LIBHMAC_HAVE_X86_KERNELS )
+	libhmac_sha256_sha_ni_transform,
+	libhmac_sha256_avx2_transform,
+#endif
+	libhmac_sha224_context_transform_portable };
+
+#define LIBHMAC_SHA224_CONTEXT_NUMBER_OF_KERNELS \
+	(int) ( sizeof( libhmac_sha224_context_kernel_types ) / sizeof( int ) )
+
+/* The index of the selected kernel or -1 if not yet selected
  */
-int libhmac_sha224_context_initialize(
-     libhmac_sha224_context_t **context,
+static int libhmac_sha224_context_kernel_index = -1;
+
+/* Retrieves the index of the selected kernel
+ * The kernel is selected on first use, concurrent callers select the same kernel
+ * Returns the kernel index
+ */
+static int libhmac_sha224_context_get_kernel_index(
+            void )
+{
+	int kernel_index = libhmac_atomic_get_32bit( &libhmac_sha224_context_kernel_index );
+
+	if( kernel_index < 0 )
+	{
+		kernel_index = libhmac_kernel_select(
+		                libhmac_sha224_context_kernel_types,
+		                LIBHMAC_SHA224_CONTEXT_NUMBER_OF_KERNELS );
+
+		libhmac_atomic_set_32bit(
+		 &libhmac_sha224_context_kernel_index,
+		 kernel_index );
+	}
+	return( kernel_index );
+}
+
+/* Retrieves the transform function of a specific kernel
+ * Returns 1 if successful, 0 if the kernel is not available or -1 on error
+ */
+int libhmac_sha224_context_get_transform_function(
+     int kernel_type,
+     libhmac_kernel_transform_32bit_function_t *transform_function,
      libcerror_error_t **error )
 {
-	libhmac_internal_sha224_context_t *internal_context = NULL;
-	static char *function                               = "libhmac_sha224_context_initialize";
+	static char *function = "libhmac_sha224_context_get_transform_function";
+	int kernel_index      = 0;
 
-#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_SHA224 )
-	const EVP_MD *evp_md_type                           = NULL;
-#endif
+	if( transform_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid transform function.",
+		 function );
 
-	if( context == NULL )
+		return( -1 );
+	}
+	for( kernel_index = 0;
+	     kernel_index < LIBHMAC_SHA224_CONTEXT_NUMBER_OF_KERNELS;
+	     kernel_index++ )
+	{
+		if( libhmac_sha224_context_kernel_types[ kernel_index ] == kernel_type )
+		{
+			if( libhmac_kernel_is_supported(
+			     kernel_type ) == 0 )
+			{
+				break;
+			}
+			*transform_function = libhmac_sha224_context_kernel_functions[ kernel_index ];
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+#if !defined( LIBHMAC_HAVE_SHA224_SUPPORT )
+
+/* Calculates the SHA-224 of 64 byte sized blocks of data in a buffer
+ * Returns the number of bytes used if successful or -1 on error
+ */
+ssize_t libhmac_sha224_context_transform(
+         libhmac_internal_sha224_context_t *internal_context,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	static char *function   = "libhmac_sha224_context_transform";
+	size_t number_of_blocks = 0;
+	int kernel_index        = 0;
+
+	if( internal_context == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid context.",
+		 "%s: invalid internal context.",
 		 function );
 
 		return( -1 );
 	}
-	if( *context != NULL )
+	if( buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid context value already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
 		 function );
 
 		return( -1 );
 	}
-	internal_context = memory_allocate_structure(
-	                    libhmac_internal_sha224_context_t );
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_blocks = size / LIBHMAC_SHA224_BLOCK_SIZE;
+
+	if( number_of_blocks > 0 )
+	{
+		kernel_index = libhmac_sha224_context_get_kernel_index();
+
+		if( libhmac_sha224_context_kernel_functions[ kernel_index ](
+		     internal_context->hash_values,
+		     buffer,
+		     number_of_blocks ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to transform blocks.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( (ssize_t) ( number_of_blocks * LIBHMAC_SHA224_BLOCK_SIZE ) );
+}
+
+#endif /* !defined( LIBHMAC_HAVE_SHA224_SUPPORT ) */
+
+/* Calculates the SHA-224 of 64 byte sized blocks of data using the selected kernel
+ * The hash values are updated in place, no padding is added
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_sha224_context_transform_blocks(
+     uint32_t *hash_values,
+     const uint8_t *blocks,
+     size_t number_of_blocks )
+{
+	int kernel_index = libhmac_sha224_context_get_kernel_index();
+
+	return( libhmac_sha224_context_kernel_functions[ kernel_index ](
+	         hash_values,
+	         blocks,
+	         number_of_blocks ) );
+}
+
+/* Retrieves the type of the kernel used by the SHA-224 context
+ * Returns the kernel type
+ */
+int libhmac_sha224_context_get_kernel_type(
+     void )
+{
+#if defined( LIBHMAC_HAVE_SHA224_SUPPORT )
+	return( LIBHMAC_KERNEL_TYPE_LIBCRYPTO );
+#else
+	return( libhmac_sha224_context_kernel_types[ libhmac_sha224_context_get_kernel_index() ] );
+#endif
+}
+
+/* Initializes the SHA-224 context values in the internal context
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_internal_sha224_context_initialize(
+     libhmac_internal_sha224_context_t *internal_context,
+     libcerror_error_t **error )
+{
+	static char *function     = "libhmac_internal_sha224_context_initialize";
+
+#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_SHA224 )
+	const EVP_MD *evp_md_type = NULL;
+#endif
 
 	if( internal_context == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create context.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	if( memory_set(
 	     internal_context,
@@ -512,9 +619,6 @@ int libhmac_sha224_context_initialize(
 		 "%s: unable to clear context.",
 		 function );
 
-		memory_free(
-		 internal_context );
-
 		return( -1 );
 	}
 #if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_SHA_H ) && defined( SHA224_DIGEST_LENGTH )
@@ -528,7 +632,7 @@ int libhmac_sha224_context_initialize(
 		 "%s: unable to initialize context.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 
 #elif defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_SHA224 )
@@ -549,7 +653,7 @@ int libhmac_sha224_context_initialize(
 		 "%s: unable to create EVP message digest context.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 #endif /* defined( HAVE_EVP_MD_CTX_INIT ) */
 
@@ -586,7 +690,7 @@ int libhmac_sha224_context_initialize(
 #endif
 		internal_context->evp_md_context = NULL;
 
-		goto on_error;
+		return( -1 );
 	}
 #else
 	if( memory_copy(
@@ -605,30 +709,21 @@ int libhmac_sha224_context_initialize(
 	}
 #endif /* defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_SHA_H ) && defined( SHA224_DIGEST_LENGTH ) */
 
-	*context = (libhmac_sha224_context_t *) internal_context;
-
 	return( 1 );
-
-on_error:
-	if( internal_context != NULL )
-	{
-		memory_free(
-		 internal_context );
-	}
-	return( -1 );
 }
 
-/* Frees a SHA-224 context
+/* Clears the SHA-224 context values in the internal context
+ * Releases the resources held by the context values but not the internal context itself
  * Returns 1 if successful or -1 on error
  */
-int libhmac_sha224_context_free(
-     libhmac_sha224_context_t **context,
+int libhmac_internal_sha224_context_clear(
+     libhmac_internal_sha224_context_t *internal_context,
      libcerror_error_t **error )
 {
-	libhmac_internal_sha224_context_t *internal_context = NULL;
-	static char *function                               = "libhmac_sha224_context_free";
+	static char *function = "libhmac_internal_sha224_context_clear";
+	int result            = 1;
 
-	if( context == NULL )
+	if( internal_context == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -639,139 +734,120 @@ int libhmac_sha224_context_free(
 
 		return( -1 );
 	}
-	if( *context != NULL )
-	{
-		internal_context = (libhmac_internal_sha224_context_t *) *context;
-		*context         = NULL;
-
 #if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_SHA_H ) && defined( SHA224_DIGEST_LENGTH )
-		/* No additional clean up necessary
-		 */
+	/* No additional clean up necessary
+	 */
 
 #elif defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_SHA224 )
 #if defined( HAVE_EVP_MD_CTX_CLEANUP )
-		if( EVP_MD_CTX_cleanup(
-		     &( internal_context->internal_evp_md_context ) ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to clean up EVP message digest context.",
-			 function );
-		}
-		/* Make sure the error state is removed otherwise OpenSSL will leak memory
-		 */
-		ERR_remove_thread_state(
-		 NULL );
+	if( EVP_MD_CTX_cleanup(
+	     &( internal_context->internal_evp_md_context ) ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clean up EVP message digest context.",
+		 function );
+
+		result = -1;
+	}
+	/* Make sure the error state is removed otherwise OpenSSL will leak memory
+	 */
+	ERR_remove_thread_state(
+	 NULL );
 #else
-		EVP_MD_CTX_free(
-		 internal_context->evp_md_context );
+	EVP_MD_CTX_free(
+	 internal_context->evp_md_context );
 
 #endif /* defined( HAVE_EVP_MD_CTX_CLEANUP ) */
 
-		internal_context->evp_md_context = NULL;
+	internal_context->evp_md_context = NULL;
 #else
-		/* No additional clean up necessary
-		 */
+	/* No additional clean up necessary
+	 */
 #endif /* defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_SHA_H ) && defined( SHA224_DIGEST_LENGTH ) */
 
-		memory_free(
-		 internal_context );
-	}
-	return( 1 );
+	return( result );
 }
 
-#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_SHA_H ) && defined( SHA224_DIGEST_LENGTH )
-
-/* Updates the SHA-224 context using OpenSSL
+/* Copies the SHA-224 context values of the source to the destination internal context
+ * The destination internal context must have been initialized
  * Returns 1 if successful or -1 on error
  */
-int libhmac_sha224_context_update(
-     libhmac_sha224_context_t *context,
-     const uint8_t *buffer,
-     size_t size,
+int libhmac_internal_sha224_context_copy(
+     libhmac_internal_sha224_context_t *destination_internal_context,
+     libhmac_internal_sha224_context_t *source_internal_context,
      libcerror_error_t **error )
 {
-	libhmac_internal_sha224_context_t *internal_context = NULL;
-	static char *function                               = "libhmac_sha224_context_update";
-	unsigned long safe_hash_size                        = 0;
+	static char *function = "libhmac_internal_sha224_context_copy";
 
-	if( context == NULL )
+	if( destination_internal_context == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid context.",
+		 "%s: invalid destination context.",
 		 function );
 
 		return( -1 );
 	}
-	internal_context = (libhmac_internal_sha224_context_t *) context;
-
-	if( buffer == NULL )
+	if( source_internal_context == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid buffer.",
+		 "%s: invalid source context.",
 		 function );
 
 		return( -1 );
 	}
-#if ( SIZEOF_LONG < SIZEOF_SIZE_T )
-	if( size > (size_t) ULONG_MAX )
-#else
-	if( size > (size_t) SSIZE_MAX )
-#endif
+#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_SHA224 )
+	if( EVP_MD_CTX_copy_ex(
+	     destination_internal_context->evp_md_context,
+	     source_internal_context->evp_md_context ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid size value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy EVP message digest context.",
 		 function );
 
 		return( -1 );
 	}
-	if( size == 0 )
-	{
-		return( 1 );
-	}
-	safe_hash_size = (unsigned long) size;
-
-	if( SHA256_Update(
-	     &( internal_context->sha224_context ),
-	     (const void *) buffer,
-	     size ) != 1 )
+#else
+	if( memory_copy(
+	     destination_internal_context,
+	     source_internal_context,
+	     sizeof( libhmac_internal_sha224_context_t ) ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to update context.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy source to destination context.",
 		 function );
 
 		return( -1 );
 	}
+#endif /* defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_SHA224 ) */
+
 	return( 1 );
 }
 
-#elif defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_SHA224 )
-
-/* Updates the SHA-224 context using OpenSSL EVP
+/* Creates a SHA-224 context
+ * Make sure the value context is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
  */
-int libhmac_sha224_context_update(
-     libhmac_sha224_context_t *context,
-     const uint8_t *buffer,
-     size_t size,
+int libhmac_sha224_context_initialize(
+     libhmac_sha224_context_t **context,
      libcerror_error_t **error )
 {
 	libhmac_internal_sha224_context_t *internal_context = NULL;
-	static char *function                               = "libhmac_sha224_context_update";
+	static char *function                               = "libhmac_sha224_context_initialize";
 
 	if( context == NULL )
 	{
@@ -784,67 +860,157 @@ int libhmac_sha224_context_update(
 
 		return( -1 );
 	}
-	internal_context = (libhmac_internal_sha224_context_t *) context;
+	if( *context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid context value already set.",
+		 function );
 
-	if( buffer == NULL )
+		return( -1 );
+	}
+	internal_context = memory_allocate_structure(
+	                    libhmac_internal_sha224_context_t );
+
+	if( internal_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create context.",
+		 function );
+
+		goto on_error;
+	}
+	if( libhmac_internal_sha224_context_initialize(
+	     internal_context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize context.",
+		 function );
+
+		goto on_error;
+	}
+	*context = (libhmac_sha224_context_t *) internal_context;
+
+	return( 1 );
+
+on_error:
+	if( internal_context != NULL )
+	{
+		memory_free(
+		 internal_context );
+	}
+	return( -1 );
+}
+
+/* Frees a SHA-224 context
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_sha224_context_free(
+     libhmac_sha224_context_t **context,
+     libcerror_error_t **error )
+{
+	libhmac_internal_sha224_context_t *internal_context = NULL;
+	static char *function                               = "libhmac_sha224_context_free";
+	int result                                          = 1;
+
+	if( context == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid buffer.",
+		 "%s: invalid context.",
 		 function );
 
 		return( -1 );
 	}
-	if( size > (size_t) SSIZE_MAX )
+	if( *context != NULL )
+	{
+		internal_context = (libhmac_internal_sha224_context_t *) *context;
+		*context         = NULL;
+
+		if( libhmac_internal_sha224_context_clear(
+		     internal_context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear context.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_context );
+	}
+	return( result );
+}
+
+/* Retrieves the size and alignment of the memory of a SHA-224 context
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_sha224_context_get_size(
+     size_t *context_size,
+     size_t *context_alignment,
+     libcerror_error_t **error )
+{
+	static char *function = "libhmac_sha224_context_get_size";
+
+	if( context_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid size value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context size.",
 		 function );
 
 		return( -1 );
 	}
-	if( size == 0 )
-	{
-		return( 1 );
-	}
-	if( EVP_DigestUpdate(
-	     internal_context->evp_md_context,
-	     (const void *) buffer,
-	     size ) != 1 )
+	if( context_alignment == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to update context.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context alignment.",
 		 function );
 
 		return( -1 );
 	}
+	*context_size      = sizeof( libhmac_internal_sha224_context_t );
+	*context_alignment = sizeof( libhmac_sha224_context_alignment_t ) - sizeof( libhmac_internal_sha224_context_t );
+
 	return( 1 );
 }
 
-#else
-
-/* Updates the SHA-224 context using fallback implementation
+/* Creates a SHA-224 context in caller provided memory
+ * The memory must be at least the size and have the alignment retrieved
+ * by libhmac_sha224_context_get_size and must remain available until the
+ * context is freed with libhmac_sha224_context_free_in_place
+ * Make sure the value context is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
  */
-int libhmac_sha224_context_update(
-     libhmac_sha224_context_t *context,
-     const uint8_t *buffer,
-     size_t size,
+int libhmac_sha224_context_initialize_in_place(
+     libhmac_sha224_context_t **context,
+     uint8_t *memory,
+     size_t memory_size,
      libcerror_error_t **error )
 {
 	libhmac_internal_sha224_context_t *internal_context = NULL;
-	static char *function                               = "libhmac_sha224_context_update";
-	size_t buffer_offset                                = 0;
-	size_t remaining_block_size                         = 0;
-	ssize_t process_count                               = 0;
+	static char *function                               = "libhmac_sha224_context_initialize_in_place";
+	size_t context_alignment                            = 0;
 
 	if( context == NULL )
 	{
@@ -857,167 +1023,1307 @@ int libhmac_sha224_context_update(
 
 		return( -1 );
 	}
-	internal_context = (libhmac_internal_sha224_context_t *) context;
+	if( *context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid context value already set.",
+		 function );
 
-	if( buffer == NULL )
+		return( -1 );
+	}
+	if( memory == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid buffer.",
+		 "%s: invalid memory.",
 		 function );
 
 		return( -1 );
 	}
-	if( size > (size_t) SSIZE_MAX )
+	if( memory_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid size value exceeds maximum.",
+		 "%s: invalid memory size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( size == 0 )
+	if( memory_size < sizeof( libhmac_internal_sha224_context_t ) )
 	{
-		return( 1 );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid memory size value too small.",
+		 function );
+
+		return( -1 );
 	}
-	if( internal_context->block_offset > 0 )
+	context_alignment = sizeof( libhmac_sha224_context_alignment_t ) - sizeof( libhmac_internal_sha224_context_t );
+
+	if( ( (intptr_t) memory % (intptr_t) context_alignment ) != 0 )
 	{
-		if( internal_context->block_offset >= LIBHMAC_SHA224_BLOCK_SIZE )
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid memory value not aligned.",
+		 function );
+
+		return( -1 );
+	}
+	internal_context = (libhmac_internal_sha224_context_t *) memory;
+
+	if( libhmac_internal_sha224_context_initialize(
+	     internal_context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize context.",
+		 function );
+
+		return( -1 );
+	}
+	*context = (libhmac_sha224_context_t *) internal_context;
+
+	return( 1 );
+}
+
+/* Frees a SHA-224 context created in caller provided memory
+ * The memory itself is not freed
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_sha224_context_free_in_place(
+     libhmac_sha224_context_t **context,
+     libcerror_error_t **error )
+{
+	libhmac_internal_sha224_context_t *internal_context = NULL;
+	static char *function                               = "libhmac_sha224_context_free_in_place";
+	int result                                          = 1;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *context != NULL )
+	{
+		internal_context = (libhmac_internal_sha224_context_t *) *context;
+		*context         = NULL;
+
+		if( libhmac_internal_sha224_context_clear(
+		     internal_context,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid context - block offset value out of bounds.",
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear context.",
 			 function );
 
-			return( -1 );
+			result = -1;
 		}
-		remaining_block_size = LIBHMAC_SHA224_BLOCK_SIZE - internal_context->block_offset;
-
+	}
+	return( result );
+}
+
+/* Resets a SHA-224 context
+ * The context can be reused to calculate a new hash without being freed and reinitialized
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_sha224_context_reset(
+     libhmac_sha224_context_t *context,
+     libcerror_error_t **error )
+{
+	libhmac_internal_sha224_context_t *internal_context = NULL;
+	static char *function                               = "libhmac_sha224_context_reset";
+
+#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_SHA224 )
+	const EVP_MD *evp_md_type                           = NULL;
+#endif
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	internal_context = (libhmac_internal_sha224_context_t *) context;
+
+#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_SHA_H ) && defined( SHA224_DIGEST_LENGTH )
+	if( SHA224_Init(
+	     &( internal_context->sha224_context ) ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize context.",
+		 function );
+
+		return( -1 );
+	}
+
+#elif defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_SHA224 )
+/* TODO use EVP_MD_fetch for EVP_DigestInit_ex2 */
+	evp_md_type = EVP_sha224();
+
+#if defined( HAVE_EVP_DIGESTINIT_EX2 )
+	if( EVP_DigestInit_ex2(
+	     internal_context->evp_md_context,
+	     evp_md_type,
+	     NULL ) != 1 )
+#else
+	if( EVP_DigestInit_ex(
+	     internal_context->evp_md_context,
+	     evp_md_type,
+	     NULL ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize context.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	if( memory_copy(
+	     internal_context->hash_values,
+	     libhmac_sha224_context_prime_square_roots,
+	     sizeof( uint32_t ) * 8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy initial hash values.",
+		 function );
+
+		return( -1 );
+	}
+	internal_context->hash_count   = 0;
+	internal_context->block_offset = 0;
+#endif /* defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_SHA_H ) && defined( SHA224_DIGEST_LENGTH ) */
+
+	return( 1 );
+}
+
+/* Clones (duplicates) the SHA-224 context
+ * The clone continues from the state of the source context
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_sha224_context_clone(
+     libhmac_sha224_context_t **destination_context,
+     libhmac_sha224_context_t *source_context,
+     libcerror_error_t **error )
+{
+	libhmac_internal_sha224_context_t *internal_destination_context = NULL;
+	libhmac_internal_sha224_context_t *internal_source_context      = NULL;
+	static char *function                                           = "libhmac_sha224_context_clone";
+
+	if( destination_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination context value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_context == NULL )
+	{
+		*destination_context = NULL;
+
+		return( 1 );
+	}
+	internal_source_context = (libhmac_internal_sha224_context_t *) source_context;
+
+	internal_destination_context = memory_allocate_structure(
+	                                libhmac_internal_sha224_context_t );
+
+	if( internal_destination_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create destination context.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_SHA224 )
+	if( memory_set(
+	     internal_destination_context,
+	     0,
+	     sizeof( libhmac_internal_sha224_context_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear destination context.",
+		 function );
+
+		memory_free(
+		 internal_destination_context );
+
+		return( -1 );
+	}
+#if defined( HAVE_EVP_MD_CTX_INIT )
+	EVP_MD_CTX_init(
+	 &( internal_destination_context->internal_evp_md_context ) );
+
+	internal_destination_context->evp_md_context = &( internal_destination_context->internal_evp_md_context );
+#else
+	internal_destination_context->evp_md_context = EVP_MD_CTX_new();
+
+	if( internal_destination_context->evp_md_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create EVP message digest context.",
+		 function );
+
+		goto on_error;
+	}
+#endif /* defined( HAVE_EVP_MD_CTX_INIT ) */
+
+	if( EVP_MD_CTX_copy_ex(
+	     internal_destination_context->evp_md_context,
+	     internal_source_context->evp_md_context ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy EVP message digest context.",
+		 function );
+
+		goto on_error;
+	}
+#else
+	if( memory_copy(
+	     internal_destination_context,
+	     internal_source_context,
+	     sizeof( libhmac_internal_sha224_context_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy source to destination context.",
+		 function );
+
+		goto on_error;
+	}
+#endif /* defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_SHA224 ) */
+
+	*destination_context = (libhmac_sha224_context_t *) internal_destination_context;
+
+	return( 1 );
+
+on_error:
+	if( internal_destination_context != NULL )
+	{
+		libhmac_internal_sha224_context_clear(
+		 internal_destination_context,
+		 NULL );
+
+		memory_free(
+		 internal_destination_context );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_SHA_H ) && defined( SHA224_DIGEST_LENGTH )
+
+/* Updates the SHA-224 context using OpenSSL
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_sha224_context_update(
+     libhmac_sha224_context_t *context,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	libhmac_internal_sha224_context_t *internal_context = NULL;
+	static char *function                               = "libhmac_sha224_context_update";
+	unsigned long safe_hash_size                        = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	internal_context = (libhmac_internal_sha224_context_t *) context;
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+#if ( SIZEOF_LONG < SIZEOF_SIZE_T )
+	if( size > (size_t) ULONG_MAX )
+#else
+	if( size > (size_t) SSIZE_MAX )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == 0 )
+	{
+		return( 1 );
+	}
+	safe_hash_size = (unsigned long) size;
+
+	if( SHA256_Update(
+	     &( internal_context->sha224_context ),
+	     (const void *) buffer,
+	     size ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update context.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#elif defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_SHA224 )
+
+/* Updates the SHA-224 context using OpenSSL EVP
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_sha224_context_update(
+     libhmac_sha224_context_t *context,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	libhmac_internal_sha224_context_t *internal_context = NULL;
+	static char *function                               = "libhmac_sha224_context_update";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	internal_context = (libhmac_internal_sha224_context_t *) context;
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == 0 )
+	{
+		return( 1 );
+	}
+	if( EVP_DigestUpdate(
+	     internal_context->evp_md_context,
+	     (const void *) buffer,
+	     size ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update context.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#else
+
+/* Updates the SHA-224 context using fallback implementation
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_sha224_context_update(
+     libhmac_sha224_context_t *context,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	libhmac_internal_sha224_context_t *internal_context = NULL;
+	static char *function                               = "libhmac_sha224_context_update";
+	size_t buffer_offset                                = 0;
+	size_t remaining_block_size                         = 0;
+	ssize_t process_count                               = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	internal_context = (libhmac_internal_sha224_context_t *) context;
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == 0 )
+	{
+		return( 1 );
+	}
+	if( internal_context->block_offset > 0 )
+	{
+		if( internal_context->block_offset >= LIBHMAC_SHA224_BLOCK_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid context - block offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		remaining_block_size = LIBHMAC_SHA224_BLOCK_SIZE - internal_context->block_offset;
+
 		if( remaining_block_size > size )
 		{
 			remaining_block_size = size;
 		}
 		if( memory_copy(
-		     &( internal_context->block[ internal_context->block_offset ] ),
-		     buffer,
-		     remaining_block_size ) == NULL )
+		     &( internal_context->block[ internal_context->block_offset ] ),
+		     buffer,
+		     remaining_block_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data to context block.",
+			 function );
+
+			return( -1 );
+		}
+		internal_context->block_offset += remaining_block_size;
+
+		if( internal_context->block_offset < LIBHMAC_SHA224_BLOCK_SIZE )
+		{
+			return( 1 );
+		}
+		buffer_offset += remaining_block_size;
+		size          -= remaining_block_size;
+
+		process_count = libhmac_sha224_context_transform(
+		                 internal_context,
+		                 internal_context->block,
+		                 LIBHMAC_SHA224_BLOCK_SIZE,
+		                 error );
+
+		if( process_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to transform context block.",
+			 function );
+
+			return( -1 );
+		}
+		internal_context->hash_count  += process_count;
+		internal_context->block_offset = 0;
+	}
+	if( size > 0 )
+	{
+		process_count = libhmac_sha224_context_transform(
+		                 internal_context,
+		                 &( buffer[ buffer_offset ] ),
+		                 size,
+		                 error );
+
+		if( process_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to transform buffer.",
+			 function );
+
+			return( -1 );
+		}
+		internal_context->hash_count += process_count;
+
+		buffer_offset += process_count;
+		size          -= process_count;
+	}
+	if( size > 0 )
+	{
+		if( size >= LIBHMAC_SHA224_BLOCK_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     internal_context->block,
+		     &( buffer[ buffer_offset ] ),
+		     size ) == NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_MEMORY,
 			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy data to context block.",
+			 "%s: unable to copy remaining data to context block.",
+			 function );
+
+			return( -1 );
+		}
+		internal_context->block_offset = size;
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_SHA_H ) && defined( SHA224_DIGEST_LENGTH ) */
+
+/* Updates the SHA-224 context using multiple buffers
+ * The buffers are hashed as if they were a single contiguous buffer, where only
+ * the data that crosses a block boundary is copied into the context block
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_sha224_context_update_iov(
+     libhmac_sha224_context_t *context,
+     const uint8_t **buffers,
+     const size_t *sizes,
+     int number_of_buffers,
+     libcerror_error_t **error )
+{
+	libhmac_internal_sha224_context_t *internal_context = NULL;
+	static char *function                               = "libhmac_sha224_context_update_iov";
+	int buffer_index                                    = 0;
+
+#if !defined( LIBHMAC_HAVE_SHA224_SUPPORT )
+	const uint8_t *buffer                               = NULL;
+	size_t buffer_offset                                = 0;
+	size_t remaining_block_size                         = 0;
+	size_t size                                         = 0;
+	ssize_t process_count                               = 0;
+#endif
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	internal_context = (libhmac_internal_sha224_context_t *) context;
+
+	if( buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffers.",
+		 function );
+
+		return( -1 );
+	}
+	if( sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_buffers < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of buffers value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	/* All the buffers are checked before any of them is hashed
+	 * so that the context is not partially updated on error
+	 */
+	for( buffer_index = 0;
+	     buffer_index < number_of_buffers;
+	     buffer_index++ )
+	{
+		if( buffers[ buffer_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid buffer: %d.",
+			 function,
+			 buffer_index );
+
+			return( -1 );
+		}
+		if( sizes[ buffer_index ] > (size_t) SSIZE_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid size: %d value exceeds maximum.",
+			 function,
+			 buffer_index );
+
+			return( -1 );
+		}
+	}
+	for( buffer_index = 0;
+	     buffer_index < number_of_buffers;
+	     buffer_index++ )
+	{
+		if( sizes[ buffer_index ] == 0 )
+		{
+			continue;
+		}
+#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_SHA_H ) && defined( SHA224_DIGEST_LENGTH )
+		if( SHA256_Update(
+		     &( internal_context->sha224_context ),
+		     (const void *) buffers[ buffer_index ],
+		     sizes[ buffer_index ] ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update context.",
+			 function );
+
+			return( -1 );
+		}
+#elif defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_SHA224 )
+		if( EVP_DigestUpdate(
+		     internal_context->evp_md_context,
+		     (const void *) buffers[ buffer_index ],
+		     sizes[ buffer_index ] ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update context.",
 			 function );
 
-			return( -1 );
-		}
-		internal_context->block_offset += remaining_block_size;
+			return( -1 );
+		}
+#else
+		buffer        = buffers[ buffer_index ];
+		size          = sizes[ buffer_index ];
+		buffer_offset = 0;
+
+		if( internal_context->block_offset > 0 )
+		{
+			if( internal_context->block_offset >= LIBHMAC_SHA224_BLOCK_SIZE )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid context - block offset value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			/* Stitch the start of the buffer to the data of the previous buffers
+			 */
+			remaining_block_size = LIBHMAC_SHA224_BLOCK_SIZE - internal_context->block_offset;
+
+			if( remaining_block_size > size )
+			{
+				remaining_block_size = size;
+			}
+			if( memory_copy(
+			     &( internal_context->block[ internal_context->block_offset ] ),
+			     buffer,
+			     remaining_block_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy data to context block.",
+				 function );
+
+				return( -1 );
+			}
+			internal_context->block_offset += remaining_block_size;
+
+			if( internal_context->block_offset < LIBHMAC_SHA224_BLOCK_SIZE )
+			{
+				continue;
+			}
+			buffer_offset += remaining_block_size;
+			size          -= remaining_block_size;
+
+			process_count = libhmac_sha224_context_transform(
+			                 internal_context,
+			                 internal_context->block,
+			                 LIBHMAC_SHA224_BLOCK_SIZE,
+			                 error );
+
+			if( process_count == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to transform context block.",
+				 function );
+
+				return( -1 );
+			}
+			internal_context->hash_count  += process_count;
+			internal_context->block_offset = 0;
+		}
+		/* The whole blocks are transformed directly from the buffer
+		 */
+		if( size >= LIBHMAC_SHA224_BLOCK_SIZE )
+		{
+			process_count = libhmac_sha224_context_transform(
+			                 internal_context,
+			                 &( buffer[ buffer_offset ] ),
+			                 size,
+			                 error );
+
+			if( process_count == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to transform buffer: %d.",
+				 function,
+				 buffer_index );
+
+				return( -1 );
+			}
+			internal_context->hash_count += process_count;
+
+			buffer_offset += process_count;
+			size          -= process_count;
+		}
+		if( size > 0 )
+		{
+			if( size >= LIBHMAC_SHA224_BLOCK_SIZE )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid size value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			if( memory_copy(
+			     internal_context->block,
+			     &( buffer[ buffer_offset ] ),
+			     size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy remaining data to context block.",
+				 function );
+
+				return( -1 );
+			}
+			internal_context->block_offset = size;
+		}
+#endif /* defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_SHA_H ) && defined( SHA224_DIGEST_LENGTH ) */
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_SHA_H ) && defined( SHA224_DIGEST_LENGTH )
+
+/* Finalizes the SHA-224 context using OpenSSL
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_sha224_context_finalize(
+     libhmac_sha224_context_t *context,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error )
+{
+	libhmac_internal_sha224_context_t *internal_context = NULL;
+	static char *function                               = "libhmac_sha224_context_finalize";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	internal_context = (libhmac_internal_sha224_context_t *) context;
+
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid hash size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_size < (size_t) LIBHMAC_SHA224_HASH_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid hash size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( SHA256_Final(
+	     hash,
+	     &( internal_context->sha224_context ) ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize context.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#elif defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_SHA224 )
+
+/* Finalizes the SHA-224 context using OpenSSL EVP
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_sha224_context_finalize(
+     libhmac_sha224_context_t *context,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error )
+{
+	libhmac_internal_sha224_context_t *internal_context = NULL;
+	static char *function                               = "libhmac_sha224_context_finalize";
+	unsigned int safe_hash_size                         = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	internal_context = (libhmac_internal_sha224_context_t *) context;
+
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( hash_size < (size_t) LIBHMAC_SHA224_HASH_SIZE )
+	 || ( hash_size > (size_t) UINT_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid hash size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	safe_hash_size = (unsigned int) hash_size;
+
+	if( EVP_DigestFinal_ex(
+	     internal_context->evp_md_context,
+	     (unsigned char *) hash,
+	     &safe_hash_size ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize context.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
 
-		if( internal_context->block_offset < LIBHMAC_SHA224_BLOCK_SIZE )
-		{
-			return( 1 );
-		}
-		buffer_offset += remaining_block_size;
-		size          -= remaining_block_size;
+#else
 
-		process_count = libhmac_sha224_context_transform(
-		                 internal_context,
-		                 internal_context->block,
-		                 LIBHMAC_SHA224_BLOCK_SIZE,
-		                 error );
+/* Finalizes the SHA-224 context using fallback implementation
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_sha224_context_finalize(
+     libhmac_sha224_context_t *context,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error )
+{
+	libhmac_internal_sha224_context_t *internal_context = NULL;
+	static char *function                               = "libhmac_sha224_context_finalize";
+	size_t block_size                                   = 0;
+	size_t number_of_blocks                             = 0;
+	ssize_t process_count                               = 0;
+	uint64_t bit_size                                   = 0;
 
-		if( process_count == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to transform context block.",
-			 function );
+#if !defined( LIBHMAC_UNFOLLED_LOOPS )
+	size_t hash_index                                   = 0;
+	int hash_values_index                               = 0;
+#endif
 
-			return( -1 );
-		}
-		internal_context->hash_count  += process_count;
-		internal_context->block_offset = 0;
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
 	}
-	if( size > 0 )
+	internal_context = (libhmac_internal_sha224_context_t *) context;
+
+	if( hash == NULL )
 	{
-		process_count = libhmac_sha224_context_transform(
-		                 internal_context,
-		                 &( buffer[ buffer_offset ] ),
-		                 size,
-		                 error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
 
-		if( process_count == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to transform buffer.",
-			 function );
+		return( -1 );
+	}
+	if( hash_size < (size_t) LIBHMAC_SHA224_HASH_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid hash value too small.",
+		 function );
 
-			return( -1 );
-		}
-		internal_context->hash_count += process_count;
+		return( -1 );
+	}
+	if( hash_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid hash size value exceeds maximum.",
+		 function );
 
-		buffer_offset += process_count;
-		size          -= process_count;
+		return( -1 );
 	}
-	if( size > 0 )
+	if( hash_size < (size_t) LIBHMAC_SHA224_HASH_SIZE )
 	{
-		if( size >= LIBHMAC_SHA224_BLOCK_SIZE )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid size value out of bounds.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid hash size value too small.",
+		 function );
 
-			return( -1 );
-		}
-		if( memory_copy(
-		     internal_context->block,
-		     &( buffer[ buffer_offset ] ),
-		     size ) == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy remaining data to context block.",
-			 function );
+		return( -1 );
+	}
+	/* Add padding with a size of 56 mod 64
+	 */
+	number_of_blocks = 1;
 
-			return( -1 );
-		}
-		internal_context->block_offset = size;
+	if( internal_context->block_offset > 55 )
+	{
+		number_of_blocks += 1;
+	}
+	block_size = number_of_blocks * LIBHMAC_SHA224_BLOCK_SIZE;
+
+	if( memory_set(
+	     &( internal_context->block[ internal_context->block_offset ] ),
+	     0,
+	     block_size - internal_context->block_offset ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear context block.",
+		 function );
+
+		return( -1 );
+	}
+	/* The first byte of the padding contains 0x80
+	 */
+	internal_context->block[ internal_context->block_offset ] = 0x80;
+
+	bit_size = ( internal_context->hash_count + internal_context->block_offset ) * 8;
+
+	byte_stream_copy_from_uint64_big_endian(
+	 &( internal_context->block[ block_size - 8 ] ),
+	 bit_size );
+
+	process_count = libhmac_sha224_context_transform(
+	                 internal_context,
+	                 internal_context->block,
+	                 block_size,
+	                 error );
+
+	if( process_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to transform context block.",
+		 function );
+
+		return( -1 );
+	}
+	/* Note that hash_values[ 7 ] is omitted from the hash */
+#if !defined( LIBHMAC_UNFOLLED_LOOPS )
+	for( hash_values_index = 0;
+	     hash_values_index < 7;
+	     hash_values_index++ )
+	{
+		byte_stream_copy_from_uint32_big_endian(
+		 &( hash[ hash_index ] ),
+		 internal_context->hash_values[ hash_values_index ] );
+
+		hash_index += sizeof( uint32_t );
+	}
+#else
+	byte_stream_copy_from_uint32_big_endian(
+	 &( hash[ 0 ] ),
+	 internal_context->hash_values[ 0 ] );
+
+	byte_stream_copy_from_uint32_big_endian(
+	 &( hash[ 4 ] ),
+	 internal_context->hash_values[ 1 ] );
+
+	byte_stream_copy_from_uint32_big_endian(
+	 &( hash[ 8 ] ),
+	 internal_context->hash_values[ 2 ] );
+
+	byte_stream_copy_from_uint32_big_endian(
+	 &( hash[ 12 ] ),
+	 internal_context->hash_values[ 3 ] );
+
+	byte_stream_copy_from_uint32_big_endian(
+	 &( hash[ 16 ] ),
+	 internal_context->hash_values[ 4 ] );
+
+	byte_stream_copy_from_uint32_big_endian(
+	 &( hash[ 20 ] ),
+	 internal_context->hash_values[ 5 ] );
+
+	byte_stream_copy_from_uint32_big_endian(
+	 &( hash[ 24 ] ),
+	 internal_context->hash_values[ 6 ] );
+
+#endif /* !defined( LIBHMAC_UNFOLLED_LOOPS ) */
+
+	/* Prevent sensitive data from leaking
+	 */
+	if( memory_set(
+	     internal_context,
+	     0,
+	     sizeof( libhmac_internal_sha224_context_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear context.",
+		 function );
+
+		return( -1 );
 	}
 	return( 1 );
 }
 
 #endif /* defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_SHA_H ) && defined( SHA224_DIGEST_LENGTH ) */
 
-#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_SHA_H ) && defined( SHA224_DIGEST_LENGTH )
+#if defined( LIBHMAC_HAVE_SHA224_SUPPORT )
 
-/* Finalizes the SHA-224 context using OpenSSL
- * Returns 1 if successful or -1 on error
+/* Exports the SHA-224 context state using OpenSSL
+ * The state of an OpenSSL context is opaque and cannot be exported
+ * Returns -1 on error
  */
-int libhmac_sha224_context_finalize(
+int libhmac_sha224_context_export_state(
      libhmac_sha224_context_t *context,
-     uint8_t *hash,
-     size_t hash_size,
+     uint8_t *state,
+     size_t state_size,
      libcerror_error_t **error )
 {
-	libhmac_internal_sha224_context_t *internal_context = NULL;
-	static char *function                               = "libhmac_sha224_context_finalize";
+	static char *function = "libhmac_sha224_context_export_state";
 
 	if( context == NULL )
 	{
@@ -1030,71 +2336,110 @@ int libhmac_sha224_context_finalize(
 
 		return( -1 );
 	}
-	internal_context = (libhmac_internal_sha224_context_t *) context;
-
-	if( hash == NULL )
+	if( state == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid hash.",
+		 "%s: invalid state.",
 		 function );
 
 		return( -1 );
 	}
-	if( hash_size > (size_t) SSIZE_MAX )
+	if( state_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid hash size value exceeds maximum.",
+		 "%s: invalid state size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( hash_size < (size_t) LIBHMAC_SHA224_HASH_SIZE )
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: exporting the state of an OpenSSL context is not supported.",
+	 function );
+
+	return( -1 );
+}
+
+/* Imports the SHA-224 context state using OpenSSL
+ * The state of an OpenSSL context is opaque and cannot be imported
+ * Returns -1 on error
+ */
+int libhmac_sha224_context_import_state(
+     libhmac_sha224_context_t *context,
+     const uint8_t *state,
+     size_t state_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libhmac_sha224_context_import_state";
+
+	if( context == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: invalid hash size value too small.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
 		 function );
 
 		return( -1 );
 	}
-	if( SHA256_Final(
-	     hash,
-	     &( internal_context->sha224_context ) ) != 1 )
+	if( state == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to finalize context.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid state.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
+	if( state_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid state size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: importing the state of an OpenSSL context is not supported.",
+	 function );
+
+	return( -1 );
 }
 
-#elif defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_SHA224 )
+#else
 
-/* Finalizes the SHA-224 context using OpenSSL EVP
+/* Exports the SHA-224 context state using fallback implementation
+ * The state contains the data hashed so far, including the data of a partial block,
+ * and can be imported to continue hashing, for example in another process
  * Returns 1 if successful or -1 on error
  */
-int libhmac_sha224_context_finalize(
+int libhmac_sha224_context_export_state(
      libhmac_sha224_context_t *context,
-     uint8_t *hash,
-     size_t hash_size,
+     uint8_t *state,
+     size_t state_size,
      libcerror_error_t **error )
 {
 	libhmac_internal_sha224_context_t *internal_context = NULL;
-	static char *function                               = "libhmac_sha224_context_finalize";
-	unsigned int safe_hash_size                         = 0;
+	static char *function                               = "libhmac_sha224_context_export_state";
+	size_t state_offset                                 = 0;
+	int value_index                                     = 0;
 
 	if( context == NULL )
 	{
@@ -1109,70 +2454,138 @@ int libhmac_sha224_context_finalize(
 	}
 	internal_context = (libhmac_internal_sha224_context_t *) context;
 
-	if( hash == NULL )
+	if( internal_context->block_offset >= LIBHMAC_SHA224_BLOCK_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid context - block offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( state == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid hash.",
+		 "%s: invalid state.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( hash_size < (size_t) LIBHMAC_SHA224_HASH_SIZE )
-	 || ( hash_size > (size_t) UINT_MAX ) )
+	if( state_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid hash size value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid state size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	safe_hash_size = (unsigned int) hash_size;
+	if( state_size < (size_t) LIBHMAC_SHA224_CONTEXT_STATE_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid state size value too small.",
+		 function );
 
-	if( EVP_DigestFinal_ex(
-	     internal_context->evp_md_context,
-	     (unsigned char *) hash,
-	     &safe_hash_size ) != 1 )
+		return( -1 );
+	}
+	if( memory_set(
+	     state,
+	     0,
+	     LIBHMAC_SHA224_CONTEXT_STATE_SIZE ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to finalize context.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear state.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     state,
+	     LIBHMAC_CONTEXT_STATE_SIGNATURE,
+	     4 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature to state.",
 		 function );
 
 		return( -1 );
 	}
+	state[ 4 ] = LIBHMAC_CONTEXT_STATE_FORMAT_VERSION;
+	state[ 5 ] = LIBHMAC_HASH_ALGORITHM_SHA224;
+
+	byte_stream_copy_from_uint16_big_endian(
+	 &( state[ 6 ] ),
+	 (uint16_t) internal_context->block_offset );
+
+	byte_stream_copy_from_uint64_big_endian(
+	 &( state[ 8 ] ),
+	 internal_context->hash_count );
+
+	state_offset = 16;
+
+	for( value_index = 0;
+	     value_index < 8;
+	     value_index++ )
+	{
+		byte_stream_copy_from_uint32_big_endian(
+		 &( state[ state_offset ] ),
+		 internal_context->hash_values[ value_index ] );
+
+		state_offset += 4;
+	}
+	if( internal_context->block_offset > 0 )
+	{
+		if( memory_copy(
+		     &( state[ state_offset ] ),
+		     internal_context->block,
+		     internal_context->block_offset ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy block to state.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	return( 1 );
 }
 
-#else
-
-/* Finalizes the SHA-224 context using fallback implementation
+/* Imports the SHA-224 context state using fallback implementation
+ * The state must have been exported with libhmac_sha224_context_export_state
+ * The context is not modified if the state is not valid
  * Returns 1 if successful or -1 on error
  */
-int libhmac_sha224_context_finalize(
+int libhmac_sha224_context_import_state(
      libhmac_sha224_context_t *context,
-     uint8_t *hash,
-     size_t hash_size,
+     const uint8_t *state,
+     size_t state_size,
      libcerror_error_t **error )
 {
 	libhmac_internal_sha224_context_t *internal_context = NULL;
-	static char *function                               = "libhmac_sha224_context_finalize";
-	size_t block_size                                   = 0;
-	size_t number_of_blocks                             = 0;
-	ssize_t process_count                               = 0;
-	uint64_t bit_size                                   = 0;
-
-#if !defined( LIBHMAC_UNFOLLED_LOOPS )
-	size_t hash_index                                   = 0;
-	int hash_values_index                               = 0;
-#endif
+	static char *function                               = "libhmac_sha224_context_import_state";
+	size_t state_offset                                 = 0;
+	uint64_t hash_count                                 = 0;
+	uint16_t block_offset                               = 0;
+	int value_index                                     = 0;
 
 	if( context == NULL )
 	{
@@ -1187,162 +2600,137 @@ int libhmac_sha224_context_finalize(
 	}
 	internal_context = (libhmac_internal_sha224_context_t *) context;
 
-	if( hash == NULL )
+	if( state == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid hash.",
+		 "%s: invalid state.",
 		 function );
 
 		return( -1 );
 	}
-	if( hash_size < (size_t) LIBHMAC_SHA224_HASH_SIZE )
+	if( state_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: invalid hash value too small.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid state size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( hash_size > (size_t) SSIZE_MAX )
+	if( state_size < (size_t) LIBHMAC_SHA224_CONTEXT_STATE_SIZE )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid hash size value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid state size value too small.",
 		 function );
 
 		return( -1 );
 	}
-	if( hash_size < (size_t) LIBHMAC_SHA224_HASH_SIZE )
+	if( memory_compare(
+	     state,
+	     LIBHMAC_CONTEXT_STATE_SIGNATURE,
+	     4 ) != 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: invalid hash size value too small.",
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid state - unsupported signature.",
 		 function );
 
 		return( -1 );
 	}
-	/* Add padding with a size of 56 mod 64
-	 */
-	number_of_blocks = 1;
-
-	if( internal_context->block_offset > 55 )
+	if( state[ 4 ] != LIBHMAC_CONTEXT_STATE_FORMAT_VERSION )
 	{
-		number_of_blocks += 1;
-	}
-	block_size = number_of_blocks * LIBHMAC_SHA224_BLOCK_SIZE;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid state - unsupported format version: %" PRIu8 ".",
+		 function,
+		 state[ 4 ] );
 
-	if( memory_set(
-	     &( internal_context->block[ internal_context->block_offset ] ),
-	     0,
-	     block_size - internal_context->block_offset ) == NULL )
+		return( -1 );
+	}
+	if( state[ 5 ] != LIBHMAC_HASH_ALGORITHM_SHA224 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear context block.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid state - unsupported hash algorithm: %" PRIu8 ".",
+		 function,
+		 state[ 5 ] );
 
 		return( -1 );
 	}
-	/* The first byte of the padding contains 0x80
-	 */
-	internal_context->block[ internal_context->block_offset ] = 0x80;
-
-	bit_size = ( internal_context->hash_count + internal_context->block_offset ) * 8;
-
-	byte_stream_copy_from_uint64_big_endian(
-	 &( internal_context->block[ block_size - 8 ] ),
-	 bit_size );
+	byte_stream_copy_to_uint16_big_endian(
+	 &( state[ 6 ] ),
+	 block_offset );
 
-	process_count = libhmac_sha224_context_transform(
-	                 internal_context,
-	                 internal_context->block,
-	                 block_size,
-	                 error );
+	byte_stream_copy_to_uint64_big_endian(
+	 &( state[ 8 ] ),
+	 hash_count );
 
-	if( process_count == -1 )
+	if( block_offset >= LIBHMAC_SHA224_BLOCK_SIZE )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to transform context block.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid state - block offset value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	/* Note that hash_values[ 7 ] is omitted from the hash */
-#if !defined( LIBHMAC_UNFOLLED_LOOPS )
-	for( hash_values_index = 0;
-	     hash_values_index < 7;
-	     hash_values_index++ )
+	if( ( hash_count % LIBHMAC_SHA224_BLOCK_SIZE ) != 0 )
 	{
-		byte_stream_copy_from_uint32_big_endian(
-		 &( hash[ hash_index ] ),
-		 internal_context->hash_values[ hash_values_index ] );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid state - hash count value not a multiple of the block size.",
+		 function );
 
-		hash_index += sizeof( uint32_t );
+		return( -1 );
 	}
-#else
-	byte_stream_copy_from_uint32_big_endian(
-	 &( hash[ 0 ] ),
-	 internal_context->hash_values[ 0 ] );
-
-	byte_stream_copy_from_uint32_big_endian(
-	 &( hash[ 4 ] ),
-	 internal_context->hash_values[ 1 ] );
-
-	byte_stream_copy_from_uint32_big_endian(
-	 &( hash[ 8 ] ),
-	 internal_context->hash_values[ 2 ] );
+	state_offset = 16;
 
-	byte_stream_copy_from_uint32_big_endian(
-	 &( hash[ 12 ] ),
-	 internal_context->hash_values[ 3 ] );
-
-	byte_stream_copy_from_uint32_big_endian(
-	 &( hash[ 16 ] ),
-	 internal_context->hash_values[ 4 ] );
-
-	byte_stream_copy_from_uint32_big_endian(
-	 &( hash[ 20 ] ),
-	 internal_context->hash_values[ 5 ] );
-
-	byte_stream_copy_from_uint32_big_endian(
-	 &( hash[ 24 ] ),
-	 internal_context->hash_values[ 6 ] );
-
-#endif /* !defined( LIBHMAC_UNFOLLED_LOOPS ) */
+	for( value_index = 0;
+	     value_index < 8;
+	     value_index++ )
+	{
+		byte_stream_copy_to_uint32_big_endian(
+		 &( state[ state_offset ] ),
+		 internal_context->hash_values[ value_index ] );
 
-	/* Prevent sensitive data from leaking
-	 */
-	if( memory_set(
-	     internal_context,
-	     0,
-	     sizeof( libhmac_internal_sha224_context_t ) ) == NULL )
+		state_offset += 4;
+	}
+	if( memory_copy(
+	     internal_context->block,
+	     &( state[ state_offset ] ),
+	     LIBHMAC_SHA224_BLOCK_SIZE ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear context.",
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy block from state.",
 		 function );
 
 		return( -1 );
 	}
+	internal_context->hash_count   = hash_count;
+	internal_context->block_offset = (size_t) block_offset;
+
 	return( 1 );
 }
 
-#endif /* defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_SHA_H ) && defined( SHA224_DIGEST_LENGTH ) */
-
+#endif /* defined( LIBHMAC_HAVE_SHA224_SUPPORT ) */
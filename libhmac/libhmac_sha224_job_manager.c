@@ -0,0 +1,933 @@
+/*
+ * SHA-224 job manager functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libhmac_definitions.h"
+#include "libhmac_libcerror.h"
+#include "libhmac_sha224.h"
+#include "libhmac_sha224_context.h"
+#include "libhmac_sha224_job_manager.h"
+#include "libhmac_sha256_context.h"
+#include "libhmac_sha256_multi_buffer.h"
+
+/* The initial number of allocated completed jobs
+ */
+#define LIBHMAC_SHA224_JOB_MANAGER_INITIAL_NUMBER_OF_COMPLETED_JOBS	16
+
+/* Creates a SHA-224 job manager
+ * Make sure the value job_manager is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_sha224_job_manager_initialize(
+     libhmac_sha224_job_manager_t **job_manager,
+     libcerror_error_t **error )
+{
+	libhmac_internal_sha224_job_manager_t *internal_job_manager = NULL;
+	static char *function                                       = "libhmac_sha224_job_manager_initialize";
+
+#if !defined( LIBHMAC_HAVE_SHA224_SUPPORT ) && !defined( LIBHMAC_HAVE_SHA256_SUPPORT )
+	int result                                                  = 0;
+#endif
+
+	if( job_manager == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid job manager.",
+		 function );
+
+		return( -1 );
+	}
+	if( *job_manager != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid job manager value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_job_manager = memory_allocate_structure(
+	                        libhmac_internal_sha224_job_manager_t );
+
+	if( internal_job_manager == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create job manager.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_job_manager,
+	     0,
+	     sizeof( libhmac_internal_sha224_job_manager_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear job manager.",
+		 function );
+
+		memory_free(
+		 internal_job_manager );
+
+		return( -1 );
+	}
+#if !defined( LIBHMAC_HAVE_SHA224_SUPPORT ) && !defined( LIBHMAC_HAVE_SHA256_SUPPORT )
+	result = libhmac_sha256_multi_buffer_scheduler_initialize(
+	          &( internal_job_manager->scheduler ),
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize scheduler.",
+		 function );
+
+		goto on_error;
+	}
+	internal_job_manager->use_scheduler = (uint8_t) result;
+
+#endif /* !defined( LIBHMAC_HAVE_SHA224_SUPPORT ) && !defined( LIBHMAC_HAVE_SHA256_SUPPORT ) */
+
+	*job_manager = (libhmac_sha224_job_manager_t *) internal_job_manager;
+
+	return( 1 );
+
+on_error:
+	if( internal_job_manager != NULL )
+	{
+		memory_free(
+		 internal_job_manager );
+	}
+	return( -1 );
+}
+
+/* Frees a SHA-224 job manager
+ * Jobs that have not been flushed are discarded
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_sha224_job_manager_free(
+     libhmac_sha224_job_manager_t **job_manager,
+     libcerror_error_t **error )
+{
+	libhmac_internal_sha224_job_manager_t *internal_job_manager = NULL;
+	static char *function                                       = "libhmac_sha224_job_manager_free";
+	int result                                                  = 1;
+
+	if( job_manager == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid job manager.",
+		 function );
+
+		return( -1 );
+	}
+	if( *job_manager != NULL )
+	{
+		internal_job_manager = (libhmac_internal_sha224_job_manager_t *) *job_manager;
+		*job_manager         = NULL;
+
+		if( internal_job_manager->completed_jobs != NULL )
+		{
+			/* Prevent sensitive data from leaking
+			 */
+			if( memory_set(
+			     internal_job_manager->completed_jobs,
+			     0,
+			     sizeof( libhmac_sha224_job_manager_completed_job_t ) * internal_job_manager->number_of_allocated_completed_jobs ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear completed jobs.",
+				 function );
+
+				result = -1;
+			}
+			memory_free(
+			 internal_job_manager->completed_jobs );
+		}
+		if( memory_set(
+		     internal_job_manager,
+		     0,
+		     sizeof( libhmac_internal_sha224_job_manager_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear job manager.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_job_manager );
+	}
+	return( result );
+}
+
+/* Appends a completed job
+ * The completed jobs are kept in order of completion
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_sha224_job_manager_append_completed_job(
+     libhmac_internal_sha224_job_manager_t *internal_job_manager,
+     intptr_t *user_data,
+     libhmac_sha224_job_manager_completed_job_t **completed_job,
+     libcerror_error_t **error )
+{
+	libhmac_sha224_job_manager_completed_job_t *completed_jobs = NULL;
+	static char *function                                      = "libhmac_sha224_job_manager_append_completed_job";
+	size_t completed_jobs_size                                 = 0;
+	int completed_job_index                                    = 0;
+	int number_of_allocated_completed_jobs                     = 0;
+
+	if( internal_job_manager == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid job manager.",
+		 function );
+
+		return( -1 );
+	}
+	if( completed_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid completed job.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_job_manager->completed_jobs_index + internal_job_manager->number_of_completed_jobs ) >= internal_job_manager->number_of_allocated_completed_jobs )
+	{
+		if( internal_job_manager->completed_jobs_index > 0 )
+		{
+			/* Move the completed jobs to the start of the allocated completed jobs
+			 */
+			for( completed_job_index = 0;
+			     completed_job_index < internal_job_manager->number_of_completed_jobs;
+			     completed_job_index++ )
+			{
+				internal_job_manager->completed_jobs[ completed_job_index ] = internal_job_manager->completed_jobs[ internal_job_manager->completed_jobs_index + completed_job_index ];
+			}
+			if( memory_set(
+			     &( internal_job_manager->completed_jobs[ internal_job_manager->number_of_completed_jobs ] ),
+			     0,
+			     sizeof( libhmac_sha224_job_manager_completed_job_t ) * internal_job_manager->completed_jobs_index ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear moved completed jobs.",
+				 function );
+
+				return( -1 );
+			}
+			internal_job_manager->completed_jobs_index = 0;
+		}
+		else
+		{
+			if( internal_job_manager->number_of_allocated_completed_jobs == 0 )
+			{
+				number_of_allocated_completed_jobs = LIBHMAC_SHA224_JOB_MANAGER_INITIAL_NUMBER_OF_COMPLETED_JOBS;
+			}
+			else if( internal_job_manager->number_of_allocated_completed_jobs > ( INT_MAX / 2 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid number of allocated completed jobs value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			else
+			{
+				number_of_allocated_completed_jobs = internal_job_manager->number_of_allocated_completed_jobs * 2;
+			}
+			completed_jobs_size = sizeof( libhmac_sha224_job_manager_completed_job_t ) * number_of_allocated_completed_jobs;
+
+			if( completed_jobs_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid completed jobs size value exceeds maximum.",
+				 function );
+
+				return( -1 );
+			}
+			/* The completed jobs are not reallocated so that the hashes in the previous
+			 * allocation can be cleared
+			 */
+			completed_jobs = (libhmac_sha224_job_manager_completed_job_t *) memory_allocate(
+			                                                                 completed_jobs_size );
+
+			if( completed_jobs == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create completed jobs.",
+				 function );
+
+				return( -1 );
+			}
+			if( memory_set(
+			     completed_jobs,
+			     0,
+			     completed_jobs_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear completed jobs.",
+				 function );
+
+				memory_free(
+				 completed_jobs );
+
+				return( -1 );
+			}
+			if( internal_job_manager->completed_jobs != NULL )
+			{
+				if( memory_copy(
+				     completed_jobs,
+				     internal_job_manager->completed_jobs,
+				     sizeof( libhmac_sha224_job_manager_completed_job_t ) * internal_job_manager->number_of_completed_jobs ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy completed jobs.",
+					 function );
+
+					memory_free(
+					 completed_jobs );
+
+					return( -1 );
+				}
+				if( memory_set(
+				     internal_job_manager->completed_jobs,
+				     0,
+				     sizeof( libhmac_sha224_job_manager_completed_job_t ) * internal_job_manager->number_of_allocated_completed_jobs ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+					 "%s: unable to clear previous completed jobs.",
+					 function );
+
+					memory_free(
+					 completed_jobs );
+
+					return( -1 );
+				}
+				memory_free(
+				 internal_job_manager->completed_jobs );
+			}
+			internal_job_manager->completed_jobs                     = completed_jobs;
+			internal_job_manager->number_of_allocated_completed_jobs = number_of_allocated_completed_jobs;
+		}
+	}
+	completed_job_index = internal_job_manager->completed_jobs_index + internal_job_manager->number_of_completed_jobs;
+
+	internal_job_manager->completed_jobs[ completed_job_index ].user_data = user_data;
+
+	internal_job_manager->number_of_completed_jobs += 1;
+
+	*completed_job = &( internal_job_manager->completed_jobs[ completed_job_index ] );
+
+	return( 1 );
+}
+
+#if !defined( LIBHMAC_HAVE_SHA224_SUPPORT ) && !defined( LIBHMAC_HAVE_SHA256_SUPPORT )
+
+/* Moves the jobs of the lanes with a complete message to the completed jobs
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_sha224_job_manager_complete_lanes(
+     libhmac_internal_sha224_job_manager_t *internal_job_manager,
+     libcerror_error_t **error )
+{
+	uint8_t lane_hash[ LIBHMAC_SHA256_HASH_SIZE ];
+
+	libhmac_sha224_job_manager_completed_job_t *completed_job = NULL;
+	static char *function                                     = "libhmac_sha224_job_manager_complete_lanes";
+	int lane_index                                            = 0;
+
+	if( internal_job_manager == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid job manager.",
+		 function );
+
+		return( -1 );
+	}
+	for( lane_index = 0;
+	     lane_index < internal_job_manager->scheduler.number_of_lanes;
+	     lane_index++ )
+	{
+		if( libhmac_sha256_multi_buffer_scheduler_lane_is_complete(
+		     &( internal_job_manager->scheduler ),
+		     lane_index ) == 0 )
+		{
+			continue;
+		}
+		if( libhmac_sha224_job_manager_append_completed_job(
+		     internal_job_manager,
+		     internal_job_manager->lanes_user_data[ lane_index ],
+		     &completed_job,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append completed job.",
+			 function );
+
+			goto on_error;
+		}
+		if( libhmac_sha256_multi_buffer_scheduler_get_lane_hash(
+		     &( internal_job_manager->scheduler ),
+		     lane_index,
+		     lane_hash,
+		     LIBHMAC_SHA256_HASH_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve hash of lane: %d.",
+			 function,
+			 lane_index );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     completed_job->hash,
+		     lane_hash,
+		     LIBHMAC_SHA224_HASH_SIZE ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy hash of lane: %d.",
+			 function,
+			 lane_index );
+
+			goto on_error;
+		}
+		internal_job_manager->lanes_user_data[ lane_index ] = NULL;
+	}
+	memory_set(
+	 lane_hash,
+	 0,
+	 LIBHMAC_SHA256_HASH_SIZE );
+
+	return( 1 );
+
+on_error:
+	memory_set(
+	 lane_hash,
+	 0,
+	 LIBHMAC_SHA256_HASH_SIZE );
+
+	return( -1 );
+}
+
+#endif /* !defined( LIBHMAC_HAVE_SHA224_SUPPORT ) && !defined( LIBHMAC_HAVE_SHA256_SUPPORT ) */
+
+/* Submits a job to calculate the SHA-224 of the buffer
+ * The job is assigned to a lane of the multi-buffer kernel, when all lanes are in use
+ * the lanes are transformed until at least one of the jobs is completed
+ * The buffer must remain available until the job is completed
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_sha224_job_manager_submit(
+     libhmac_sha224_job_manager_t *job_manager,
+     const uint8_t *buffer,
+     size_t size,
+     intptr_t *user_data,
+     libcerror_error_t **error )
+{
+	libhmac_internal_sha224_job_manager_t *internal_job_manager = NULL;
+	libhmac_sha224_job_manager_completed_job_t *completed_job   = NULL;
+	static char *function                                       = "libhmac_sha224_job_manager_submit";
+
+#if !defined( LIBHMAC_HAVE_SHA224_SUPPORT ) && !defined( LIBHMAC_HAVE_SHA256_SUPPORT )
+	int lane_index                                              = 0;
+#endif
+
+	if( job_manager == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid job manager.",
+		 function );
+
+		return( -1 );
+	}
+	internal_job_manager = (libhmac_internal_sha224_job_manager_t *) job_manager;
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if !defined( LIBHMAC_HAVE_SHA224_SUPPORT ) && !defined( LIBHMAC_HAVE_SHA256_SUPPORT )
+	if( internal_job_manager->use_scheduler != 0 )
+	{
+		if( libhmac_sha256_multi_buffer_scheduler_get_empty_lane(
+		     &( internal_job_manager->scheduler ),
+		     &lane_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve empty lane.",
+			 function );
+
+			return( -1 );
+		}
+		/* The job manager keeps the user data per lane hence the lane index is used as message index
+		 * SHA-224 is SHA-256 with different initial hash values and a truncated hash
+		 */
+		if( libhmac_sha256_multi_buffer_scheduler_set_lane_message_with_state(
+		     &( internal_job_manager->scheduler ),
+		     lane_index,
+		     lane_index,
+		     buffer,
+		     size,
+		     libhmac_sha224_context_prime_square_roots,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set message in lane: %d.",
+			 function,
+			 lane_index );
+
+			return( -1 );
+		}
+		internal_job_manager->lanes_user_data[ lane_index ] = user_data;
+
+		/* Keep at least one lane empty for the next job
+		 */
+		while( internal_job_manager->scheduler.number_of_active_lanes >= internal_job_manager->scheduler.number_of_lanes )
+		{
+			/* When the multi-buffer kernel is never faster than the single-stream
+			 * pair kernel the jobs are transformed two at a time
+			 */
+			if( internal_job_manager->scheduler.number_of_active_lanes < internal_job_manager->scheduler.minimum_number_of_active_lanes )
+			{
+				if( libhmac_sha256_multi_buffer_scheduler_transform_lanes(
+				     &( internal_job_manager->scheduler ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to transform remaining lanes.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			else if( libhmac_sha256_multi_buffer_scheduler_transform(
+			          &( internal_job_manager->scheduler ),
+			          error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to transform lanes.",
+				 function );
+
+				return( -1 );
+			}
+			if( libhmac_sha224_job_manager_complete_lanes(
+			     internal_job_manager,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to complete lanes.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		return( 1 );
+	}
+#endif /* !defined( LIBHMAC_HAVE_SHA224_SUPPORT ) && !defined( LIBHMAC_HAVE_SHA256_SUPPORT ) */
+
+	/* Without a multi-buffer kernel the job is completed immediately
+	 */
+	if( libhmac_sha224_job_manager_append_completed_job(
+	     internal_job_manager,
+	     user_data,
+	     &completed_job,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append completed job.",
+		 function );
+
+		return( -1 );
+	}
+	if( libhmac_sha224_calculate(
+	     buffer,
+	     size,
+	     completed_job->hash,
+	     LIBHMAC_SHA224_HASH_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate SHA-224.",
+		 function );
+
+		internal_job_manager->number_of_completed_jobs -= 1;
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Flushes the SHA-224 job manager
+ * Transforms the lanes until all submitted jobs are completed
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_sha224_job_manager_flush(
+     libhmac_sha224_job_manager_t *job_manager,
+     libcerror_error_t **error )
+{
+	static char *function                                       = "libhmac_sha224_job_manager_flush";
+
+#if !defined( LIBHMAC_HAVE_SHA224_SUPPORT ) && !defined( LIBHMAC_HAVE_SHA256_SUPPORT )
+	libhmac_internal_sha224_job_manager_t *internal_job_manager = NULL;
+#endif
+
+	if( job_manager == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid job manager.",
+		 function );
+
+		return( -1 );
+	}
+#if !defined( LIBHMAC_HAVE_SHA224_SUPPORT ) && !defined( LIBHMAC_HAVE_SHA256_SUPPORT )
+	internal_job_manager = (libhmac_internal_sha224_job_manager_t *) job_manager;
+
+	if( internal_job_manager->use_scheduler == 0 )
+	{
+		return( 1 );
+	}
+	while( internal_job_manager->scheduler.number_of_active_lanes > 0 )
+	{
+		/* When the jobs occupy too few lanes the single-stream kernel
+		 * is faster, hence the remaining blocks are transformed one or two jobs at a time
+		 */
+		if( internal_job_manager->scheduler.number_of_active_lanes < internal_job_manager->scheduler.minimum_number_of_active_lanes )
+		{
+			if( libhmac_sha256_multi_buffer_scheduler_transform_lanes(
+			     &( internal_job_manager->scheduler ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to transform remaining lanes.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else if( libhmac_sha256_multi_buffer_scheduler_transform(
+		          &( internal_job_manager->scheduler ),
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to transform lanes.",
+			 function );
+
+			return( -1 );
+		}
+		if( libhmac_sha224_job_manager_complete_lanes(
+		     internal_job_manager,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to complete lanes.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif /* !defined( LIBHMAC_HAVE_SHA224_SUPPORT ) && !defined( LIBHMAC_HAVE_SHA256_SUPPORT ) */
+
+	return( 1 );
+}
+
+/* Retrieves the number of completed jobs
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_sha224_job_manager_get_number_of_completed_jobs(
+     libhmac_sha224_job_manager_t *job_manager,
+     int *number_of_completed_jobs,
+     libcerror_error_t **error )
+{
+	libhmac_internal_sha224_job_manager_t *internal_job_manager = NULL;
+	static char *function                                       = "libhmac_sha224_job_manager_get_number_of_completed_jobs";
+
+	if( job_manager == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid job manager.",
+		 function );
+
+		return( -1 );
+	}
+	internal_job_manager = (libhmac_internal_sha224_job_manager_t *) job_manager;
+
+	if( number_of_completed_jobs == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of completed jobs.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_completed_jobs = internal_job_manager->number_of_completed_jobs;
+
+	return( 1 );
+}
+
+/* Retrieves the first completed job and removes it from the job manager
+ * The completed jobs are retrieved in order of completion
+ * Returns 1 if successful, 0 if no completed job is available or -1 on error
+ */
+int libhmac_sha224_job_manager_get_completed_job(
+     libhmac_sha224_job_manager_t *job_manager,
+     intptr_t **user_data,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error )
+{
+	libhmac_internal_sha224_job_manager_t *internal_job_manager = NULL;
+	libhmac_sha224_job_manager_completed_job_t *completed_job   = NULL;
+	static char *function                                       = "libhmac_sha224_job_manager_get_completed_job";
+
+	if( job_manager == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid job manager.",
+		 function );
+
+		return( -1 );
+	}
+	internal_job_manager = (libhmac_internal_sha224_job_manager_t *) job_manager;
+
+	if( user_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid user data.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid hash size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_size < (size_t) LIBHMAC_SHA224_HASH_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid hash size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_job_manager->number_of_completed_jobs == 0 )
+	{
+		return( 0 );
+	}
+	completed_job = &( internal_job_manager->completed_jobs[ internal_job_manager->completed_jobs_index ] );
+
+	if( memory_copy(
+	     hash,
+	     completed_job->hash,
+	     LIBHMAC_SHA224_HASH_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy hash.",
+		 function );
+
+		return( -1 );
+	}
+	*user_data = completed_job->user_data;
+
+	/* Prevent sensitive data from leaking
+	 */
+	if( memory_set(
+	     completed_job,
+	     0,
+	     sizeof( libhmac_sha224_job_manager_completed_job_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear completed job.",
+		 function );
+
+		return( -1 );
+	}
+	internal_job_manager->completed_jobs_index     += 1;
+	internal_job_manager->number_of_completed_jobs -= 1;
+
+	if( internal_job_manager->number_of_completed_jobs == 0 )
+	{
+		internal_job_manager->completed_jobs_index = 0;
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,1024 @@
+/*
+ * SHA-224 HMAC key functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libhmac_definitions.h"
+#include "libhmac_libcerror.h"
+#include "libhmac_sha224.h"
+#include "libhmac_sha224_context.h"
+#include "libhmac_sha224_key.h"
+#include "libhmac_sha256_multi_buffer.h"
+
+/* Initializes the SHA-224 HMAC key values in the internal key
+ * The inner and outer padding blocks are hashed once, the resulting states
+ * are reused for every HMAC calculated with the key
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_internal_sha224_key_initialize(
+     libhmac_internal_sha224_key_t *internal_key,
+     const uint8_t *key_data,
+     size_t key_data_size,
+     libcerror_error_t **error )
+{
+	uint8_t key_block[ LIBHMAC_SHA224_BLOCK_SIZE ];
+	uint8_t padding[ LIBHMAC_SHA224_BLOCK_SIZE ];
+
+	static char *function = "libhmac_internal_sha224_key_initialize";
+	size_t block_index    = 0;
+
+	if( internal_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key data.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid key data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     internal_key,
+	     0,
+	     sizeof( libhmac_internal_sha224_key_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear key.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_data_size <= LIBHMAC_SHA224_BLOCK_SIZE )
+	{
+		if( memory_copy(
+		     key_block,
+		     key_data,
+		     key_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy key data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		if( libhmac_sha224_calculate(
+		     key_data,
+		     key_data_size,
+		     key_block,
+		     LIBHMAC_SHA224_HASH_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to calculate key data hash.",
+			 function );
+
+			goto on_error;
+		}
+		key_data_size = LIBHMAC_SHA224_HASH_SIZE;
+	}
+	if( memory_set(
+	     &( key_block[ key_data_size ] ),
+	     0,
+	     LIBHMAC_SHA224_BLOCK_SIZE - key_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear remaining key data.",
+		 function );
+
+		goto on_error;
+	}
+	for( block_index = 0;
+	     block_index < LIBHMAC_SHA224_BLOCK_SIZE;
+	     block_index++ )
+	{
+		padding[ block_index ] = key_block[ block_index ] ^ 0x36;
+	}
+	if( libhmac_internal_sha224_context_initialize(
+	     &( internal_key->inner_context ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize inner context.",
+		 function );
+
+		goto on_error;
+	}
+	if( libhmac_sha224_context_update(
+	     (libhmac_sha224_context_t *) &( internal_key->inner_context ),
+	     padding,
+	     LIBHMAC_SHA224_BLOCK_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update inner context.",
+		 function );
+
+		goto on_error;
+	}
+	for( block_index = 0;
+	     block_index < LIBHMAC_SHA224_BLOCK_SIZE;
+	     block_index++ )
+	{
+		padding[ block_index ] = key_block[ block_index ] ^ 0x5c;
+	}
+	if( libhmac_internal_sha224_context_initialize(
+	     &( internal_key->outer_context ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize outer context.",
+		 function );
+
+		goto on_error;
+	}
+	if( libhmac_sha224_context_update(
+	     (libhmac_sha224_context_t *) &( internal_key->outer_context ),
+	     padding,
+	     LIBHMAC_SHA224_BLOCK_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update outer context.",
+		 function );
+
+		goto on_error;
+	}
+	/* Prevent sensitive data from leaking
+	 */
+	if( memory_set(
+	     padding,
+	     0,
+	     LIBHMAC_SHA224_BLOCK_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear padding.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     key_block,
+	     0,
+	     LIBHMAC_SHA224_BLOCK_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear key block.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	memory_set(
+	 padding,
+	 0,
+	 LIBHMAC_SHA224_BLOCK_SIZE );
+
+	memory_set(
+	 key_block,
+	 0,
+	 LIBHMAC_SHA224_BLOCK_SIZE );
+
+	libhmac_internal_sha224_key_clear(
+	 internal_key,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Clears the SHA-224 HMAC key values in the internal key
+ * Releases the resources held by the key values but not the internal key itself
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_internal_sha224_key_clear(
+     libhmac_internal_sha224_key_t *internal_key,
+     libcerror_error_t **error )
+{
+	static char *function = "libhmac_internal_sha224_key_clear";
+	int result            = 1;
+
+	if( internal_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( libhmac_internal_sha224_context_clear(
+	     &( internal_key->inner_context ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear inner context.",
+		 function );
+
+		result = -1;
+	}
+	if( libhmac_internal_sha224_context_clear(
+	     &( internal_key->outer_context ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear outer context.",
+		 function );
+
+		result = -1;
+	}
+	/* Prevent sensitive data from leaking
+	 */
+	if( memory_set(
+	     internal_key,
+	     0,
+	     sizeof( libhmac_internal_sha224_key_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear key.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Calculates the SHA-224 HMAC of the buffer using the internal key
+ * Only the blocks of the buffer and a single outer block are hashed
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_internal_sha224_key_calculate_hmac(
+     libhmac_internal_sha224_key_t *internal_key,
+     const uint8_t *buffer,
+     size_t size,
+     uint8_t *hmac,
+     size_t hmac_size,
+     libcerror_error_t **error )
+{
+	libhmac_internal_sha224_context_t internal_context;
+
+	static char *function = "libhmac_internal_sha224_key_calculate_hmac";
+
+	if( internal_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( hmac == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid HMAC.",
+		 function );
+
+		return( -1 );
+	}
+	if( hmac_size < (size_t) LIBHMAC_SHA224_HASH_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid HMAC size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( libhmac_internal_sha224_context_initialize(
+	     &internal_context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize context.",
+		 function );
+
+		return( -1 );
+	}
+	if( libhmac_internal_sha224_context_copy(
+	     &internal_context,
+	     &( internal_key->inner_context ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy inner context.",
+		 function );
+
+		goto on_error;
+	}
+	if( libhmac_sha224_context_update(
+	     (libhmac_sha224_context_t *) &internal_context,
+	     buffer,
+	     size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update context.",
+		 function );
+
+		goto on_error;
+	}
+	if( libhmac_sha224_context_finalize(
+	     (libhmac_sha224_context_t *) &internal_context,
+	     hmac,
+	     hmac_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize context.",
+		 function );
+
+		goto on_error;
+	}
+	if( libhmac_internal_sha224_context_copy(
+	     &internal_context,
+	     &( internal_key->outer_context ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy outer context.",
+		 function );
+
+		goto on_error;
+	}
+	if( libhmac_sha224_context_update(
+	     (libhmac_sha224_context_t *) &internal_context,
+	     hmac,
+	     LIBHMAC_SHA224_HASH_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update context.",
+		 function );
+
+		goto on_error;
+	}
+	if( libhmac_sha224_context_finalize(
+	     (libhmac_sha224_context_t *) &internal_context,
+	     hmac,
+	     hmac_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize context.",
+		 function );
+
+		goto on_error;
+	}
+	if( libhmac_internal_sha224_context_clear(
+	     &internal_context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear context.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	libhmac_internal_sha224_context_clear(
+	 &internal_context,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Creates a SHA-224 HMAC key
+ * The key can be used to calculate multiple HMACs without repeating the key setup
+ * Make sure the value key is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_sha224_key_initialize(
+     libhmac_sha224_key_t **key,
+     const uint8_t *key_data,
+     size_t key_data_size,
+     libcerror_error_t **error )
+{
+	libhmac_internal_sha224_key_t *internal_key = NULL;
+	static char *function                       = "libhmac_sha224_key_initialize";
+
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( *key != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid key value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_key = memory_allocate_structure(
+	                libhmac_internal_sha224_key_t );
+
+	if( internal_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create key.",
+		 function );
+
+		goto on_error;
+	}
+	if( libhmac_internal_sha224_key_initialize(
+	     internal_key,
+	     key_data,
+	     key_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize key.",
+		 function );
+
+		goto on_error;
+	}
+	*key = (libhmac_sha224_key_t *) internal_key;
+
+	return( 1 );
+
+on_error:
+	if( internal_key != NULL )
+	{
+		memory_free(
+		 internal_key );
+	}
+	return( -1 );
+}
+
+/* Frees a SHA-224 HMAC key
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_sha224_key_free(
+     libhmac_sha224_key_t **key,
+     libcerror_error_t **error )
+{
+	libhmac_internal_sha224_key_t *internal_key = NULL;
+	static char *function                       = "libhmac_sha224_key_free";
+	int result                                  = 1;
+
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( *key != NULL )
+	{
+		internal_key = (libhmac_internal_sha224_key_t *) *key;
+		*key         = NULL;
+
+		if( libhmac_internal_sha224_key_clear(
+		     internal_key,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear key.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_key );
+	}
+	return( result );
+}
+
+/* Calculates the SHA-224 HMAC of the buffer using the key
+ * Only the blocks of the buffer and a single outer block are hashed, the key
+ * itself is not modified and can be used concurrently
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_sha224_key_calculate_hmac(
+     libhmac_sha224_key_t *key,
+     const uint8_t *buffer,
+     size_t size,
+     uint8_t *hmac,
+     size_t hmac_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libhmac_sha224_key_calculate_hmac";
+
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( libhmac_internal_sha224_key_calculate_hmac(
+	     (libhmac_internal_sha224_key_t *) key,
+	     buffer,
+	     size,
+	     hmac,
+	     hmac_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate HMAC.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Verifies the SHA-224 HMACs of multiple buffers using the key
+ * The HMACs are calculated in batches and compared against the expected HMACs in constant time
+ * The bit of the results bitmap that corresponds with a buffer is set if its HMAC matches,
+ * where the HMAC of buffer 0 corresponds with the least significant bit of results[ 0 ]
+ * Returns 1 if all HMACs match, 0 if one or more HMACs do not match or -1 on error
+ */
+int libhmac_sha224_key_verify_hmac_batch(
+     libhmac_sha224_key_t *key,
+     const uint8_t **buffers,
+     const size_t *sizes,
+     int number_of_buffers,
+     const uint8_t *hmacs,
+     size_t hmacs_size,
+     uint8_t *results,
+     size_t results_size,
+     libcerror_error_t **error )
+{
+	uint8_t calculated_hmacs[ LIBHMAC_SHA224_KEY_VERIFY_BATCH_SIZE * LIBHMAC_SHA224_HASH_SIZE ];
+
+#if !defined( LIBHMAC_HAVE_SHA224_SUPPORT ) && !defined( LIBHMAC_HAVE_SHA256_SUPPORT )
+	uint8_t inner_hashes[ LIBHMAC_SHA224_KEY_VERIFY_BATCH_SIZE * LIBHMAC_SHA256_HASH_SIZE ];
+	uint8_t outer_hashes[ LIBHMAC_SHA224_KEY_VERIFY_BATCH_SIZE * LIBHMAC_SHA256_HASH_SIZE ];
+	const uint8_t *inner_hash_buffers[ LIBHMAC_SHA224_KEY_VERIFY_BATCH_SIZE ];
+	size_t inner_hash_sizes[ LIBHMAC_SHA224_KEY_VERIFY_BATCH_SIZE ];
+#endif
+
+	libhmac_internal_sha224_key_t *internal_key = NULL;
+	static char *function                       = "libhmac_sha224_key_verify_hmac_batch";
+	size_t hash_offset                          = 0;
+	size_t results_bitmap_size                  = 0;
+	uint32_t match                              = 0;
+	uint8_t all_match                           = 1;
+	uint8_t difference                          = 0;
+	int batch_index                             = 0;
+	int buffer_index                            = 0;
+	int byte_index                              = 0;
+	int number_of_batch_buffers                 = 0;
+	int result                                  = 0;
+
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	internal_key = (libhmac_internal_sha224_key_t *) key;
+
+	if( buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffers.",
+		 function );
+
+		return( -1 );
+	}
+	if( sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_buffers < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of buffers value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( hmacs == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid HMACs.",
+		 function );
+
+		return( -1 );
+	}
+	if( hmacs_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid HMACs size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( hmacs_size < ( (size_t) number_of_buffers * LIBHMAC_SHA224_HASH_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid HMACs size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( results == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid results.",
+		 function );
+
+		return( -1 );
+	}
+	if( results_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid results size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	results_bitmap_size = ( (size_t) number_of_buffers + 7 ) / 8;
+
+	if( results_size < results_bitmap_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid results size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( results_bitmap_size > 0 )
+	{
+		if( memory_set(
+		     results,
+		     0,
+		     results_bitmap_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear results.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	for( batch_index = 0;
+	     batch_index < number_of_buffers;
+	     batch_index += number_of_batch_buffers )
+	{
+		number_of_batch_buffers = number_of_buffers - batch_index;
+
+		if( number_of_batch_buffers > LIBHMAC_SHA224_KEY_VERIFY_BATCH_SIZE )
+		{
+			number_of_batch_buffers = LIBHMAC_SHA224_KEY_VERIFY_BATCH_SIZE;
+		}
+		result = 0;
+
+#if !defined( LIBHMAC_HAVE_SHA224_SUPPORT ) && !defined( LIBHMAC_HAVE_SHA256_SUPPORT )
+		/* The inner and outer passes continue from the states after the padded key blocks
+		 * the outer pass hashes the inner hashes truncated to the SHA-224 hash size
+		 */
+		result = libhmac_sha256_multi_buffer_calculate_with_state(
+		          &( buffers[ batch_index ] ),
+		          &( sizes[ batch_index ] ),
+		          number_of_batch_buffers,
+		          internal_key->inner_context.hash_values,
+		          LIBHMAC_SHA224_BLOCK_SIZE,
+		          inner_hashes,
+		          error );
+
+		if( result == 1 )
+		{
+			hash_offset = 0;
+
+			for( buffer_index = 0;
+			     buffer_index < number_of_batch_buffers;
+			     buffer_index++ )
+			{
+				inner_hash_buffers[ buffer_index ] = &( inner_hashes[ hash_offset ] );
+				inner_hash_sizes[ buffer_index ]   = LIBHMAC_SHA224_HASH_SIZE;
+
+				hash_offset += LIBHMAC_SHA256_HASH_SIZE;
+			}
+			result = libhmac_sha256_multi_buffer_calculate_with_state(
+			          inner_hash_buffers,
+			          inner_hash_sizes,
+			          number_of_batch_buffers,
+			          internal_key->outer_context.hash_values,
+			          LIBHMAC_SHA224_BLOCK_SIZE,
+			          outer_hashes,
+			          error );
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to calculate multi-buffer HMACs.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 1 )
+		{
+			for( buffer_index = 0;
+			     buffer_index < number_of_batch_buffers;
+			     buffer_index++ )
+			{
+				if( memory_copy(
+				     &( calculated_hmacs[ buffer_index * LIBHMAC_SHA224_HASH_SIZE ] ),
+				     &( outer_hashes[ buffer_index * LIBHMAC_SHA256_HASH_SIZE ] ),
+				     LIBHMAC_SHA224_HASH_SIZE ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy HMAC: %d.",
+					 function,
+					 batch_index + buffer_index );
+
+					goto on_error;
+				}
+			}
+		}
+#endif /* !defined( LIBHMAC_HAVE_SHA224_SUPPORT ) && !defined( LIBHMAC_HAVE_SHA256_SUPPORT ) */
+
+		if( result == 0 )
+		{
+			hash_offset = 0;
+
+			for( buffer_index = 0;
+			     buffer_index < number_of_batch_buffers;
+			     buffer_index++ )
+			{
+				if( libhmac_internal_sha224_key_calculate_hmac(
+				     internal_key,
+				     buffers[ batch_index + buffer_index ],
+				     sizes[ batch_index + buffer_index ],
+				     &( calculated_hmacs[ hash_offset ] ),
+				     LIBHMAC_SHA224_HASH_SIZE,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to calculate HMAC: %d.",
+					 function,
+					 batch_index + buffer_index );
+
+					goto on_error;
+				}
+				hash_offset += LIBHMAC_SHA224_HASH_SIZE;
+			}
+		}
+		/* The HMACs are compared without data dependent branches
+		 */
+		hash_offset = 0;
+
+		for( buffer_index = 0;
+		     buffer_index < number_of_batch_buffers;
+		     buffer_index++ )
+		{
+			difference = 0;
+
+			for( byte_index = 0;
+			     byte_index < LIBHMAC_SHA224_HASH_SIZE;
+			     byte_index++ )
+			{
+				difference |= calculated_hmacs[ hash_offset + byte_index ]
+				            ^ hmacs[ ( (size_t) batch_index * LIBHMAC_SHA224_HASH_SIZE ) + hash_offset + byte_index ];
+			}
+			/* match is 1 if difference is 0 and 0 otherwise
+			 */
+			match = ( ( (uint32_t) difference - 1 ) >> 8 ) & 1;
+
+			results[ ( batch_index + buffer_index ) / 8 ] |= (uint8_t) ( match << ( ( batch_index + buffer_index ) % 8 ) );
+
+			all_match &= (uint8_t) match;
+
+			hash_offset += LIBHMAC_SHA224_HASH_SIZE;
+		}
+	}
+	memory_set(
+	 calculated_hmacs,
+	 0,
+	 LIBHMAC_SHA224_KEY_VERIFY_BATCH_SIZE * LIBHMAC_SHA224_HASH_SIZE );
+
+#if !defined( LIBHMAC_HAVE_SHA224_SUPPORT ) && !defined( LIBHMAC_HAVE_SHA256_SUPPORT )
+	memory_set(
+	 inner_hashes,
+	 0,
+	 LIBHMAC_SHA224_KEY_VERIFY_BATCH_SIZE * LIBHMAC_SHA256_HASH_SIZE );
+
+	memory_set(
+	 outer_hashes,
+	 0,
+	 LIBHMAC_SHA224_KEY_VERIFY_BATCH_SIZE * LIBHMAC_SHA256_HASH_SIZE );
+#endif
+
+	return( (int) all_match );
+
+on_error:
+	memory_set(
+	 calculated_hmacs,
+	 0,
+	 LIBHMAC_SHA224_KEY_VERIFY_BATCH_SIZE * LIBHMAC_SHA224_HASH_SIZE );
+
+#if !defined( LIBHMAC_HAVE_SHA224_SUPPORT ) && !defined( LIBHMAC_HAVE_SHA256_SUPPORT )
+	memory_set(
+	 inner_hashes,
+	 0,
+	 LIBHMAC_SHA224_KEY_VERIFY_BATCH_SIZE * LIBHMAC_SHA256_HASH_SIZE );
+
+	memory_set(
+	 outer_hashes,
+	 0,
+	 LIBHMAC_SHA224_KEY_VERIFY_BATCH_SIZE * LIBHMAC_SHA256_HASH_SIZE );
+#endif
+
+	return( -1 );
+}
@@ -27,6 +27,8 @@
 #include "libhmac_libcerror.h"
 #include "libhmac_sha256.h"
 #include "libhmac_sha256_context.h"
+#include "libhmac_sha256_key.h"
+#include "libhmac_sha256_multi_buffer.h"
 
 /* Creates a SHA256 context
  * Make sure the value context is referencing, is set to NULL
@@ -147,11 +149,12 @@ int libhmac_sha256_calculate(
      size_t hash_size,
      libcerror_error_t **error )
 {
-	libhmac_sha256_context_t *context = NULL;
-	static char *function             = "libhmac_sha256_calculate";
+	libhmac_internal_sha256_context_t internal_context;
 
-	if( libhmac_sha256_context_initialize(
-	     &context,
+	static char *function = "libhmac_sha256_calculate";
+
+	if( libhmac_internal_sha256_context_initialize(
+	     &internal_context,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -161,10 +164,10 @@ int libhmac_sha256_calculate(
 		 "%s: unable to initialize context.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	if( libhmac_sha256_context_update(
-	     context,
+	     (libhmac_sha256_context_t *) &internal_context,
 	     buffer,
 	     size,
 	     error ) != 1 )
@@ -179,7 +182,7 @@ int libhmac_sha256_calculate(
 		goto on_error;
 	}
 	if( libhmac_sha256_context_finalize(
-	     context,
+	     (libhmac_sha256_context_t *) &internal_context,
 	     hash,
 	     hash_size,
 	     error ) != 1 )
@@ -193,136 +196,140 @@ int libhmac_sha256_calculate(
 
 		goto on_error;
 	}
-	if( libhmac_sha256_context_free(
-	     &context,
+	if( libhmac_internal_sha256_context_clear(
+	     &internal_context,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free context.",
+		 "%s: unable to clear context.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	return( 1 );
 
 on_error:
-	if( context != NULL )
-	{
-		libhmac_sha256_context_free(
-		 &context,
-		 NULL );
-	}
+	libhmac_internal_sha256_context_clear(
+	 &internal_context,
+	 NULL );
+
 	return( -1 );
 }
 
-/* Calculates the SHA-256 HMAC of the buffer
- * HMAC is defined in RFC 2104
+/* Calculates the SHA-256 of multiple independent buffers
+ * The hashes are stored consecutively in the order of the buffers
  * Returns 1 if successful or -1 on error
  */
-int libhmac_sha256_calculate_hmac(
-     const uint8_t *key,
-     size_t key_size,
-     const uint8_t *buffer,
-     size_t size,
-     uint8_t *hmac,
-     size_t hmac_size,
+int libhmac_sha256_calculate_batch(
+     const uint8_t **buffers,
+     const size_t *sizes,
+     int number_of_buffers,
+     uint8_t *hashes,
+     size_t hashes_size,
      libcerror_error_t **error )
 {
-	uint8_t key_hash[ LIBHMAC_SHA256_HASH_SIZE ];
+	libhmac_internal_sha256_context_t internal_context;
 
-	libhmac_sha256_context_t *context = NULL;
-	uint8_t *key_data                 = NULL;
-	uint8_t *inner_padding            = NULL;
-	uint8_t *outer_padding            = NULL;
-	static char *function             = "libhmac_sha256_calculate_hmac";
-	size_t block_index                = 0;
-	size_t block_size                 = 64;
+	static char *function = "libhmac_sha256_calculate_batch";
+	int buffer_index      = 0;
+	int result            = 0;
 
-	if( key == NULL )
+	if( buffers == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid key.",
+		 "%s: invalid buffers.",
 		 function );
 
 		return( -1 );
 	}
-	if( key_size > (size_t) SSIZE_MAX )
+	if( sizes == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid key size value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sizes.",
 		 function );
 
 		return( -1 );
 	}
-	if( hmac_size < (size_t) LIBHMAC_SHA256_HASH_SIZE )
+	if( number_of_buffers < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: invalid HMAC size value too small.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of buffers value less than zero.",
 		 function );
 
 		return( -1 );
 	}
-	key_data = (uint8_t *) memory_allocate(
-	                        sizeof( uint8_t ) * block_size );
+	if( hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hashes.",
+		 function );
 
-	if( key_data == NULL )
+		return( -1 );
+	}
+	if( hashes_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create key data.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid hashes size value exceeds maximum.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( key_size <= block_size )
+	if( hashes_size < ( (size_t) number_of_buffers * LIBHMAC_SHA256_HASH_SIZE ) )
 	{
-		if( memory_copy(
-		     key_data,
-		     key,
-		     key_size ) == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy key data.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid hashes value too small.",
+		 function );
 
-			goto on_error;
-		}
-		if( memory_set(
-		     &( key_data[ key_size ] ),
-		     0,
-		     block_size - key_size ) == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-			 "%s: unable to clear key remaining data.",
-			 function );
+		return( -1 );
+	}
+#if !defined( LIBHMAC_HAVE_SHA256_SUPPORT )
+	result = libhmac_sha256_multi_buffer_calculate(
+	          buffers,
+	          sizes,
+	          number_of_buffers,
+	          hashes,
+	          error );
 
-			goto on_error;
-		}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate multi-buffer hashes.",
+		 function );
+
+		return( -1 );
 	}
-	else
+#endif /* !defined( LIBHMAC_HAVE_SHA256_SUPPORT ) */
+
+	if( result == 0 )
 	{
-		if( libhmac_sha256_context_initialize(
-		     &context,
+		/* A single context is reused for all the buffers
+		 */
+		if( libhmac_internal_sha256_context_initialize(
+		     &internal_context,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -332,384 +339,557 @@ int libhmac_sha256_calculate_hmac(
 			 "%s: unable to initialize context.",
 			 function );
 
-			goto on_error;
-		}
-		if( libhmac_sha256_context_update(
-		     context,
-		     key,
-		     key_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to update context.",
-			 function );
-
-			goto on_error;
+			return( -1 );
 		}
-		if( libhmac_sha256_context_finalize(
-		     context,
-		     key_hash,
-		     LIBHMAC_SHA256_HASH_SIZE,
-		     error ) != 1 )
+		for( buffer_index = 0;
+		     buffer_index < number_of_buffers;
+		     buffer_index++ )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to finalize context.",
-			 function );
-
-			goto on_error;
-		}
-		if( libhmac_sha256_context_free(
-		     &context,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free context.",
-			 function );
+			if( buffer_index > 0 )
+			{
+				if( libhmac_sha256_context_reset(
+				     (libhmac_sha256_context_t *) &internal_context,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to reset context.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			if( libhmac_sha256_context_update(
+			     (libhmac_sha256_context_t *) &internal_context,
+			     buffers[ buffer_index ],
+			     sizes[ buffer_index ],
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update context: %d.",
+				 function,
+				 buffer_index );
 
-			goto on_error;
-		}
-		if( block_size > LIBHMAC_SHA256_HASH_SIZE )
-		{
-			if( memory_set(
-			     &( key_data[ LIBHMAC_SHA256_HASH_SIZE ] ),
-			     0,
-			     block_size - LIBHMAC_SHA256_HASH_SIZE ) == NULL )
+				goto on_error;
+			}
+			if( libhmac_sha256_context_finalize(
+			     (libhmac_sha256_context_t *) &internal_context,
+			     &( hashes[ buffer_index * LIBHMAC_SHA256_HASH_SIZE ] ),
+			     LIBHMAC_SHA256_HASH_SIZE,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-				 "%s: unable to clear remaining key data.",
-				 function );
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to finalize context: %d.",
+				 function,
+				 buffer_index );
 
 				goto on_error;
 			}
 		}
-		if( memory_copy(
-		     key_data,
-		     key_hash,
-		     LIBHMAC_SHA256_HASH_SIZE ) == NULL )
+		if( libhmac_internal_sha256_context_clear(
+		     &internal_context,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy key hash data.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear context.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 	}
-	inner_padding = (uint8_t *) memory_allocate(
-	                             sizeof( uint8_t ) * block_size );
+	return( 1 );
+
+on_error:
+	libhmac_internal_sha256_context_clear(
+	 &internal_context,
+	 NULL );
 
-	if( inner_padding == NULL )
+	return( -1 );
+}
+
+/* Calculates the SHA-256 of 32 bytes of data, such as a single hash
+ * The data and the padding are transformed as a single block
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_sha256_calculate_32_bytes(
+     const uint8_t *buffer,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libhmac_sha256_calculate_32_bytes";
+
+	if( buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create inner padding.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( memory_set(
-	     inner_padding,
-	     0x36,
-	     block_size ) == NULL )
+	if( hash == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to set inner padding.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	outer_padding = (uint8_t *) memory_allocate(
-	                             sizeof( uint8_t ) * block_size );
+	if( hash_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid hash size value exceeds maximum.",
+		 function );
 
-	if( outer_padding == NULL )
+		return( -1 );
+	}
+	if( hash_size < (size_t) LIBHMAC_SHA256_HASH_SIZE )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create outer padding.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid hash value too small.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( memory_set(
-	     outer_padding,
-	     0x5c,
-	     block_size ) == NULL )
+#if defined( LIBHMAC_HAVE_SHA256_SUPPORT )
+	if( libhmac_sha256_calculate(
+	     buffer,
+	     32,
+	     hash,
+	     hash_size,
+	     error ) != 1 )
+#else
+	if( libhmac_sha256_context_calculate_32_bytes(
+	     buffer,
+	     hash ) != 1 )
+#endif
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to set outer padding.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate hash.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	for( block_index = 0;
-	     block_index < block_size;
-	     block_index++ )
+	return( 1 );
+}
+
+/* Calculates the SHA-256 of 64 bytes of data, such as a pair of hashes
+ * The padding block is transformed using its precomputed message schedule
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_sha256_calculate_64_bytes(
+     const uint8_t *buffer,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libhmac_sha256_calculate_64_bytes";
+
+	if( buffer == NULL )
 	{
-		inner_padding[ block_index ] ^= key_data[ block_index ];
-		outer_padding[ block_index ] ^= key_data[ block_index ];
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
 	}
-	if( libhmac_sha256_context_initialize(
-	     &context,
-	     error ) != 1 )
+	if( hash == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to initialize context.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libhmac_sha256_context_update(
-	     context,
-	     inner_padding,
-	     block_size,
-	     error ) != 1 )
+	if( hash_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to update context.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid hash size value exceeds maximum.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libhmac_sha256_context_update(
-	     context,
-	     buffer,
-	     size,
-	     error ) != 1 )
+	if( hash_size < (size_t) LIBHMAC_SHA256_HASH_SIZE )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to update context.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid hash value too small.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libhmac_sha256_context_finalize(
-	     context,
-	     hmac,
-	     hmac_size,
+#if defined( LIBHMAC_HAVE_SHA256_SUPPORT )
+	if( libhmac_sha256_calculate(
+	     buffer,
+	     64,
+	     hash,
+	     hash_size,
 	     error ) != 1 )
+#else
+	if( libhmac_sha256_context_calculate_64_bytes(
+	     buffer,
+	     hash ) != 1 )
+#endif
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to finalize context.",
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate hash.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libhmac_sha256_context_free(
-	     &context,
-	     error ) != 1 )
+	return( 1 );
+}
+
+/* Calculates the SHA-256 of consecutive 64 byte messages, such as the pairs
+ * of child hashes of one level of a hash tree
+ * The size of the buffer must be a multiple of 64
+ * The hashes are stored consecutively in the order of the messages
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_sha256_calculate_64_bytes_batch(
+     const uint8_t *buffer,
+     size_t size,
+     uint8_t *hashes,
+     size_t hashes_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "libhmac_sha256_calculate_64_bytes_batch";
+	size_t message_index      = 0;
+	size_t number_of_messages = 0;
+	int result                = 0;
+
+	if( buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free context.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libhmac_sha256_context_initialize(
-	     &context,
-	     error ) != 1 )
+	if( size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to initialize context.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libhmac_sha256_context_update(
-	     context,
-	     outer_padding,
-	     block_size,
-	     error ) != 1 )
+	if( ( size % 64 ) != 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to update context.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value not a multiple of 64.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libhmac_sha256_context_update(
-	     context,
-	     hmac,
-	     LIBHMAC_SHA256_HASH_SIZE,
-	     error ) != 1 )
+	if( hashes == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to update context.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hashes.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libhmac_sha256_context_finalize(
-	     context,
-	     hmac,
-	     hmac_size,
-	     error ) != 1 )
+	if( hashes_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to finalize context.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid hashes size value exceeds maximum.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libhmac_sha256_context_free(
-	     &context,
-	     error ) != 1 )
+	number_of_messages = size / 64;
+
+	if( hashes_size < ( number_of_messages * LIBHMAC_SHA256_HASH_SIZE ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free context.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid hashes value too small.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( memory_set(
-	     outer_padding,
-	     0,
-	     block_size ) == NULL )
+#if !defined( LIBHMAC_HAVE_SHA256_SUPPORT )
+	result = libhmac_sha256_multi_buffer_calculate_64_bytes(
+	          buffer,
+	          number_of_messages,
+	          hashes,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear outer padding.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate multi-buffer hashes.",
 		 function );
 
-		goto on_error;
+		return( -1 );
+	}
+#endif /* !defined( LIBHMAC_HAVE_SHA256_SUPPORT ) */
+
+	if( result == 0 )
+	{
+		for( message_index = 0;
+		     message_index < number_of_messages;
+		     message_index++ )
+		{
+#if defined( LIBHMAC_HAVE_SHA256_SUPPORT )
+			if( libhmac_sha256_calculate(
+			     &( buffer[ message_index * 64 ] ),
+			     64,
+			     &( hashes[ message_index * LIBHMAC_SHA256_HASH_SIZE ] ),
+			     LIBHMAC_SHA256_HASH_SIZE,
+			     error ) != 1 )
+#else
+			if( libhmac_sha256_context_calculate_64_bytes(
+			     &( buffer[ message_index * 64 ] ),
+			     &( hashes[ message_index * LIBHMAC_SHA256_HASH_SIZE ] ) ) != 1 )
+#endif
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to calculate hash.",
+				 function );
+
+				return( -1 );
+			}
+		}
 	}
-	memory_free(
-	 outer_padding );
+	return( 1 );
+}
+
+/* Calculates the SHA-256 HMAC of the buffer
+ * HMAC is defined in RFC 2104
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_sha256_calculate_hmac(
+     const uint8_t *key,
+     size_t key_size,
+     const uint8_t *buffer,
+     size_t size,
+     uint8_t *hmac,
+     size_t hmac_size,
+     libcerror_error_t **error )
+{
+	libhmac_internal_sha256_key_t internal_key;
 
-	outer_padding = NULL;
+	static char *function = "libhmac_sha256_calculate_hmac";
 
-	if( memory_set(
-	     inner_padding,
-	     0,
-	     block_size ) == NULL )
+	if( key == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear inner padding.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	memory_free(
-	 inner_padding );
+	if( key_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid key size value exceeds maximum.",
+		 function );
 
-	inner_padding = NULL;
+		return( -1 );
+	}
+	if( hmac_size < (size_t) LIBHMAC_SHA256_HASH_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid HMAC size value too small.",
+		 function );
 
-	if( memory_set(
-	     key_data,
-	     0,
-	     block_size ) == NULL )
+		return( -1 );
+	}
+	if( libhmac_internal_sha256_key_initialize(
+	     &internal_key,
+	     key,
+	     key_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear key data.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize key.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	memory_free(
-	 key_data );
+	if( libhmac_internal_sha256_key_calculate_hmac(
+	     &internal_key,
+	     buffer,
+	     size,
+	     hmac,
+	     hmac_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate HMAC.",
+		 function );
 
-	key_data = NULL;
+		goto on_error;
+	}
+	if( libhmac_internal_sha256_key_clear(
+	     &internal_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear key.",
+		 function );
 
+		return( -1 );
+	}
 	return( 1 );
 
 on_error:
-	if( context != NULL )
+	libhmac_internal_sha256_key_clear(
+	 &internal_key,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Compresses 64 byte sized blocks of data into the SHA-256 hash values
+ * The hash values are the 8 32-bit words of the SHA-256 state in host byte order,
+ * they are updated in place using the fastest available kernel
+ * No padding is added, which allows for custom constructions on top of
+ * the SHA-256 compression function
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_sha256_compress_blocks(
+     uint32_t *hash_values,
+     const uint8_t *blocks,
+     size_t number_of_blocks,
+     libcerror_error_t **error )
+{
+	static char *function = "libhmac_sha256_compress_blocks";
+
+	if( hash_values == NULL )
 	{
-		libhmac_sha256_context_free(
-		 &context,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash values.",
+		 function );
+
+		return( -1 );
 	}
-	if( outer_padding != NULL )
+	if( blocks == NULL )
 	{
-		memory_set(
-        	 outer_padding,
-	         0,
-        	 block_size );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid blocks.",
+		 function );
 
-		memory_free(
-		 outer_padding );
+		return( -1 );
 	}
-	if( inner_padding != NULL )
+	if( number_of_blocks > ( (size_t) SSIZE_MAX / LIBHMAC_SHA256_BLOCK_SIZE ) )
 	{
-		memory_set(
-        	 inner_padding,
-	         0,
-        	 block_size );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of blocks value exceeds maximum.",
+		 function );
 
-		memory_free(
-		 inner_padding );
+		return( -1 );
 	}
-	if( key_data != NULL )
+	if( number_of_blocks == 0 )
 	{
-		memory_set(
-        	 key_data,
-	         0,
-        	 block_size );
+		return( 1 );
+	}
+	if( libhmac_sha256_context_transform_blocks(
+	     hash_values,
+	     blocks,
+	     number_of_blocks ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to transform blocks.",
+		 function );
 
-		memory_free(
-		 key_data );
+		return( -1 );
 	}
-	return( -1 );
+	return( 1 );
 }
 
@@ -0,0 +1,327 @@
+/*
+ * SHA-256 AVX2 kernel functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libhmac_cpu.h"
+#include "libhmac_sha256_avx2.h"
+#include "libhmac_sha256_context.h"
+
+#if defined( LIBHMAC_HAVE_X86_KERNELS )
+
+#include <immintrin.h>
+
+/* Rotates the 8 x 32-bit values to the right, AVX2 has no 32-bit vector rotate
+ */
+#define libhmac_sha256_avx2_rotate_right( values, number_of_bits ) \
+	_mm256_or_si256( \
+	 _mm256_srli_epi32( values, number_of_bits ), \
+	 _mm256_slli_epi32( values, 32 - number_of_bits ) )
+
+#define libhmac_sha256_avx2_sigma0( values ) \
+	_mm256_xor_si256( \
+	 _mm256_xor_si256( \
+	  libhmac_sha256_avx2_rotate_right( values, 7 ), \
+	  libhmac_sha256_avx2_rotate_right( values, 18 ) ), \
+	 _mm256_srli_epi32( values, 3 ) )
+
+#define libhmac_sha256_avx2_sigma1( values ) \
+	_mm256_xor_si256( \
+	 _mm256_xor_si256( \
+	  libhmac_sha256_avx2_rotate_right( values, 17 ), \
+	  libhmac_sha256_avx2_rotate_right( values, 19 ) ), \
+	 _mm256_srli_epi32( values, 10 ) )
+
+/* Extends the message values of 2 blocks with the next 4 x 32-bit values
+ * The lower 128-bits contain the values of the first block and the upper 128-bits those of the second block
+ * message_values0 contains W[t-16..t-13] and is overwritten with W[t..t+3]
+ * message_values1, message_values2 and message_values3 contain W[t-12..t-1]
+ * W[t+2] and W[t+3] depend on W[t] and W[t+1] hence sigma1 is calculated in 2 steps
+ */
+#define libhmac_sha256_avx2_extend_message_values( message_values0, message_values1, message_values2, message_values3, temporary1, temporary2 ) \
+	temporary1      = _mm256_alignr_epi8( message_values1, message_values0, 4 ); \
+	temporary2      = _mm256_alignr_epi8( message_values3, message_values2, 4 ); \
+	message_values0 = _mm256_add_epi32( message_values0, temporary2 ); \
+	message_values0 = _mm256_add_epi32( message_values0, libhmac_sha256_avx2_sigma0( temporary1 ) ); \
+	temporary2      = _mm256_shuffle_epi32( message_values3, 0xee ); \
+	temporary1      = _mm256_add_epi32( message_values0, libhmac_sha256_avx2_sigma1( temporary2 ) ); \
+	temporary2      = _mm256_shuffle_epi32( temporary1, 0x44 ); \
+	message_values0 = _mm256_add_epi32( message_values0, libhmac_sha256_avx2_sigma1( temporary2 ) ); \
+	message_values0 = _mm256_blend_epi32( temporary1, message_values0, 0xcc );
+
+/* Stores the 4 x 32-bit message values of 2 blocks with the round constants added
+ * The values are stored as 4 values of the first block followed by 4 values of the second block
+ */
+#define libhmac_sha256_avx2_store_message_values_plus_k( message_values_plus_k, round_index, message_values ) \
+	_mm256_storeu_si256( \
+	 (__m256i *) &( message_values_plus_k[ 2 * ( round_index ) ] ), \
+	 _mm256_add_epi32( \
+	  message_values, \
+	  _mm256_broadcastsi128_si256( _mm_loadu_si128( (const __m128i *) &( libhmac_sha256_context_prime_cube_roots[ round_index ] ) ) ) ) );
+
+/* Calculates a round, with BMI2 the rotates are compiled into rorx which does not affect the flags
+ */
+#define libhmac_sha256_avx2_calculate_hash_value( message_values_plus_k, value_index, hash_values, hash_value_index0, hash_value_index1, hash_value_index2, hash_value_index3, hash_value_index4, hash_value_index5, hash_value_index6, hash_value_index7, s0, s1, t1, t2 ) \
+	s0 = byte_stream_bit_rotate_right_32bit( hash_values[ hash_value_index0 ], 2 ) \
+	   ^ byte_stream_bit_rotate_right_32bit( hash_values[ hash_value_index0 ], 13 ) \
+	   ^ byte_stream_bit_rotate_right_32bit( hash_values[ hash_value_index0 ], 22 ); \
+	s1 = byte_stream_bit_rotate_right_32bit( hash_values[ hash_value_index4 ], 6 ) \
+	   ^ byte_stream_bit_rotate_right_32bit( hash_values[ hash_value_index4 ], 11 ) \
+	   ^ byte_stream_bit_rotate_right_32bit( hash_values[ hash_value_index4 ], 25 ); \
+\
+	t1  = hash_values[ hash_value_index7 ]; \
+	t1 += s1; \
+	t1 += ( ( hash_values[ hash_value_index5 ] ^ hash_values[ hash_value_index6 ] ) & hash_values[ hash_value_index4 ] ) \
+	    ^ hash_values[ hash_value_index6 ]; \
+	t1 += message_values_plus_k[ value_index ]; \
+	t2  = s0; \
+	t2 += ( ( hash_values[ hash_value_index0 ] | hash_values[ hash_value_index2 ] ) & hash_values[ hash_value_index1 ] ) \
+	    | ( hash_values[ hash_value_index0 ] & hash_values[ hash_value_index2 ] ); \
+\
+	hash_values[ hash_value_index3 ] += t1; \
+	hash_values[ hash_value_index7 ]  = t1 + t2;
+
+/* Calculates the SHA-256 of 64 byte sized blocks of data in a buffer
+ * The message schedule of 2 blocks is calculated at the same time with AVX2
+ * and interleaved with the rounds of the first block, the rounds of the second
+ * block use the stored message schedule
+ * This kernel requires the AVX, AVX2 and BMI2 extensions
+ * Returns 1 if successful or -1 on error
+ */
+LIBHMAC_X86_TARGET( "avx,avx2,bmi2" ) \
+int libhmac_sha256_avx2_transform(
+     uint32_t *context_hash_values,
+     const uint8_t *buffer,
+     size_t number_of_blocks )
+{
+	uint32_t hash_values[ 8 ];
+	uint32_t message_values_plus_k[ 128 ];
+
+	__m256i byte_order_mask;
+	__m256i message_values0;
+	__m256i message_values1;
+	__m256i message_values2;
+	__m256i message_values3;
+	__m256i temporary1;
+	__m256i temporary2;
+
+	const uint8_t *second_block = NULL;
+	uint32_t s0                 = 0;
+	uint32_t s1                 = 0;
+	uint32_t t1                 = 0;
+	uint32_t t2                 = 0;
+	int round_index             = 0;
+
+	byte_order_mask = _mm256_set_epi64x(
+	                   0x0c0d0e0f08090a0bULL,
+	                   0x0405060700010203ULL,
+	                   0x0c0d0e0f08090a0bULL,
+	                   0x0405060700010203ULL );
+
+	while( number_of_blocks > 0 )
+	{
+		/* With a single remaining block the message schedule is calculated twice for the same block
+		 */
+		if( number_of_blocks > 1 )
+		{
+			second_block = &( buffer[ 64 ] );
+		}
+		else
+		{
+			second_block = buffer;
+		}
+		/* Break the blocks into 16 x 32-bit values
+		 */
+		message_values0 = _mm256_inserti128_si256( _mm256_castsi128_si256( _mm_loadu_si128( (const __m128i *) &( buffer[ 0 ] ) ) ), _mm_loadu_si128( (const __m128i *) &( second_block[ 0 ] ) ), 1 );
+		message_values1 = _mm256_inserti128_si256( _mm256_castsi128_si256( _mm_loadu_si128( (const __m128i *) &( buffer[ 16 ] ) ) ), _mm_loadu_si128( (const __m128i *) &( second_block[ 16 ] ) ), 1 );
+		message_values2 = _mm256_inserti128_si256( _mm256_castsi128_si256( _mm_loadu_si128( (const __m128i *) &( buffer[ 32 ] ) ) ), _mm_loadu_si128( (const __m128i *) &( second_block[ 32 ] ) ), 1 );
+		message_values3 = _mm256_inserti128_si256( _mm256_castsi128_si256( _mm_loadu_si128( (const __m128i *) &( buffer[ 48 ] ) ) ), _mm_loadu_si128( (const __m128i *) &( second_block[ 48 ] ) ), 1 );
+
+		message_values0 = _mm256_shuffle_epi8( message_values0, byte_order_mask );
+		message_values1 = _mm256_shuffle_epi8( message_values1, byte_order_mask );
+		message_values2 = _mm256_shuffle_epi8( message_values2, byte_order_mask );
+		message_values3 = _mm256_shuffle_epi8( message_values3, byte_order_mask );
+
+		libhmac_sha256_avx2_store_message_values_plus_k( message_values_plus_k, 0, message_values0 )
+		libhmac_sha256_avx2_store_message_values_plus_k( message_values_plus_k, 4, message_values1 )
+		libhmac_sha256_avx2_store_message_values_plus_k( message_values_plus_k, 8, message_values2 )
+		libhmac_sha256_avx2_store_message_values_plus_k( message_values_plus_k, 12, message_values3 )
+
+		if( memory_copy(
+		     hash_values,
+		     context_hash_values,
+		     sizeof( uint32_t ) * 8 ) == NULL )
+		{
+			goto on_error;
+		}
+		/* Extend to 64 x 32-bit values while calculating the hash values of the preceding 32-bit values of the first block
+		 */
+		for( round_index = 0;
+		     round_index < 48;
+		     round_index += 16 )
+		{
+			libhmac_sha256_avx2_extend_message_values( message_values0, message_values1, message_values2, message_values3, temporary1, temporary2 )
+			libhmac_sha256_avx2_store_message_values_plus_k( message_values_plus_k, round_index + 16, message_values0 )
+
+			libhmac_sha256_avx2_calculate_hash_value( message_values_plus_k, ( 2 * round_index ) + 0, hash_values, 0, 1, 2, 3, 4, 5, 6, 7, s0, s1, t1, t2 )
+			libhmac_sha256_avx2_calculate_hash_value( message_values_plus_k, ( 2 * round_index ) + 1, hash_values, 7, 0, 1, 2, 3, 4, 5, 6, s0, s1, t1, t2 )
+			libhmac_sha256_avx2_calculate_hash_value( message_values_plus_k, ( 2 * round_index ) + 2, hash_values, 6, 7, 0, 1, 2, 3, 4, 5, s0, s1, t1, t2 )
+			libhmac_sha256_avx2_calculate_hash_value( message_values_plus_k, ( 2 * round_index ) + 3, hash_values, 5, 6, 7, 0, 1, 2, 3, 4, s0, s1, t1, t2 )
+
+			libhmac_sha256_avx2_extend_message_values( message_values1, message_values2, message_values3, message_values0, temporary1, temporary2 )
+			libhmac_sha256_avx2_store_message_values_plus_k( message_values_plus_k, round_index + 20, message_values1 )
+
+			libhmac_sha256_avx2_calculate_hash_value( message_values_plus_k, ( 2 * round_index ) + 8, hash_values, 4, 5, 6, 7, 0, 1, 2, 3, s0, s1, t1, t2 )
+			libhmac_sha256_avx2_calculate_hash_value( message_values_plus_k, ( 2 * round_index ) + 9, hash_values, 3, 4, 5, 6, 7, 0, 1, 2, s0, s1, t1, t2 )
+			libhmac_sha256_avx2_calculate_hash_value( message_values_plus_k, ( 2 * round_index ) + 10, hash_values, 2, 3, 4, 5, 6, 7, 0, 1, s0, s1, t1, t2 )
+			libhmac_sha256_avx2_calculate_hash_value( message_values_plus_k, ( 2 * round_index ) + 11, hash_values, 1, 2, 3, 4, 5, 6, 7, 0, s0, s1, t1, t2 )
+
+			libhmac_sha256_avx2_extend_message_values( message_values2, message_values3, message_values0, message_values1, temporary1, temporary2 )
+			libhmac_sha256_avx2_store_message_values_plus_k( message_values_plus_k, round_index + 24, message_values2 )
+
+			libhmac_sha256_avx2_calculate_hash_value( message_values_plus_k, ( 2 * round_index ) + 16, hash_values, 0, 1, 2, 3, 4, 5, 6, 7, s0, s1, t1, t2 )
+			libhmac_sha256_avx2_calculate_hash_value( message_values_plus_k, ( 2 * round_index ) + 17, hash_values, 7, 0, 1, 2, 3, 4, 5, 6, s0, s1, t1, t2 )
+			libhmac_sha256_avx2_calculate_hash_value( message_values_plus_k, ( 2 * round_index ) + 18, hash_values, 6, 7, 0, 1, 2, 3, 4, 5, s0, s1, t1, t2 )
+			libhmac_sha256_avx2_calculate_hash_value( message_values_plus_k, ( 2 * round_index ) + 19, hash_values, 5, 6, 7, 0, 1, 2, 3, 4, s0, s1, t1, t2 )
+
+			libhmac_sha256_avx2_extend_message_values( message_values3, message_values0, message_values1, message_values2, temporary1, temporary2 )
+			libhmac_sha256_avx2_store_message_values_plus_k( message_values_plus_k, round_index + 28, message_values3 )
+
+			libhmac_sha256_avx2_calculate_hash_value( message_values_plus_k, ( 2 * round_index ) + 24, hash_values, 4, 5, 6, 7, 0, 1, 2, 3, s0, s1, t1, t2 )
+			libhmac_sha256_avx2_calculate_hash_value( message_values_plus_k, ( 2 * round_index ) + 25, hash_values, 3, 4, 5, 6, 7, 0, 1, 2, s0, s1, t1, t2 )
+			libhmac_sha256_avx2_calculate_hash_value( message_values_plus_k, ( 2 * round_index ) + 26, hash_values, 2, 3, 4, 5, 6, 7, 0, 1, s0, s1, t1, t2 )
+			libhmac_sha256_avx2_calculate_hash_value( message_values_plus_k, ( 2 * round_index ) + 27, hash_values, 1, 2, 3, 4, 5, 6, 7, 0, s0, s1, t1, t2 )
+		}
+		/* Calculate the hash values of the last 16 x 32-bit values of the first block
+		 */
+		libhmac_sha256_avx2_calculate_hash_value( message_values_plus_k, 96, hash_values, 0, 1, 2, 3, 4, 5, 6, 7, s0, s1, t1, t2 )
+		libhmac_sha256_avx2_calculate_hash_value( message_values_plus_k, 97, hash_values, 7, 0, 1, 2, 3, 4, 5, 6, s0, s1, t1, t2 )
+		libhmac_sha256_avx2_calculate_hash_value( message_values_plus_k, 98, hash_values, 6, 7, 0, 1, 2, 3, 4, 5, s0, s1, t1, t2 )
+		libhmac_sha256_avx2_calculate_hash_value( message_values_plus_k, 99, hash_values, 5, 6, 7, 0, 1, 2, 3, 4, s0, s1, t1, t2 )
+		libhmac_sha256_avx2_calculate_hash_value( message_values_plus_k, 104, hash_values, 4, 5, 6, 7, 0, 1, 2, 3, s0, s1, t1, t2 )
+		libhmac_sha256_avx2_calculate_hash_value( message_values_plus_k, 105, hash_values, 3, 4, 5, 6, 7, 0, 1, 2, s0, s1, t1, t2 )
+		libhmac_sha256_avx2_calculate_hash_value( message_values_plus_k, 106, hash_values, 2, 3, 4, 5, 6, 7, 0, 1, s0, s1, t1, t2 )
+		libhmac_sha256_avx2_calculate_hash_value( message_values_plus_k, 107, hash_values, 1, 2, 3, 4, 5, 6, 7, 0, s0, s1, t1, t2 )
+		libhmac_sha256_avx2_calculate_hash_value( message_values_plus_k, 112, hash_values, 0, 1, 2, 3, 4, 5, 6, 7, s0, s1, t1, t2 )
+		libhmac_sha256_avx2_calculate_hash_value( message_values_plus_k, 113, hash_values, 7, 0, 1, 2, 3, 4, 5, 6, s0, s1, t1, t2 )
+		libhmac_sha256_avx2_calculate_hash_value( message_values_plus_k, 114, hash_values, 6, 7, 0, 1, 2, 3, 4, 5, s0, s1, t1, t2 )
+		libhmac_sha256_avx2_calculate_hash_value( message_values_plus_k, 115, hash_values, 5, 6, 7, 0, 1, 2, 3, 4, s0, s1, t1, t2 )
+		libhmac_sha256_avx2_calculate_hash_value( message_values_plus_k, 120, hash_values, 4, 5, 6, 7, 0, 1, 2, 3, s0, s1, t1, t2 )
+		libhmac_sha256_avx2_calculate_hash_value( message_values_plus_k, 121, hash_values, 3, 4, 5, 6, 7, 0, 1, 2, s0, s1, t1, t2 )
+		libhmac_sha256_avx2_calculate_hash_value( message_values_plus_k, 122, hash_values, 2, 3, 4, 5, 6, 7, 0, 1, s0, s1, t1, t2 )
+		libhmac_sha256_avx2_calculate_hash_value( message_values_plus_k, 123, hash_values, 1, 2, 3, 4, 5, 6, 7, 0, s0, s1, t1, t2 )
+
+		/* Update the hash values in the context
+		 */
+		context_hash_values[ 0 ] += hash_values[ 0 ];
+		context_hash_values[ 1 ] += hash_values[ 1 ];
+		context_hash_values[ 2 ] += hash_values[ 2 ];
+		context_hash_values[ 3 ] += hash_values[ 3 ];
+		context_hash_values[ 4 ] += hash_values[ 4 ];
+		context_hash_values[ 5 ] += hash_values[ 5 ];
+		context_hash_values[ 6 ] += hash_values[ 6 ];
+		context_hash_values[ 7 ] += hash_values[ 7 ];
+
+		if( number_of_blocks == 1 )
+		{
+			break;
+		}
+		if( memory_copy(
+		     hash_values,
+		     context_hash_values,
+		     sizeof( uint32_t ) * 8 ) == NULL )
+		{
+			goto on_error;
+		}
+		/* Calculate the hash values of the second block
+		 */
+		for( round_index = 0;
+		     round_index < 64;
+		     round_index += 16 )
+		{
+			libhmac_sha256_avx2_calculate_hash_value( message_values_plus_k, ( 2 * round_index ) + 4, hash_values, 0, 1, 2, 3, 4, 5, 6, 7, s0, s1, t1, t2 )
+			libhmac_sha256_avx2_calculate_hash_value( message_values_plus_k, ( 2 * round_index ) + 5, hash_values, 7, 0, 1, 2, 3, 4, 5, 6, s0, s1, t1, t2 )
+			libhmac_sha256_avx2_calculate_hash_value( message_values_plus_k, ( 2 * round_index ) + 6, hash_values, 6, 7, 0, 1, 2, 3, 4, 5, s0, s1, t1, t2 )
+			libhmac_sha256_avx2_calculate_hash_value( message_values_plus_k, ( 2 * round_index ) + 7, hash_values, 5, 6, 7, 0, 1, 2, 3, 4, s0, s1, t1, t2 )
+			libhmac_sha256_avx2_calculate_hash_value( message_values_plus_k, ( 2 * round_index ) + 12, hash_values, 4, 5, 6, 7, 0, 1, 2, 3, s0, s1, t1, t2 )
+			libhmac_sha256_avx2_calculate_hash_value( message_values_plus_k, ( 2 * round_index ) + 13, hash_values, 3, 4, 5, 6, 7, 0, 1, 2, s0, s1, t1, t2 )
+			libhmac_sha256_avx2_calculate_hash_value( message_values_plus_k, ( 2 * round_index ) + 14, hash_values, 2, 3, 4, 5, 6, 7, 0, 1, s0, s1, t1, t2 )
+			libhmac_sha256_avx2_calculate_hash_value( message_values_plus_k, ( 2 * round_index ) + 15, hash_values, 1, 2, 3, 4, 5, 6, 7, 0, s0, s1, t1, t2 )
+			libhmac_sha256_avx2_calculate_hash_value( message_values_plus_k, ( 2 * round_index ) + 20, hash_values, 0, 1, 2, 3, 4, 5, 6, 7, s0, s1, t1, t2 )
+			libhmac_sha256_avx2_calculate_hash_value( message_values_plus_k, ( 2 * round_index ) + 21, hash_values, 7, 0, 1, 2, 3, 4, 5, 6, s0, s1, t1, t2 )
+			libhmac_sha256_avx2_calculate_hash_value( message_values_plus_k, ( 2 * round_index ) + 22, hash_values, 6, 7, 0, 1, 2, 3, 4, 5, s0, s1, t1, t2 )
+			libhmac_sha256_avx2_calculate_hash_value( message_values_plus_k, ( 2 * round_index ) + 23, hash_values, 5, 6, 7, 0, 1, 2, 3, 4, s0, s1, t1, t2 )
+			libhmac_sha256_avx2_calculate_hash_value( message_values_plus_k, ( 2 * round_index ) + 28, hash_values, 4, 5, 6, 7, 0, 1, 2, 3, s0, s1, t1, t2 )
+			libhmac_sha256_avx2_calculate_hash_value( message_values_plus_k, ( 2 * round_index ) + 29, hash_values, 3, 4, 5, 6, 7, 0, 1, 2, s0, s1, t1, t2 )
+			libhmac_sha256_avx2_calculate_hash_value( message_values_plus_k, ( 2 * round_index ) + 30, hash_values, 2, 3, 4, 5, 6, 7, 0, 1, s0, s1, t1, t2 )
+			libhmac_sha256_avx2_calculate_hash_value( message_values_plus_k, ( 2 * round_index ) + 31, hash_values, 1, 2, 3, 4, 5, 6, 7, 0, s0, s1, t1, t2 )
+		}
+		/* Update the hash values in the context
+		 */
+		context_hash_values[ 0 ] += hash_values[ 0 ];
+		context_hash_values[ 1 ] += hash_values[ 1 ];
+		context_hash_values[ 2 ] += hash_values[ 2 ];
+		context_hash_values[ 3 ] += hash_values[ 3 ];
+		context_hash_values[ 4 ] += hash_values[ 4 ];
+		context_hash_values[ 5 ] += hash_values[ 5 ];
+		context_hash_values[ 6 ] += hash_values[ 6 ];
+		context_hash_values[ 7 ] += hash_values[ 7 ];
+
+		buffer           += 128;
+		number_of_blocks -= 2;
+	}
+	/* Prevent sensitive data from leaking
+	 */
+	if( memory_set(
+	     hash_values,
+	     0,
+	     sizeof( uint32_t ) * 8 ) == NULL )
+	{
+		goto on_error;
+	}
+	if( memory_set(
+	     message_values_plus_k,
+	     0,
+	     sizeof( uint32_t ) * 128 ) == NULL )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	memory_set(
+	 message_values_plus_k,
+	 0,
+	 sizeof( uint32_t ) * 128 );
+
+	memory_set(
+	 hash_values,
+	 0,
+	 sizeof( uint32_t ) * 8 );
+
+	return( -1 );
+}
+
+#endif /* defined( LIBHMAC_HAVE_X86_KERNELS ) */
+
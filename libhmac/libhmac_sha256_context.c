@@ -32,26 +32,44 @@
 #include <openssl/evp.h>
 #endif
 
+#include "libhmac_atomic.h"
 #include "libhmac_byte_stream.h"
 #include "libhmac_definitions.h"
+#include "libhmac_kernel.h"
 #include "libhmac_libcerror.h"
+#include "libhmac_sha256_avx2.h"
 #include "libhmac_sha256_context.h"
+#include "libhmac_sha256_sha_ni.h"
 
-#if !defined( LIBHMAC_HAVE_SHA256_SUPPORT )
+/* Structure used to determine the alignment of the internal context
+ */
+typedef struct libhmac_sha256_context_alignment libhmac_sha256_context_alignment_t;
+
+struct libhmac_sha256_context_alignment
+{
+	/* Dummy value to offset the internal context
+	 */
+	uint8_t dummy;
+
+	/* The internal context
+	 */
+	libhmac_internal_sha256_context_t internal_context;
+};
 
 /* FIPS 180-2 based SHA-256 functions
+ * The constants are shared with the SHA-256 kernels, the round constants also with SHA-224
  */
 
 /* The first 32-bits of the fractional parts of the square roots of the first 8 primes [ 2, 19 ]
  */
-static uint32_t libhmac_sha256_context_prime_square_roots[ 8 ] = {
+const uint32_t libhmac_sha256_context_prime_square_roots[ 8 ] = {
 	0x6a09e667UL, 0xbb67ae85UL, 0x3c6ef372UL, 0xa54ff53aUL,
 	0x510e527fUL, 0x9b05688cUL, 0x1f83d9abUL, 0x5be0cd19UL
 };
 
 /* The first 32-bits of the fractional parts of the cube roots of the first 64 primes [ 2, 311 ]
  */
-static uint32_t libhmac_sha256_context_prime_cube_roots[ 64 ] = {
+const uint32_t libhmac_sha256_context_prime_cube_roots[ 64 ] = {
 	0x428a2f98UL, 0x71374491UL, 0xb5c0fbcfUL, 0xe9b5dba5UL,
 	0x3956c25bUL, 0x59f111f1UL, 0x923f82a4UL, 0xab1c5ed5UL,
 	0xd807aa98UL, 0x12835b01UL, 0x243185beUL, 0x550c7dc3UL,
@@ -222,18 +240,17 @@ static uint32_t libhmac_sha256_context_prime_cube_roots[ 64 ] = {
 	libhmac_sha256_context_transform_unfolded_calculate_hash_value( values_32bit, 63, hash_values, 1, 2, 3, 4, 5, 6, 7, 0, s0, s1, t1, t2 )
 
 /* Calculates the SHA-256 of 64 byte sized blocks of data in a buffer
- * Returns the number of bytes used if successful or -1 on error
+ * This is the portable kernel
+ * Returns 1 if successful or -1 on error
  */
-ssize_t libhmac_sha256_context_transform(
-         libhmac_internal_sha256_context_t *internal_context,
-         const uint8_t *buffer,
-         size_t size,
-         libcerror_error_t **error )
+int libhmac_sha256_context_transform_portable(
+     uint32_t *context_hash_values,
+     const uint8_t *buffer,
+     size_t number_of_blocks )
 {
 	uint32_t hash_values[ 8 ];
 	uint32_t values_32bit[ 64 ];
 
-	static char *function     = "libhmac_sha256_context_transform";
 	size_t buffer_offset      = 0;
 	uint32_t s0               = 0;
 	uint32_t s1               = 0;
@@ -245,53 +262,13 @@ ssize_t libhmac_sha256_context_transform(
 	uint8_t value_32bit_index = 0;
 #endif
 
-	if( internal_context == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid internal context.",
-		 function );
-
-		return( -1 );
-	}
-	if( buffer == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid buffer.",
-		 function );
-
-		return( -1 );
-	}
-	if( size > (size_t) SSIZE_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid size value exceeds maximum.",
-		 function );
-
-		return( -1 );
-	}
-	while( size >= LIBHMAC_SHA256_BLOCK_SIZE )
+	while( number_of_blocks > 0 )
 	{
 		if( memory_copy(
 		     hash_values,
-		     internal_context->hash_values,
+		     context_hash_values,
 		     sizeof( uint32_t ) * 8 ) == NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy hash values.",
-			 function );
-
 			goto on_error;
 		}
 #if defined( LIBHMAC_UNFOLLED_LOOPS )
@@ -322,14 +299,14 @@ ssize_t libhmac_sha256_context_transform(
 
 		/* Update the hash values in the context
 		 */
-		internal_context->hash_values[ 0 ] += hash_values[ 0 ];
-		internal_context->hash_values[ 1 ] += hash_values[ 1 ];
-		internal_context->hash_values[ 2 ] += hash_values[ 2 ];
-		internal_context->hash_values[ 3 ] += hash_values[ 3 ];
-		internal_context->hash_values[ 4 ] += hash_values[ 4 ];
-		internal_context->hash_values[ 5 ] += hash_values[ 5 ];
-		internal_context->hash_values[ 6 ] += hash_values[ 6 ];
-		internal_context->hash_values[ 7 ] += hash_values[ 7 ];
+		context_hash_values[ 0 ] += hash_values[ 0 ];
+		context_hash_values[ 1 ] += hash_values[ 1 ];
+		context_hash_values[ 2 ] += hash_values[ 2 ];
+		context_hash_values[ 3 ] += hash_values[ 3 ];
+		context_hash_values[ 4 ] += hash_values[ 4 ];
+		context_hash_values[ 5 ] += hash_values[ 5 ];
+		context_hash_values[ 6 ] += hash_values[ 6 ];
+		context_hash_values[ 7 ] += hash_values[ 7 ];
 
 #else
 		/* Break the block into 16 x 32-bit values
@@ -395,11 +372,11 @@ ssize_t libhmac_sha256_context_transform(
 		     hash_values_index < 8;
 		     hash_values_index++ )
 		{
-			internal_context->hash_values[ hash_values_index ] += hash_values[ hash_values_index ];
+			context_hash_values[ hash_values_index ] += hash_values[ hash_values_index ];
 		}
 #endif /* defined( LIBHMAC_UNFOLLED_LOOPS ) */
 
-		size -= LIBHMAC_SHA256_BLOCK_SIZE;
+		number_of_blocks--;
 	}
 	/* Prevent sensitive data from leaking
 	 */
@@ -408,13 +385,6 @@ ssize_t libhmac_sha256_context_transform(
 	     0,
 	     sizeof( uint32_t ) * 8 ) == NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear hash values.",
-		 function );
-
 		goto on_error;
 	}
 	if( memory_set(
@@ -422,16 +392,9 @@ ssize_t libhmac_sha256_context_transform(
 	     0,
 	     sizeof( uint32_t ) * 64 ) == NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear 32-bit values.",
-		 function );
-
 		goto on_error;
 	}
-	return( (ssize_t) buffer_offset );
+	return( 1 );
 
 on_error:
 	memory_set(
@@ -447,333 +410,662 @@ on_error:
 	return( -1 );
 }
 
-#endif /* !defined( LIBHMAC_HAVE_SHA256_SUPPORT ) */
+/* The message schedule of the padding block of a 64 byte message,
+ * the 64 x 32-bit values extended from the padding block with the round constants added
+ */
+static const uint32_t libhmac_sha256_context_padding_64_bytes_schedule[ 64 ] = {
+	0xc28a2f98UL, 0x71374491UL, 0xb5c0fbcfUL, 0xe9b5dba5UL,
+	0x3956c25bUL, 0x59f111f1UL, 0x923f82a4UL, 0xab1c5ed5UL,
+	0xd807aa98UL, 0x12835b01UL, 0x243185beUL, 0x550c7dc3UL,
+	0x72be5d74UL, 0x80deb1feUL, 0x9bdc06a7UL, 0xc19bf374UL,
+	0x649b69c1UL, 0xf0fe4786UL, 0x0fe1edc6UL, 0x240cf254UL,
+	0x4fe9346fUL, 0x6cc984beUL, 0x61b9411eUL, 0x16f988faUL,
+	0xf2c65152UL, 0xa88e5a6dUL, 0xb019fc65UL, 0xb9d99ec7UL,
+	0x9a1231c3UL, 0xe70eeaa0UL, 0xfdb1232bUL, 0xc7353eb0UL,
+	0x3069bad5UL, 0xcb976d5fUL, 0x5a0f118fUL, 0xdc1eeefdUL,
+	0x0a35b689UL, 0xde0b7a04UL, 0x58f4ca9dUL, 0xe15d5b16UL,
+	0x007f3e86UL, 0x37088980UL, 0xa507ea32UL, 0x6fab9537UL,
+	0x17406110UL, 0x0d8cd6f1UL, 0xcdaa3b6dUL, 0xc0bbbe37UL,
+	0x83613bdaUL, 0xdb48a363UL, 0x0b02e931UL, 0x6fd15ca7UL,
+	0x521afacaUL, 0x31338431UL, 0x6ed41a95UL, 0x6d437890UL,
+	0xc39c91f2UL, 0x9eccabbdUL, 0xb5c9a0e6UL, 0x532fb63cUL,
+	0xd2c741c6UL, 0x07237ea3UL, 0xa4954b68UL, 0x4c191d76UL
+};
 
-/* Creates a SHA-256 context
- * Make sure the value context is referencing, is set to NULL
+/* Calculates the SHA-256 of a single 64 byte sized block of which the message schedule is precomputed
+ * The schedule contains the 64 x 32-bit values with the round constants added,
+ * so only the rounds are calculated
+ * This is the portable kernel
  * Returns 1 if successful or -1 on error
  */
-int libhmac_sha256_context_initialize(
-     libhmac_sha256_context_t **context,
-     libcerror_error_t **error )
+int libhmac_sha256_context_transform_schedule_portable(
+     uint32_t *context_hash_values,
+     const uint32_t *schedule )
 {
-	libhmac_internal_sha256_context_t *internal_context = NULL;
-	static char *function                               = "libhmac_sha256_context_initialize";
+	uint32_t hash_values[ 8 ];
 
-#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_SHA256 )
-	const EVP_MD *evp_md_type                           = NULL;
+	uint32_t s0               = 0;
+	uint32_t s1               = 0;
+	uint32_t t1               = 0;
+	uint32_t t2               = 0;
+	uint8_t hash_values_index = 0;
+	uint8_t value_32bit_index = 0;
+
+	if( memory_copy(
+	     hash_values,
+	     context_hash_values,
+	     sizeof( uint32_t ) * 8 ) == NULL )
+	{
+		return( -1 );
+	}
+	/* Calculate the hash values for the precomputed 32-bit values
+	 */
+	for( value_32bit_index = 0;
+	     value_32bit_index < 64;
+	     value_32bit_index++ )
+	{
+		s0 = byte_stream_bit_rotate_right_32bit( hash_values[ 0 ], 2 )
+		   ^ byte_stream_bit_rotate_right_32bit( hash_values[ 0 ], 13 )
+		   ^ byte_stream_bit_rotate_right_32bit( hash_values[ 0 ], 22 );
+		s1 = byte_stream_bit_rotate_right_32bit( hash_values[ 4 ], 6 )
+		   ^ byte_stream_bit_rotate_right_32bit( hash_values[ 4 ], 11 )
+		   ^ byte_stream_bit_rotate_right_32bit( hash_values[ 4 ], 25 );
+
+		t1  = hash_values[ 7 ];
+		t1 += s1;
+		t1 += ( hash_values[ 4 ] & hash_values[ 5 ] )
+		    ^ ( ~( hash_values[ 4 ] ) & hash_values[ 6 ] );
+		t1 += schedule[ value_32bit_index ];
+		t2  = s0;
+		t2 += ( hash_values[ 0 ] & hash_values[ 1 ] )
+		    ^ ( hash_values[ 0 ] & hash_values[ 2 ] )
+		    ^ ( hash_values[ 1 ] & hash_values[ 2 ] );
+
+		hash_values[ 7 ] = hash_values[ 6 ];
+		hash_values[ 6 ] = hash_values[ 5 ];
+		hash_values[ 5 ] = hash_values[ 4 ];
+		hash_values[ 4 ] = hash_values[ 3 ] + t1;
+		hash_values[ 3 ] = hash_values[ 2 ];
+		hash_values[ 2 ] = hash_values[ 1 ];
+		hash_values[ 1 ] = hash_values[ 0 ];
+		hash_values[ 0 ] = t1 + t2;
+	}
+	/* Update the hash values in the context
+	 */
+	for( hash_values_index = 0;
+	     hash_values_index < 8;
+	     hash_values_index++ )
+	{
+		context_hash_values[ hash_values_index ] += hash_values[ hash_values_index ];
+	}
+	/* Prevent sensitive data from leaking
+	 */
+	if( memory_set(
+	     hash_values,
+	     0,
+	     sizeof( uint32_t ) * 8 ) == NULL )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* The SHA-256 kernels in order of preference
+ * The portable kernel is expected to be last
+ */
+static int libhmac_sha256_context_kernel_types[ ] = {
+#if defined( LIBHMAC_HAVE_X86_KERNELS )
+	LIBHMAC_KERNEL_TYPE_SHA_NI,
+	LIBHMAC_KERNEL_TYPE_AVX2,
 #endif
+	LIBHMAC_KERNEL_TYPE_PORTABLE };
 
-	if( context == NULL )
+static libhmac_kernel_transform_32bit_function_t libhmac_sha256_context_kernel_functions[ ] = {
+#if defined( LIBHMAC_HAVE_X86_KERNELS )
+	libhmac_sha256_sha_ni_transform,
+	libhmac_sha256_avx2_transform,
+#endif
+	libhmac_sha256_context_transform_portable };
+
+/* The SHA-256 kernels that transform the blocks of two messages interleaved,
+ * in the same order as the kernel types, NULL if the kernel has no such variant
+ */
+static libhmac_kernel_pair_transform_32bit_function_t libhmac_sha256_context_kernel_pair_functions[ ] = {
+#if defined( LIBHMAC_HAVE_X86_KERNELS )
+	libhmac_sha256_sha_ni_transform_pair,
+	NULL,
+#endif
+	NULL };
+
+/* The SHA-256 kernels that transform a single block of which the message schedule is precomputed,
+ * in the same order as the kernel types, kernels without such a variant use the portable variant
+ * since calculating the rounds does not benefit from the vectorized message schedule
+ */
+static libhmac_kernel_schedule_transform_32bit_function_t libhmac_sha256_context_kernel_schedule_functions[ ] = {
+#if defined( LIBHMAC_HAVE_X86_KERNELS )
+	libhmac_sha256_sha_ni_transform_schedule,
+	libhmac_sha256_context_transform_schedule_portable,
+#endif
+	libhmac_sha256_context_transform_schedule_portable };
+
+#define LIBHMAC_SHA256_CONTEXT_NUMBER_OF_KERNELS \
+	(int) ( sizeof( libhmac_sha256_context_kernel_types ) / sizeof( int ) )
+
+/* The index of the selected kernel or -1 if not yet selected
+ */
+static int libhmac_sha256_context_kernel_index = -1;
+
+/* Retrieves the index of the selected kernel
+ * The kernel is selected on first use, concurrent callers select the same kernel
+ * Returns the kernel index
+ */
+static int libhmac_sha256_context_get_kernel_index(
+            void )
+{
+	int kernel_index = libhmac_atomic_get_32bit( &libhmac_sha256_context_kernel_index );
+
+	if( kernel_index < 0 )
+	{
+		kernel_index = libhmac_kernel_select(
+		                libhmac_sha256_context_kernel_types,
+		                LIBHMAC_SHA256_CONTEXT_NUMBER_OF_KERNELS );
+
+		libhmac_atomic_set_32bit(
+		 &libhmac_sha256_context_kernel_index,
+		 kernel_index );
+	}
+	return( kernel_index );
+}
+
+/* Retrieves the transform function of a specific kernel
+ * Returns 1 if successful, 0 if the kernel is not available or -1 on error
+ */
+int libhmac_sha256_context_get_transform_function(
+     int kernel_type,
+     libhmac_kernel_transform_32bit_function_t *transform_function,
+     libcerror_error_t **error )
+{
+	static char *function = "libhmac_sha256_context_get_transform_function";
+	int kernel_index      = 0;
+
+	if( transform_function == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid context.",
+		 "%s: invalid transform function.",
 		 function );
 
 		return( -1 );
 	}
-	if( *context != NULL )
+	for( kernel_index = 0;
+	     kernel_index < LIBHMAC_SHA256_CONTEXT_NUMBER_OF_KERNELS;
+	     kernel_index++ )
+	{
+		if( libhmac_sha256_context_kernel_types[ kernel_index ] == kernel_type )
+		{
+			if( libhmac_kernel_is_supported(
+			     kernel_type ) == 0 )
+			{
+				break;
+			}
+			*transform_function = libhmac_sha256_context_kernel_functions[ kernel_index ];
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Retrieves the pair transform function of a specific kernel
+ * Returns 1 if successful, 0 if the kernel has no pair transform function or is not available or -1 on error
+ */
+int libhmac_sha256_context_get_pair_transform_function(
+     int kernel_type,
+     libhmac_kernel_pair_transform_32bit_function_t *pair_transform_function,
+     libcerror_error_t **error )
+{
+	static char *function = "libhmac_sha256_context_get_pair_transform_function";
+	int kernel_index      = 0;
+
+	if( pair_transform_function == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid context value already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pair transform function.",
 		 function );
 
 		return( -1 );
 	}
-	internal_context = memory_allocate_structure(
-	                    libhmac_internal_sha256_context_t );
+	for( kernel_index = 0;
+	     kernel_index < LIBHMAC_SHA256_CONTEXT_NUMBER_OF_KERNELS;
+	     kernel_index++ )
+	{
+		if( libhmac_sha256_context_kernel_types[ kernel_index ] == kernel_type )
+		{
+			if( ( libhmac_sha256_context_kernel_pair_functions[ kernel_index ] == NULL )
+			 || ( libhmac_kernel_is_supported(
+			       kernel_type ) == 0 ) )
+			{
+				break;
+			}
+			*pair_transform_function = libhmac_sha256_context_kernel_pair_functions[ kernel_index ];
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+#if !defined( LIBHMAC_HAVE_SHA256_SUPPORT )
+
+/* Calculates the SHA-256 of 64 byte sized blocks of data in a buffer
+ * Returns the number of bytes used if successful or -1 on error
+ */
+ssize_t libhmac_sha256_context_transform(
+         libhmac_internal_sha256_context_t *internal_context,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	static char *function   = "libhmac_sha256_context_transform";
+	size_t number_of_blocks = 0;
+	int kernel_index        = 0;
 
 	if( internal_context == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create context.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal context.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( memory_set(
-	     internal_context,
-	     0,
-	     sizeof( libhmac_internal_sha256_context_t ) ) == NULL )
+	if( buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear context.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
 		 function );
 
-		memory_free(
-		 internal_context );
-
 		return( -1 );
 	}
-#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_SHA_H ) && defined( SHA256_DIGEST_LENGTH )
-	if( SHA256_Init(
-	     &( internal_context->sha256_context ) ) != 1 )
+	if( size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to initialize context.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
+	number_of_blocks = size / LIBHMAC_SHA256_BLOCK_SIZE;
 
-#elif defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_SHA256 )
-#if defined( HAVE_EVP_MD_CTX_INIT )
-	EVP_MD_CTX_init(
-	 &( internal_context->internal_evp_md_context ) );
-
-	internal_context->evp_md_context = &( internal_context->internal_evp_md_context );
-#else
-	internal_context->evp_md_context = EVP_MD_CTX_new();
-
-	if( internal_context->evp_md_context == NULL )
+	if( number_of_blocks > 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create EVP message digest context.",
-		 function );
+		kernel_index = libhmac_sha256_context_get_kernel_index();
 
-		goto on_error;
+		if( libhmac_sha256_context_kernel_functions[ kernel_index ](
+		     internal_context->hash_values,
+		     buffer,
+		     number_of_blocks ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to transform blocks.",
+			 function );
+
+			return( -1 );
+		}
 	}
-#endif /* defined( HAVE_EVP_MD_CTX_INIT ) */
+	return( (ssize_t) ( number_of_blocks * LIBHMAC_SHA256_BLOCK_SIZE ) );
+}
 
-/* TODO use EVP_MD_fetch for EVP_DigestInit_ex2 */
-	evp_md_type = EVP_sha256();
+#endif /* !defined( LIBHMAC_HAVE_SHA256_SUPPORT ) */
 
-#if defined( HAVE_EVP_DIGESTINIT_EX2 )
-	if( EVP_DigestInit_ex2(
-	     internal_context->evp_md_context,
-	     evp_md_type,
-	     NULL ) != 1 )
-#else
-	if( EVP_DigestInit_ex(
-	     internal_context->evp_md_context,
-	     evp_md_type,
-	     NULL ) != 1 )
-#endif
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to initialize context.",
-		 function );
+/* Calculates the SHA-256 of 64 byte sized blocks of data using the selected kernel
+ * The hash values are updated in place, no padding is added
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_sha256_context_transform_blocks(
+     uint32_t *hash_values,
+     const uint8_t *blocks,
+     size_t number_of_blocks )
+{
+	int kernel_index = libhmac_sha256_context_get_kernel_index();
 
-#if defined( HAVE_EVP_MD_CTX_CLEANUP )
-		EVP_MD_CTX_cleanup(
-		 &( internal_context->internal_evp_md_context ) );
-		ERR_remove_thread_state(
-		 NULL );
-#else
-		EVP_MD_CTX_free(
-		 internal_context->evp_md_context );
-#endif
-		internal_context->evp_md_context = NULL;
+	return( libhmac_sha256_context_kernel_functions[ kernel_index ](
+	         hash_values,
+	         blocks,
+	         number_of_blocks ) );
+}
+
+/* Calculates the SHA-256 of 32 bytes of data using the selected kernel
+ * The data and the padding fit in a single block
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_sha256_context_calculate_32_bytes(
+     const uint8_t *buffer,
+     uint8_t *hash )
+{
+	uint8_t block[ LIBHMAC_SHA256_BLOCK_SIZE ];
+	uint32_t hash_values[ 8 ];
+
+	int hash_values_index = 0;
+	int kernel_index      = 0;
 
-		goto on_error;
-	}
-#else
 	if( memory_copy(
-	     internal_context->hash_values,
+	     hash_values,
 	     libhmac_sha256_context_prime_square_roots,
 	     sizeof( uint32_t ) * 8 ) == NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to copy initial hash values.",
-		 function );
-
 		return( -1 );
 	}
-#endif /* defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_SHA_H ) && defined( SHA256_DIGEST_LENGTH ) */
+	if( memory_copy(
+	     block,
+	     buffer,
+	     32 ) == NULL )
+	{
+		goto on_error;
+	}
+	if( memory_set(
+	     &( block[ 32 ] ),
+	     0,
+	     LIBHMAC_SHA256_BLOCK_SIZE - 32 ) == NULL )
+	{
+		goto on_error;
+	}
+	/* Add the padding byte and the size of the data in bits: 256
+	 */
+	block[ 32 ] = 0x80;
+	block[ 62 ] = 0x01;
 
-	*context = (libhmac_sha256_context_t *) internal_context;
+	kernel_index = libhmac_sha256_context_get_kernel_index();
 
+	if( libhmac_sha256_context_kernel_functions[ kernel_index ](
+	     hash_values,
+	     block,
+	     1 ) != 1 )
+	{
+		goto on_error;
+	}
+	for( hash_values_index = 0;
+	     hash_values_index < 8;
+	     hash_values_index++ )
+	{
+		byte_stream_copy_from_uint32_big_endian(
+		 &( hash[ hash_values_index * 4 ] ),
+		 hash_values[ hash_values_index ] );
+	}
+	/* Prevent sensitive data from leaking
+	 */
+	if( memory_set(
+	     block,
+	     0,
+	     LIBHMAC_SHA256_BLOCK_SIZE ) == NULL )
+	{
+		goto on_error;
+	}
+	if( memory_set(
+	     hash_values,
+	     0,
+	     sizeof( uint32_t ) * 8 ) == NULL )
+	{
+		goto on_error;
+	}
 	return( 1 );
 
 on_error:
-	if( internal_context != NULL )
-	{
-		memory_free(
-		 internal_context );
-	}
+	memory_set(
+	 block,
+	 0,
+	 LIBHMAC_SHA256_BLOCK_SIZE );
+
+	memory_set(
+	 hash_values,
+	 0,
+	 sizeof( uint32_t ) * 8 );
+
 	return( -1 );
 }
 
-/* Frees a SHA-256 context
+/* Calculates the SHA-256 of 64 bytes of data using the selected kernel
+ * The data is transformed directly from the buffer, the second block only contains
+ * the padding and is transformed using its precomputed message schedule
  * Returns 1 if successful or -1 on error
  */
-int libhmac_sha256_context_free(
-     libhmac_sha256_context_t **context,
-     libcerror_error_t **error )
+int libhmac_sha256_context_calculate_64_bytes(
+     const uint8_t *buffer,
+     uint8_t *hash )
 {
-	libhmac_internal_sha256_context_t *internal_context = NULL;
-	static char *function                               = "libhmac_sha256_context_free";
+	uint32_t hash_values[ 8 ];
 
-	if( context == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid context.",
-		 function );
+	int hash_values_index = 0;
+	int kernel_index      = 0;
 
+	if( memory_copy(
+	     hash_values,
+	     libhmac_sha256_context_prime_square_roots,
+	     sizeof( uint32_t ) * 8 ) == NULL )
+	{
 		return( -1 );
 	}
-	if( *context != NULL )
-	{
-		internal_context = (libhmac_internal_sha256_context_t *) *context;
-		*context         = NULL;
-
-#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_SHA_H ) && defined( SHA256_DIGEST_LENGTH )
-		/* No additional clean up necessary
-		 */
-
-#elif defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_SHA256 )
-#if defined( HAVE_EVP_MD_CTX_CLEANUP )
-		if( EVP_MD_CTX_cleanup(
-		     &( internal_context->internal_evp_md_context ) ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to clean up EVP message digest context.",
-			 function );
-		}
-		/* Make sure the error state is removed otherwise OpenSSL will leak memory
-		 */
-		ERR_remove_thread_state(
-		 NULL );
-#else
-		EVP_MD_CTX_free(
-		 internal_context->evp_md_context );
-
-#endif /* defined( HAVE_EVP_MD_CTX_CLEANUP ) */
-
-		internal_context->evp_md_context = NULL;
-#else
-		/* No additional clean up necessary
-		 */
-#endif /* defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_SHA_H ) && defined( SHA256_DIGEST_LENGTH ) */
+	kernel_index = libhmac_sha256_context_get_kernel_index();
 
-		memory_free(
-		 internal_context );
+	if( libhmac_sha256_context_kernel_functions[ kernel_index ](
+	     hash_values,
+	     buffer,
+	     1 ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libhmac_sha256_context_kernel_schedule_functions[ kernel_index ](
+	     hash_values,
+	     libhmac_sha256_context_padding_64_bytes_schedule ) != 1 )
+	{
+		goto on_error;
+	}
+	for( hash_values_index = 0;
+	     hash_values_index < 8;
+	     hash_values_index++ )
+	{
+		byte_stream_copy_from_uint32_big_endian(
+		 &( hash[ hash_values_index * 4 ] ),
+		 hash_values[ hash_values_index ] );
+	}
+	/* Prevent sensitive data from leaking
+	 */
+	if( memory_set(
+	     hash_values,
+	     0,
+	     sizeof( uint32_t ) * 8 ) == NULL )
+	{
+		goto on_error;
 	}
 	return( 1 );
+
+on_error:
+	memory_set(
+	 hash_values,
+	 0,
+	 sizeof( uint32_t ) * 8 );
+
+	return( -1 );
 }
 
-#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_SHA_H ) && defined( SHA256_DIGEST_LENGTH )
+#if !defined( LIBHMAC_HAVE_SHA256_SUPPORT )
 
-/* Updates the SHA-256 context using OpenSSL
- * Returns 1 if successful or -1 on error
+/* Calculates the SHA-256 of 64 byte sized blocks of data in two buffers of the same size
+ * The blocks of both buffers are transformed interleaved if the kernel supports it
+ * Returns the number of bytes used of each buffer if successful or -1 on error
  */
-int libhmac_sha256_context_update(
-     libhmac_sha256_context_t *context,
-     const uint8_t *buffer,
-     size_t size,
-     libcerror_error_t **error )
+ssize_t libhmac_sha256_context_transform_pair(
+         libhmac_internal_sha256_context_t *first_internal_context,
+         const uint8_t *first_buffer,
+         libhmac_internal_sha256_context_t *second_internal_context,
+         const uint8_t *second_buffer,
+         size_t size,
+         libcerror_error_t **error )
 {
-	libhmac_internal_sha256_context_t *internal_context = NULL;
-	static char *function                               = "libhmac_sha256_context_update";
-	unsigned long safe_hash_size                        = 0;
+	static char *function   = "libhmac_sha256_context_transform_pair";
+	size_t number_of_blocks = 0;
+	int kernel_index        = 0;
 
-	if( context == NULL )
+	if( first_internal_context == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid context.",
+		 "%s: invalid first internal context.",
 		 function );
 
 		return( -1 );
 	}
-	internal_context = (libhmac_internal_sha256_context_t *) context;
-
-	if( buffer == NULL )
+	if( first_buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid buffer.",
+		 "%s: invalid first buffer.",
 		 function );
 
 		return( -1 );
 	}
-#if ( SIZEOF_LONG < SIZEOF_SIZE_T )
-	if( size > (size_t) ULONG_MAX )
-#else
-	if( size > (size_t) SSIZE_MAX )
-#endif
+	if( second_internal_context == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid size value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second internal context.",
 		 function );
 
 		return( -1 );
 	}
-	if( size == 0 )
+	if( second_buffer == NULL )
 	{
-		return( 1 );
-	}
-	safe_hash_size = (unsigned long) size;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second buffer.",
+		 function );
 
-	if( SHA256_Update(
-	     &( internal_context->sha256_context ),
-	     (const void *) buffer,
-	     size ) != 1 )
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to update context.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
+	number_of_blocks = size / LIBHMAC_SHA256_BLOCK_SIZE;
+
+	if( number_of_blocks > 0 )
+	{
+		kernel_index = libhmac_sha256_context_get_kernel_index();
+
+		if( libhmac_sha256_context_kernel_pair_functions[ kernel_index ] != NULL )
+		{
+			if( libhmac_sha256_context_kernel_pair_functions[ kernel_index ](
+			     first_internal_context->hash_values,
+			     first_buffer,
+			     second_internal_context->hash_values,
+			     second_buffer,
+			     number_of_blocks ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to transform blocks.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			if( libhmac_sha256_context_kernel_functions[ kernel_index ](
+			     first_internal_context->hash_values,
+			     first_buffer,
+			     number_of_blocks ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to transform first blocks.",
+				 function );
+
+				return( -1 );
+			}
+			if( libhmac_sha256_context_kernel_functions[ kernel_index ](
+			     second_internal_context->hash_values,
+			     second_buffer,
+			     number_of_blocks ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to transform second blocks.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	return( (ssize_t) ( number_of_blocks * LIBHMAC_SHA256_BLOCK_SIZE ) );
 }
 
-#elif defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_SHA256 )
+#endif /* !defined( LIBHMAC_HAVE_SHA256_SUPPORT ) */
 
-/* Updates the SHA-256 context using OpenSSL EVP
+/* Retrieves the type of the kernel used by the SHA-256 context
+ * Returns the kernel type
+ */
+int libhmac_sha256_context_get_kernel_type(
+     void )
+{
+#if defined( LIBHMAC_HAVE_SHA256_SUPPORT )
+	return( LIBHMAC_KERNEL_TYPE_LIBCRYPTO );
+#else
+	return( libhmac_sha256_context_kernel_types[ libhmac_sha256_context_get_kernel_index() ] );
+#endif
+}
+
+/* Initializes the SHA-256 context values in the internal context
  * Returns 1 if successful or -1 on error
  */
-int libhmac_sha256_context_update(
-     libhmac_sha256_context_t *context,
-     const uint8_t *buffer,
-     size_t size,
+int libhmac_internal_sha256_context_initialize(
+     libhmac_internal_sha256_context_t *internal_context,
      libcerror_error_t **error )
 {
-	libhmac_internal_sha256_context_t *internal_context = NULL;
-	static char *function                               = "libhmac_sha256_context_update";
+	static char *function     = "libhmac_internal_sha256_context_initialize";
 
-	if( context == NULL )
+#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_SHA256 )
+	const EVP_MD *evp_md_type = NULL;
+#endif
+
+	if( internal_context == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -784,44 +1076,1734 @@ int libhmac_sha256_context_update(
 
 		return( -1 );
 	}
-	internal_context = (libhmac_internal_sha256_context_t *) context;
+	if( memory_set(
+	     internal_context,
+	     0,
+	     sizeof( libhmac_internal_sha256_context_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear context.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_SHA_H ) && defined( SHA256_DIGEST_LENGTH )
+	if( SHA256_Init(
+	     &( internal_context->sha256_context ) ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize context.",
+		 function );
+
+		return( -1 );
+	}
+
+#elif defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_SHA256 )
+#if defined( HAVE_EVP_MD_CTX_INIT )
+	EVP_MD_CTX_init(
+	 &( internal_context->internal_evp_md_context ) );
+
+	internal_context->evp_md_context = &( internal_context->internal_evp_md_context );
+#else
+	internal_context->evp_md_context = EVP_MD_CTX_new();
+
+	if( internal_context->evp_md_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create EVP message digest context.",
+		 function );
+
+		return( -1 );
+	}
+#endif /* defined( HAVE_EVP_MD_CTX_INIT ) */
+
+/* TODO use EVP_MD_fetch for EVP_DigestInit_ex2 */
+	evp_md_type = EVP_sha256();
+
+#if defined( HAVE_EVP_DIGESTINIT_EX2 )
+	if( EVP_DigestInit_ex2(
+	     internal_context->evp_md_context,
+	     evp_md_type,
+	     NULL ) != 1 )
+#else
+	if( EVP_DigestInit_ex(
+	     internal_context->evp_md_context,
+	     evp_md_type,
+	     NULL ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize context.",
+		 function );
+
+#if defined( HAVE_EVP_MD_CTX_CLEANUP )
+		EVP_MD_CTX_cleanup(
+		 &( internal_context->internal_evp_md_context ) );
+		ERR_remove_thread_state(
+		 NULL );
+#else
+		EVP_MD_CTX_free(
+		 internal_context->evp_md_context );
+#endif
+		internal_context->evp_md_context = NULL;
+
+		return( -1 );
+	}
+#else
+	if( memory_copy(
+	     internal_context->hash_values,
+	     libhmac_sha256_context_prime_square_roots,
+	     sizeof( uint32_t ) * 8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy initial hash values.",
+		 function );
+
+		return( -1 );
+	}
+#endif /* defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_SHA_H ) && defined( SHA256_DIGEST_LENGTH ) */
+
+	return( 1 );
+}
+
+/* Clears the SHA-256 context values in the internal context
+ * Releases the resources held by the context values but not the internal context itself
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_internal_sha256_context_clear(
+     libhmac_internal_sha256_context_t *internal_context,
+     libcerror_error_t **error )
+{
+	static char *function = "libhmac_internal_sha256_context_clear";
+	int result            = 1;
+
+	if( internal_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_SHA_H ) && defined( SHA256_DIGEST_LENGTH )
+	/* No additional clean up necessary
+	 */
+
+#elif defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_SHA256 )
+#if defined( HAVE_EVP_MD_CTX_CLEANUP )
+	if( EVP_MD_CTX_cleanup(
+	     &( internal_context->internal_evp_md_context ) ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clean up EVP message digest context.",
+		 function );
+
+		result = -1;
+	}
+	/* Make sure the error state is removed otherwise OpenSSL will leak memory
+	 */
+	ERR_remove_thread_state(
+	 NULL );
+#else
+	EVP_MD_CTX_free(
+	 internal_context->evp_md_context );
+
+#endif /* defined( HAVE_EVP_MD_CTX_CLEANUP ) */
+
+	internal_context->evp_md_context = NULL;
+#else
+	/* No additional clean up necessary
+	 */
+#endif /* defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_SHA_H ) && defined( SHA256_DIGEST_LENGTH ) */
+
+	return( result );
+}
+
+/* Copies the SHA-256 context values of the source to the destination internal context
+ * The destination internal context must have been initialized
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_internal_sha256_context_copy(
+     libhmac_internal_sha256_context_t *destination_internal_context,
+     libhmac_internal_sha256_context_t *source_internal_context,
+     libcerror_error_t **error )
+{
+	static char *function = "libhmac_internal_sha256_context_copy";
+
+	if( destination_internal_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination context.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_internal_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source context.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_SHA256 )
+	if( EVP_MD_CTX_copy_ex(
+	     destination_internal_context->evp_md_context,
+	     source_internal_context->evp_md_context ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy EVP message digest context.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	if( memory_copy(
+	     destination_internal_context,
+	     source_internal_context,
+	     sizeof( libhmac_internal_sha256_context_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy source to destination context.",
+		 function );
+
+		return( -1 );
+	}
+#endif /* defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_SHA256 ) */
+
+	return( 1 );
+}
+
+/* Creates a SHA-256 context
+ * Make sure the value context is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_sha256_context_initialize(
+     libhmac_sha256_context_t **context,
+     libcerror_error_t **error )
+{
+	libhmac_internal_sha256_context_t *internal_context = NULL;
+	static char *function                               = "libhmac_sha256_context_initialize";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid context value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_context = memory_allocate_structure(
+	                    libhmac_internal_sha256_context_t );
+
+	if( internal_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create context.",
+		 function );
+
+		goto on_error;
+	}
+	if( libhmac_internal_sha256_context_initialize(
+	     internal_context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize context.",
+		 function );
+
+		goto on_error;
+	}
+	*context = (libhmac_sha256_context_t *) internal_context;
+
+	return( 1 );
+
+on_error:
+	if( internal_context != NULL )
+	{
+		memory_free(
+		 internal_context );
+	}
+	return( -1 );
+}
+
+/* Frees a SHA-256 context
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_sha256_context_free(
+     libhmac_sha256_context_t **context,
+     libcerror_error_t **error )
+{
+	libhmac_internal_sha256_context_t *internal_context = NULL;
+	static char *function                               = "libhmac_sha256_context_free";
+	int result                                          = 1;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *context != NULL )
+	{
+		internal_context = (libhmac_internal_sha256_context_t *) *context;
+		*context         = NULL;
+
+		if( libhmac_internal_sha256_context_clear(
+		     internal_context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear context.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_context );
+	}
+	return( result );
+}
+
+/* Retrieves the size and alignment of the memory of a SHA-256 context
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_sha256_context_get_size(
+     size_t *context_size,
+     size_t *context_alignment,
+     libcerror_error_t **error )
+{
+	static char *function = "libhmac_sha256_context_get_size";
+
+	if( context_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context size.",
+		 function );
+
+		return( -1 );
+	}
+	if( context_alignment == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context alignment.",
+		 function );
+
+		return( -1 );
+	}
+	*context_size      = sizeof( libhmac_internal_sha256_context_t );
+	*context_alignment = sizeof( libhmac_sha256_context_alignment_t ) - sizeof( libhmac_internal_sha256_context_t );
+
+	return( 1 );
+}
+
+/* Creates a SHA-256 context in caller provided memory
+ * The memory must be at least the size and have the alignment retrieved
+ * by libhmac_sha256_context_get_size and must remain available until the
+ * context is freed with libhmac_sha256_context_free_in_place
+ * Make sure the value context is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_sha256_context_initialize_in_place(
+     libhmac_sha256_context_t **context,
+     uint8_t *memory,
+     size_t memory_size,
+     libcerror_error_t **error )
+{
+	libhmac_internal_sha256_context_t *internal_context = NULL;
+	static char *function                               = "libhmac_sha256_context_initialize_in_place";
+	size_t context_alignment                            = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid context value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid memory size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_size < sizeof( libhmac_internal_sha256_context_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid memory size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	context_alignment = sizeof( libhmac_sha256_context_alignment_t ) - sizeof( libhmac_internal_sha256_context_t );
+
+	if( ( (intptr_t) memory % (intptr_t) context_alignment ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid memory value not aligned.",
+		 function );
+
+		return( -1 );
+	}
+	internal_context = (libhmac_internal_sha256_context_t *) memory;
+
+	if( libhmac_internal_sha256_context_initialize(
+	     internal_context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize context.",
+		 function );
+
+		return( -1 );
+	}
+	*context = (libhmac_sha256_context_t *) internal_context;
+
+	return( 1 );
+}
+
+/* Frees a SHA-256 context created in caller provided memory
+ * The memory itself is not freed
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_sha256_context_free_in_place(
+     libhmac_sha256_context_t **context,
+     libcerror_error_t **error )
+{
+	libhmac_internal_sha256_context_t *internal_context = NULL;
+	static char *function                               = "libhmac_sha256_context_free_in_place";
+	int result                                          = 1;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *context != NULL )
+	{
+		internal_context = (libhmac_internal_sha256_context_t *) *context;
+		*context         = NULL;
+
+		if( libhmac_internal_sha256_context_clear(
+		     internal_context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear context.",
+			 function );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Resets a SHA-256 context
+ * The context can be reused to calculate a new hash without being freed and reinitialized
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_sha256_context_reset(
+     libhmac_sha256_context_t *context,
+     libcerror_error_t **error )
+{
+	libhmac_internal_sha256_context_t *internal_context = NULL;
+	static char *function                               = "libhmac_sha256_context_reset";
+
+#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_SHA256 )
+	const EVP_MD *evp_md_type                           = NULL;
+#endif
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	internal_context = (libhmac_internal_sha256_context_t *) context;
+
+#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_SHA_H ) && defined( SHA256_DIGEST_LENGTH )
+	if( SHA256_Init(
+	     &( internal_context->sha256_context ) ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize context.",
+		 function );
+
+		return( -1 );
+	}
+
+#elif defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_SHA256 )
+/* TODO use EVP_MD_fetch for EVP_DigestInit_ex2 */
+	evp_md_type = EVP_sha256();
+
+#if defined( HAVE_EVP_DIGESTINIT_EX2 )
+	if( EVP_DigestInit_ex2(
+	     internal_context->evp_md_context,
+	     evp_md_type,
+	     NULL ) != 1 )
+#else
+	if( EVP_DigestInit_ex(
+	     internal_context->evp_md_context,
+	     evp_md_type,
+	     NULL ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize context.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	if( memory_copy(
+	     internal_context->hash_values,
+	     libhmac_sha256_context_prime_square_roots,
+	     sizeof( uint32_t ) * 8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy initial hash values.",
+		 function );
+
+		return( -1 );
+	}
+	internal_context->hash_count   = 0;
+	internal_context->block_offset = 0;
+#endif /* defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_SHA_H ) && defined( SHA256_DIGEST_LENGTH ) */
+
+	return( 1 );
+}
+
+/* Clones (duplicates) the SHA-256 context
+ * The clone continues from the state of the source context
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_sha256_context_clone(
+     libhmac_sha256_context_t **destination_context,
+     libhmac_sha256_context_t *source_context,
+     libcerror_error_t **error )
+{
+	libhmac_internal_sha256_context_t *internal_destination_context = NULL;
+	libhmac_internal_sha256_context_t *internal_source_context      = NULL;
+	static char *function                                           = "libhmac_sha256_context_clone";
+
+	if( destination_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination context value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_context == NULL )
+	{
+		*destination_context = NULL;
+
+		return( 1 );
+	}
+	internal_source_context = (libhmac_internal_sha256_context_t *) source_context;
+
+	internal_destination_context = memory_allocate_structure(
+	                                libhmac_internal_sha256_context_t );
+
+	if( internal_destination_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create destination context.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_SHA256 )
+	if( memory_set(
+	     internal_destination_context,
+	     0,
+	     sizeof( libhmac_internal_sha256_context_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear destination context.",
+		 function );
+
+		memory_free(
+		 internal_destination_context );
+
+		return( -1 );
+	}
+#if defined( HAVE_EVP_MD_CTX_INIT )
+	EVP_MD_CTX_init(
+	 &( internal_destination_context->internal_evp_md_context ) );
+
+	internal_destination_context->evp_md_context = &( internal_destination_context->internal_evp_md_context );
+#else
+	internal_destination_context->evp_md_context = EVP_MD_CTX_new();
+
+	if( internal_destination_context->evp_md_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create EVP message digest context.",
+		 function );
+
+		goto on_error;
+	}
+#endif /* defined( HAVE_EVP_MD_CTX_INIT ) */
+
+	if( EVP_MD_CTX_copy_ex(
+	     internal_destination_context->evp_md_context,
+	     internal_source_context->evp_md_context ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy EVP message digest context.",
+		 function );
+
+		goto on_error;
+	}
+#else
+	if( memory_copy(
+	     internal_destination_context,
+	     internal_source_context,
+	     sizeof( libhmac_internal_sha256_context_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy source to destination context.",
+		 function );
+
+		goto on_error;
+	}
+#endif /* defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_SHA256 ) */
+
+	*destination_context = (libhmac_sha256_context_t *) internal_destination_context;
+
+	return( 1 );
+
+on_error:
+	if( internal_destination_context != NULL )
+	{
+		libhmac_internal_sha256_context_clear(
+		 internal_destination_context,
+		 NULL );
+
+		memory_free(
+		 internal_destination_context );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_SHA_H ) && defined( SHA256_DIGEST_LENGTH )
+
+/* Updates the SHA-256 context using OpenSSL
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_sha256_context_update(
+     libhmac_sha256_context_t *context,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	libhmac_internal_sha256_context_t *internal_context = NULL;
+	static char *function                               = "libhmac_sha256_context_update";
+	unsigned long safe_hash_size                        = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	internal_context = (libhmac_internal_sha256_context_t *) context;
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+#if ( SIZEOF_LONG < SIZEOF_SIZE_T )
+	if( size > (size_t) ULONG_MAX )
+#else
+	if( size > (size_t) SSIZE_MAX )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == 0 )
+	{
+		return( 1 );
+	}
+	safe_hash_size = (unsigned long) size;
+
+	if( SHA256_Update(
+	     &( internal_context->sha256_context ),
+	     (const void *) buffer,
+	     size ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update context.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#elif defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_SHA256 )
+
+/* Updates the SHA-256 context using OpenSSL EVP
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_sha256_context_update(
+     libhmac_sha256_context_t *context,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	libhmac_internal_sha256_context_t *internal_context = NULL;
+	static char *function                               = "libhmac_sha256_context_update";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	internal_context = (libhmac_internal_sha256_context_t *) context;
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == 0 )
+	{
+		return( 1 );
+	}
+	if( EVP_DigestUpdate(
+	     internal_context->evp_md_context,
+	     (const void *) buffer,
+	     size ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update context.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#else
+
+/* Updates the SHA-256 context using fallback implementation
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_sha256_context_update(
+     libhmac_sha256_context_t *context,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	libhmac_internal_sha256_context_t *internal_context = NULL;
+	static char *function                               = "libhmac_sha256_context_update";
+	size_t buffer_offset                                = 0;
+	size_t remaining_block_size                         = 0;
+	ssize_t process_count                               = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	internal_context = (libhmac_internal_sha256_context_t *) context;
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == 0 )
+	{
+		return( 1 );
+	}
+	if( internal_context->block_offset > 0 )
+	{
+		if( internal_context->block_offset >= LIBHMAC_SHA256_BLOCK_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid context - block offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		remaining_block_size = LIBHMAC_SHA256_BLOCK_SIZE - internal_context->block_offset;
+
+		if( remaining_block_size > size )
+		{
+			remaining_block_size = size;
+		}
+		if( memory_copy(
+		     &( internal_context->block[ internal_context->block_offset ] ),
+		     buffer,
+		     remaining_block_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data to context block.",
+			 function );
+
+			return( -1 );
+		}
+		internal_context->block_offset += remaining_block_size;
+
+		if( internal_context->block_offset < LIBHMAC_SHA256_BLOCK_SIZE )
+		{
+			return( 1 );
+		}
+		buffer_offset += remaining_block_size;
+		size          -= remaining_block_size;
+
+		process_count = libhmac_sha256_context_transform(
+		                 internal_context,
+		                 internal_context->block,
+		                 LIBHMAC_SHA256_BLOCK_SIZE,
+		                 error );
+
+		if( process_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to transform context block.",
+			 function );
+
+			return( -1 );
+		}
+		internal_context->hash_count  += process_count;
+		internal_context->block_offset = 0;
+	}
+	if( size > 0 )
+	{
+		process_count = libhmac_sha256_context_transform(
+		                 internal_context,
+		                 &( buffer[ buffer_offset ] ),
+		                 size,
+		                 error );
+
+		if( process_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to transform buffer.",
+			 function );
+
+			return( -1 );
+		}
+		internal_context->hash_count += process_count;
+
+		buffer_offset += process_count;
+		size          -= process_count;
+	}
+	if( size > 0 )
+	{
+		if( size >= LIBHMAC_SHA256_BLOCK_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     internal_context->block,
+		     &( buffer[ buffer_offset ] ),
+		     size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy remaining data to context block.",
+			 function );
+
+			return( -1 );
+		}
+		internal_context->block_offset = size;
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_SHA_H ) && defined( SHA256_DIGEST_LENGTH ) */
+
+/* Updates the SHA-256 context using multiple buffers
+ * The buffers are hashed as if they were a single contiguous buffer, where only
+ * the data that crosses a block boundary is copied into the context block
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_sha256_context_update_iov(
+     libhmac_sha256_context_t *context,
+     const uint8_t **buffers,
+     const size_t *sizes,
+     int number_of_buffers,
+     libcerror_error_t **error )
+{
+	libhmac_internal_sha256_context_t *internal_context = NULL;
+	static char *function                               = "libhmac_sha256_context_update_iov";
+	int buffer_index                                    = 0;
+
+#if !defined( LIBHMAC_HAVE_SHA256_SUPPORT )
+	const uint8_t *buffer                               = NULL;
+	size_t buffer_offset                                = 0;
+	size_t remaining_block_size                         = 0;
+	size_t size                                         = 0;
+	ssize_t process_count                               = 0;
+#endif
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	internal_context = (libhmac_internal_sha256_context_t *) context;
+
+	if( buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffers.",
+		 function );
+
+		return( -1 );
+	}
+	if( sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_buffers < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of buffers value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	/* All the buffers are checked before any of them is hashed
+	 * so that the context is not partially updated on error
+	 */
+	for( buffer_index = 0;
+	     buffer_index < number_of_buffers;
+	     buffer_index++ )
+	{
+		if( buffers[ buffer_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid buffer: %d.",
+			 function,
+			 buffer_index );
+
+			return( -1 );
+		}
+		if( sizes[ buffer_index ] > (size_t) SSIZE_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid size: %d value exceeds maximum.",
+			 function,
+			 buffer_index );
+
+			return( -1 );
+		}
+	}
+	for( buffer_index = 0;
+	     buffer_index < number_of_buffers;
+	     buffer_index++ )
+	{
+		if( sizes[ buffer_index ] == 0 )
+		{
+			continue;
+		}
+#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_SHA_H ) && defined( SHA256_DIGEST_LENGTH )
+		if( SHA256_Update(
+		     &( internal_context->sha256_context ),
+		     (const void *) buffers[ buffer_index ],
+		     sizes[ buffer_index ] ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update context.",
+			 function );
+
+			return( -1 );
+		}
+#elif defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_SHA256 )
+		if( EVP_DigestUpdate(
+		     internal_context->evp_md_context,
+		     (const void *) buffers[ buffer_index ],
+		     sizes[ buffer_index ] ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update context.",
+			 function );
+
+			return( -1 );
+		}
+#else
+		buffer        = buffers[ buffer_index ];
+		size          = sizes[ buffer_index ];
+		buffer_offset = 0;
+
+		if( internal_context->block_offset > 0 )
+		{
+			if( internal_context->block_offset >= LIBHMAC_SHA256_BLOCK_SIZE )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid context - block offset value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			/* Stitch the start of the buffer to the data of the previous buffers
+			 */
+			remaining_block_size = LIBHMAC_SHA256_BLOCK_SIZE - internal_context->block_offset;
+
+			if( remaining_block_size > size )
+			{
+				remaining_block_size = size;
+			}
+			if( memory_copy(
+			     &( internal_context->block[ internal_context->block_offset ] ),
+			     buffer,
+			     remaining_block_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy data to context block.",
+				 function );
+
+				return( -1 );
+			}
+			internal_context->block_offset += remaining_block_size;
+
+			if( internal_context->block_offset < LIBHMAC_SHA256_BLOCK_SIZE )
+			{
+				continue;
+			}
+			buffer_offset += remaining_block_size;
+			size          -= remaining_block_size;
+
+			process_count = libhmac_sha256_context_transform(
+			                 internal_context,
+			                 internal_context->block,
+			                 LIBHMAC_SHA256_BLOCK_SIZE,
+			                 error );
+
+			if( process_count == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to transform context block.",
+				 function );
+
+				return( -1 );
+			}
+			internal_context->hash_count  += process_count;
+			internal_context->block_offset = 0;
+		}
+		/* The whole blocks are transformed directly from the buffer
+		 */
+		if( size >= LIBHMAC_SHA256_BLOCK_SIZE )
+		{
+			process_count = libhmac_sha256_context_transform(
+			                 internal_context,
+			                 &( buffer[ buffer_offset ] ),
+			                 size,
+			                 error );
+
+			if( process_count == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to transform buffer: %d.",
+				 function,
+				 buffer_index );
+
+				return( -1 );
+			}
+			internal_context->hash_count += process_count;
+
+			buffer_offset += process_count;
+			size          -= process_count;
+		}
+		if( size > 0 )
+		{
+			if( size >= LIBHMAC_SHA256_BLOCK_SIZE )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid size value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			if( memory_copy(
+			     internal_context->block,
+			     &( buffer[ buffer_offset ] ),
+			     size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy remaining data to context block.",
+				 function );
+
+				return( -1 );
+			}
+			internal_context->block_offset = size;
+		}
+#endif /* defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_SHA_H ) && defined( SHA256_DIGEST_LENGTH ) */
+	}
+	return( 1 );
+}
+
+/* Updates two SHA-256 contexts in lockstep
+ * The full blocks both buffers have in common are transformed interleaved if the kernel supports it
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_sha256_context_update_pair(
+     libhmac_sha256_context_t *first_context,
+     const uint8_t *first_buffer,
+     size_t first_size,
+     libhmac_sha256_context_t *second_context,
+     const uint8_t *second_buffer,
+     size_t second_size,
+     libcerror_error_t **error )
+{
+	static char *function                                      = "libhmac_sha256_context_update_pair";
+	size_t first_buffer_offset                                 = 0;
+	size_t second_buffer_offset                                = 0;
 
-	if( buffer == NULL )
+#if !defined( LIBHMAC_HAVE_SHA256_SUPPORT )
+	libhmac_internal_sha256_context_t *first_internal_context  = NULL;
+	libhmac_internal_sha256_context_t *second_internal_context = NULL;
+	size_t remaining_block_size                                = 0;
+	ssize_t process_count                                      = 0;
+#endif
+
+	if( first_context == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid buffer.",
+		 "%s: invalid first context.",
 		 function );
 
 		return( -1 );
 	}
-	if( size > (size_t) SSIZE_MAX )
+	if( first_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid size value exceeds maximum.",
+		 "%s: invalid first size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( size == 0 )
+	if( second_context == NULL )
 	{
-		return( 1 );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second context.",
+		 function );
+
+		return( -1 );
 	}
-	if( EVP_DigestUpdate(
+	if( second_context == first_context )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second context value same as first context.",
+		 function );
+
+		return( -1 );
+	}
+	if( second_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( second_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid second size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if !defined( LIBHMAC_HAVE_SHA256_SUPPORT )
+	first_internal_context  = (libhmac_internal_sha256_context_t *) first_context;
+	second_internal_context = (libhmac_internal_sha256_context_t *) second_context;
+
+	/* Complete the partial blocks in the contexts first so that the buffers are block aligned
+	 */
+	if( first_internal_context->block_offset > 0 )
+	{
+		remaining_block_size = LIBHMAC_SHA256_BLOCK_SIZE - first_internal_context->block_offset;
+
+		if( remaining_block_size > first_size )
+		{
+			remaining_block_size = first_size;
+		}
+		if( libhmac_sha256_context_update(
+		     first_context,
+		     first_buffer,
+		     remaining_block_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update first context.",
+			 function );
+
+			return( -1 );
+		}
+		first_buffer_offset += remaining_block_size;
+		first_size          -= remaining_block_size;
+	}
+	if( second_internal_context->block_offset > 0 )
+	{
+		remaining_block_size = LIBHMAC_SHA256_BLOCK_SIZE - second_internal_context->block_offset;
+
+		if( remaining_block_size > second_size )
+		{
+			remaining_block_size = second_size;
+		}
+		if( libhmac_sha256_context_update(
+		     second_context,
+		     second_buffer,
+		     remaining_block_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update second context.",
+			 function );
+
+			return( -1 );
+		}
+		second_buffer_offset += remaining_block_size;
+		second_size          -= remaining_block_size;
+	}
+	if( ( first_size >= LIBHMAC_SHA256_BLOCK_SIZE )
+	 && ( second_size >= LIBHMAC_SHA256_BLOCK_SIZE ) )
+	{
+		process_count = libhmac_sha256_context_transform_pair(
+		                 first_internal_context,
+		                 &( first_buffer[ first_buffer_offset ] ),
+		                 second_internal_context,
+		                 &( second_buffer[ second_buffer_offset ] ),
+		                 ( first_size < second_size ) ? first_size : second_size,
+		                 error );
+
+		if( process_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to transform buffers.",
+			 function );
+
+			return( -1 );
+		}
+		first_internal_context->hash_count  += process_count;
+		second_internal_context->hash_count += process_count;
+
+		first_buffer_offset  += process_count;
+		first_size           -= process_count;
+		second_buffer_offset += process_count;
+		second_size          -= process_count;
+	}
+#endif /* !defined( LIBHMAC_HAVE_SHA256_SUPPORT ) */
+
+	/* Update the contexts with the remaining data
+	 */
+	if( libhmac_sha256_context_update(
+	     first_context,
+	     &( first_buffer[ first_buffer_offset ] ),
+	     first_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update first context.",
+		 function );
+
+		return( -1 );
+	}
+	if( libhmac_sha256_context_update(
+	     second_context,
+	     &( second_buffer[ second_buffer_offset ] ),
+	     second_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update second context.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_SHA_H ) && defined( SHA256_DIGEST_LENGTH )
+
+/* Finalizes the SHA-256 context using OpenSSL
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_sha256_context_finalize(
+     libhmac_sha256_context_t *context,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error )
+{
+	libhmac_internal_sha256_context_t *internal_context = NULL;
+	static char *function                               = "libhmac_sha256_context_finalize";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	internal_context = (libhmac_internal_sha256_context_t *) context;
+
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid hash size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_size < (size_t) LIBHMAC_SHA256_HASH_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid hash size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( SHA256_Final(
+	     hash,
+	     &( internal_context->sha256_context ) ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize context.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#elif defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_SHA256 )
+
+/* Finalizes the SHA-256 context using OpenSSL EVP
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_sha256_context_finalize(
+     libhmac_sha256_context_t *context,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error )
+{
+	libhmac_internal_sha256_context_t *internal_context = NULL;
+	static char *function                               = "libhmac_sha256_context_finalize";
+	unsigned int safe_hash_size                         = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	internal_context = (libhmac_internal_sha256_context_t *) context;
+
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( hash_size < (size_t) LIBHMAC_SHA256_HASH_SIZE )
+	 || ( hash_size > (size_t) UINT_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid hash size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	safe_hash_size = (unsigned int) hash_size;
+
+	if( EVP_DigestFinal_ex(
 	     internal_context->evp_md_context,
-	     (const void *) buffer,
-	     size ) != 1 )
+	     (unsigned char *) hash,
+	     &safe_hash_size ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to update context.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize context.",
 		 function );
 
 		return( -1 );
@@ -831,20 +2813,26 @@ int libhmac_sha256_context_update(
 
 #else
 
-/* Updates the SHA-256 context using fallback implementation
+/* Finalizes the SHA-256 context using fallback implementation
  * Returns 1 if successful or -1 on error
  */
-int libhmac_sha256_context_update(
+int libhmac_sha256_context_finalize(
      libhmac_sha256_context_t *context,
-     const uint8_t *buffer,
-     size_t size,
+     uint8_t *hash,
+     size_t hash_size,
      libcerror_error_t **error )
 {
 	libhmac_internal_sha256_context_t *internal_context = NULL;
-	static char *function                               = "libhmac_sha256_context_update";
-	size_t buffer_offset                                = 0;
-	size_t remaining_block_size                         = 0;
+	static char *function                               = "libhmac_sha256_context_finalize";
+	size_t block_size                                   = 0;
+	size_t number_of_blocks                             = 0;
 	ssize_t process_count                               = 0;
+	uint64_t bit_size                                   = 0;
+
+#if !defined( LIBHMAC_UNFOLLED_LOOPS )
+	size_t hash_index                                   = 0;
+	int hash_values_index                               = 0;
+#endif
 
 	if( context == NULL )
 	{
@@ -859,165 +2847,181 @@ int libhmac_sha256_context_update(
 	}
 	internal_context = (libhmac_internal_sha256_context_t *) context;
 
-	if( buffer == NULL )
+	if( hash == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid buffer.",
+		 "%s: invalid hash.",
 		 function );
 
 		return( -1 );
 	}
-	if( size > (size_t) SSIZE_MAX )
+	if( hash_size < (size_t) LIBHMAC_SHA256_HASH_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid hash value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid size value exceeds maximum.",
+		 "%s: invalid hash size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( size == 0 )
+	if( hash_size < (size_t) LIBHMAC_SHA256_HASH_SIZE )
 	{
-		return( 1 );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid hash size value too small.",
+		 function );
+
+		return( -1 );
 	}
-	if( internal_context->block_offset > 0 )
+	/* Add padding with a size of 56 mod 64
+	 */
+	number_of_blocks = 1;
+
+	if( internal_context->block_offset > 55 )
 	{
-		if( internal_context->block_offset >= LIBHMAC_SHA256_BLOCK_SIZE )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid context - block offset value out of bounds.",
-			 function );
+		number_of_blocks += 1;
+	}
+	block_size = number_of_blocks * LIBHMAC_SHA256_BLOCK_SIZE;
 
-			return( -1 );
-		}
-		remaining_block_size = LIBHMAC_SHA256_BLOCK_SIZE - internal_context->block_offset;
+	if( memory_set(
+	     &( internal_context->block[ internal_context->block_offset ] ),
+	     0,
+	     block_size - internal_context->block_offset ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear context block.",
+		 function );
 
-		if( remaining_block_size > size )
-		{
-			remaining_block_size = size;
-		}
-		if( memory_copy(
-		     &( internal_context->block[ internal_context->block_offset ] ),
-		     buffer,
-		     remaining_block_size ) == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy data to context block.",
-			 function );
+		return( -1 );
+	}
+	/* The first byte of the padding contains 0x80
+	 */
+	internal_context->block[ internal_context->block_offset ] = 0x80;
 
-			return( -1 );
-		}
-		internal_context->block_offset += remaining_block_size;
+	bit_size = ( internal_context->hash_count + internal_context->block_offset ) * 8;
 
-		if( internal_context->block_offset < LIBHMAC_SHA256_BLOCK_SIZE )
-		{
-			return( 1 );
-		}
-		buffer_offset += remaining_block_size;
-		size          -= remaining_block_size;
+	byte_stream_copy_from_uint64_big_endian(
+	 &( internal_context->block[ block_size - 8 ] ),
+	 bit_size );
 
-		process_count = libhmac_sha256_context_transform(
-		                 internal_context,
-		                 internal_context->block,
-		                 LIBHMAC_SHA256_BLOCK_SIZE,
-		                 error );
+	process_count = libhmac_sha256_context_transform(
+	                 internal_context,
+	                 internal_context->block,
+	                 block_size,
+	                 error );
 
-		if( process_count == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to transform context block.",
-			 function );
+	if( process_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to transform context block.",
+		 function );
 
-			return( -1 );
-		}
-		internal_context->hash_count  += process_count;
-		internal_context->block_offset = 0;
+		return( -1 );
 	}
-	if( size > 0 )
+#if !defined( LIBHMAC_UNFOLLED_LOOPS )
+	for( hash_values_index = 0;
+	     hash_values_index < 8;
+	     hash_values_index++ )
 	{
-		process_count = libhmac_sha256_context_transform(
-		                 internal_context,
-		                 &( buffer[ buffer_offset ] ),
-		                 size,
-		                 error );
+		byte_stream_copy_from_uint32_big_endian(
+		 &( hash[ hash_index ] ),
+		 internal_context->hash_values[ hash_values_index ] );
 
-		if( process_count == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to transform buffer.",
-			 function );
+		hash_index += sizeof( uint32_t );
+	}
+#else
+	byte_stream_copy_from_uint32_big_endian(
+	 &( hash[ 0 ] ),
+	 internal_context->hash_values[ 0 ] );
 
-			return( -1 );
-		}
-		internal_context->hash_count += process_count;
+	byte_stream_copy_from_uint32_big_endian(
+	 &( hash[ 4 ] ),
+	 internal_context->hash_values[ 1 ] );
 
-		buffer_offset += process_count;
-		size          -= process_count;
-	}
-	if( size > 0 )
-	{
-		if( size >= LIBHMAC_SHA256_BLOCK_SIZE )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid size value out of bounds.",
-			 function );
+	byte_stream_copy_from_uint32_big_endian(
+	 &( hash[ 8 ] ),
+	 internal_context->hash_values[ 2 ] );
 
-			return( -1 );
-		}
-		if( memory_copy(
-		     internal_context->block,
-		     &( buffer[ buffer_offset ] ),
-		     size ) == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy remaining data to context block.",
-			 function );
+	byte_stream_copy_from_uint32_big_endian(
+	 &( hash[ 12 ] ),
+	 internal_context->hash_values[ 3 ] );
 
-			return( -1 );
-		}
-		internal_context->block_offset = size;
+	byte_stream_copy_from_uint32_big_endian(
+	 &( hash[ 16 ] ),
+	 internal_context->hash_values[ 4 ] );
+
+	byte_stream_copy_from_uint32_big_endian(
+	 &( hash[ 20 ] ),
+	 internal_context->hash_values[ 5 ] );
+
+	byte_stream_copy_from_uint32_big_endian(
+	 &( hash[ 24 ] ),
+	 internal_context->hash_values[ 6 ] );
+
+	byte_stream_copy_from_uint32_big_endian(
+	 &( hash[ 28 ] ),
+	 internal_context->hash_values[ 7 ] );
+
+#endif /* !defined( LIBHMAC_UNFOLLED_LOOPS ) */
+
+	/* Prevent sensitive data from leaking
+	 */
+	if( memory_set(
+	     internal_context,
+	     0,
+	     sizeof( libhmac_internal_sha256_context_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear context.",
+		 function );
+
+		return( -1 );
 	}
 	return( 1 );
 }
 
 #endif /* defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_SHA_H ) && defined( SHA256_DIGEST_LENGTH ) */
 
-#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_SHA_H ) && defined( SHA256_DIGEST_LENGTH )
+#if defined( LIBHMAC_HAVE_SHA256_SUPPORT )
 
-/* Finalizes the SHA-256 context using OpenSSL
- * Returns 1 if successful or -1 on error
+/* Exports the SHA-256 context state using OpenSSL
+ * The state of an OpenSSL context is opaque and cannot be exported
+ * Returns -1 on error
  */
-int libhmac_sha256_context_finalize(
+int libhmac_sha256_context_export_state(
      libhmac_sha256_context_t *context,
-     uint8_t *hash,
-     size_t hash_size,
+     uint8_t *state,
+     size_t state_size,
      libcerror_error_t **error )
 {
-	libhmac_internal_sha256_context_t *internal_context = NULL;
-	static char *function                               = "libhmac_sha256_context_finalize";
+	static char *function = "libhmac_sha256_context_export_state";
 
 	if( context == NULL )
 	{
@@ -1030,71 +3034,110 @@ int libhmac_sha256_context_finalize(
 
 		return( -1 );
 	}
-	internal_context = (libhmac_internal_sha256_context_t *) context;
-
-	if( hash == NULL )
+	if( state == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid hash.",
+		 "%s: invalid state.",
 		 function );
 
 		return( -1 );
 	}
-	if( hash_size > (size_t) SSIZE_MAX )
+	if( state_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid hash size value exceeds maximum.",
+		 "%s: invalid state size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( hash_size < (size_t) LIBHMAC_SHA256_HASH_SIZE )
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: exporting the state of an OpenSSL context is not supported.",
+	 function );
+
+	return( -1 );
+}
+
+/* Imports the SHA-256 context state using OpenSSL
+ * The state of an OpenSSL context is opaque and cannot be imported
+ * Returns -1 on error
+ */
+int libhmac_sha256_context_import_state(
+     libhmac_sha256_context_t *context,
+     const uint8_t *state,
+     size_t state_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libhmac_sha256_context_import_state";
+
+	if( context == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: invalid hash size value too small.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
 		 function );
 
 		return( -1 );
 	}
-	if( SHA256_Final(
-	     hash,
-	     &( internal_context->sha256_context ) ) != 1 )
+	if( state == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to finalize context.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid state.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
+	if( state_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid state size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: importing the state of an OpenSSL context is not supported.",
+	 function );
+
+	return( -1 );
 }
 
-#elif defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_SHA256 )
+#else
 
-/* Finalizes the SHA-256 context using OpenSSL EVP
+/* Exports the SHA-256 context state using fallback implementation
+ * The state contains the data hashed so far, including the data of a partial block,
+ * and can be imported to continue hashing, for example in another process
  * Returns 1 if successful or -1 on error
  */
-int libhmac_sha256_context_finalize(
+int libhmac_sha256_context_export_state(
      libhmac_sha256_context_t *context,
-     uint8_t *hash,
-     size_t hash_size,
+     uint8_t *state,
+     size_t state_size,
      libcerror_error_t **error )
 {
 	libhmac_internal_sha256_context_t *internal_context = NULL;
-	static char *function                               = "libhmac_sha256_context_finalize";
-	unsigned int safe_hash_size                         = 0;
+	static char *function                               = "libhmac_sha256_context_export_state";
+	size_t state_offset                                 = 0;
+	int value_index                                     = 0;
 
 	if( context == NULL )
 	{
@@ -1109,70 +3152,138 @@ int libhmac_sha256_context_finalize(
 	}
 	internal_context = (libhmac_internal_sha256_context_t *) context;
 
-	if( hash == NULL )
+	if( internal_context->block_offset >= LIBHMAC_SHA256_BLOCK_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid context - block offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( state == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid hash.",
+		 "%s: invalid state.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( hash_size < (size_t) LIBHMAC_SHA256_HASH_SIZE )
-	 || ( hash_size > (size_t) UINT_MAX ) )
+	if( state_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid hash size value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid state size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	safe_hash_size = (unsigned int) hash_size;
+	if( state_size < (size_t) LIBHMAC_SHA256_CONTEXT_STATE_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid state size value too small.",
+		 function );
 
-	if( EVP_DigestFinal_ex(
-	     internal_context->evp_md_context,
-	     (unsigned char *) hash,
-	     &safe_hash_size ) != 1 )
+		return( -1 );
+	}
+	if( memory_set(
+	     state,
+	     0,
+	     LIBHMAC_SHA256_CONTEXT_STATE_SIZE ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to finalize context.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear state.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     state,
+	     LIBHMAC_CONTEXT_STATE_SIGNATURE,
+	     4 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature to state.",
 		 function );
 
 		return( -1 );
 	}
+	state[ 4 ] = LIBHMAC_CONTEXT_STATE_FORMAT_VERSION;
+	state[ 5 ] = LIBHMAC_HASH_ALGORITHM_SHA256;
+
+	byte_stream_copy_from_uint16_big_endian(
+	 &( state[ 6 ] ),
+	 (uint16_t) internal_context->block_offset );
+
+	byte_stream_copy_from_uint64_big_endian(
+	 &( state[ 8 ] ),
+	 internal_context->hash_count );
+
+	state_offset = 16;
+
+	for( value_index = 0;
+	     value_index < 8;
+	     value_index++ )
+	{
+		byte_stream_copy_from_uint32_big_endian(
+		 &( state[ state_offset ] ),
+		 internal_context->hash_values[ value_index ] );
+
+		state_offset += 4;
+	}
+	if( internal_context->block_offset > 0 )
+	{
+		if( memory_copy(
+		     &( state[ state_offset ] ),
+		     internal_context->block,
+		     internal_context->block_offset ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy block to state.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	return( 1 );
 }
 
-#else
-
-/* Finalizes the SHA-256 context using fallback implementation
+/* Imports the SHA-256 context state using fallback implementation
+ * The state must have been exported with libhmac_sha256_context_export_state
+ * The context is not modified if the state is not valid
  * Returns 1 if successful or -1 on error
  */
-int libhmac_sha256_context_finalize(
+int libhmac_sha256_context_import_state(
      libhmac_sha256_context_t *context,
-     uint8_t *hash,
-     size_t hash_size,
+     const uint8_t *state,
+     size_t state_size,
      libcerror_error_t **error )
 {
 	libhmac_internal_sha256_context_t *internal_context = NULL;
-	static char *function                               = "libhmac_sha256_context_finalize";
-	size_t block_size                                   = 0;
-	size_t number_of_blocks                             = 0;
-	ssize_t process_count                               = 0;
-	uint64_t bit_size                                   = 0;
-
-#if !defined( LIBHMAC_UNFOLLED_LOOPS )
-	size_t hash_index                                   = 0;
-	int hash_values_index                               = 0;
-#endif
+	static char *function                               = "libhmac_sha256_context_import_state";
+	size_t state_offset                                 = 0;
+	uint64_t hash_count                                 = 0;
+	uint16_t block_offset                               = 0;
+	int value_index                                     = 0;
 
 	if( context == NULL )
 	{
@@ -1187,165 +3298,137 @@ int libhmac_sha256_context_finalize(
 	}
 	internal_context = (libhmac_internal_sha256_context_t *) context;
 
-	if( hash == NULL )
+	if( state == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid hash.",
+		 "%s: invalid state.",
 		 function );
 
 		return( -1 );
 	}
-	if( hash_size < (size_t) LIBHMAC_SHA256_HASH_SIZE )
+	if( state_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: invalid hash value too small.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid state size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( hash_size > (size_t) SSIZE_MAX )
+	if( state_size < (size_t) LIBHMAC_SHA256_CONTEXT_STATE_SIZE )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid hash size value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid state size value too small.",
 		 function );
 
 		return( -1 );
 	}
-	if( hash_size < (size_t) LIBHMAC_SHA256_HASH_SIZE )
+	if( memory_compare(
+	     state,
+	     LIBHMAC_CONTEXT_STATE_SIGNATURE,
+	     4 ) != 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: invalid hash size value too small.",
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid state - unsupported signature.",
 		 function );
 
 		return( -1 );
 	}
-	/* Add padding with a size of 56 mod 64
-	 */
-	number_of_blocks = 1;
-
-	if( internal_context->block_offset > 55 )
+	if( state[ 4 ] != LIBHMAC_CONTEXT_STATE_FORMAT_VERSION )
 	{
-		number_of_blocks += 1;
-	}
-	block_size = number_of_blocks * LIBHMAC_SHA256_BLOCK_SIZE;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid state - unsupported format version: %" PRIu8 ".",
+		 function,
+		 state[ 4 ] );
 
-	if( memory_set(
-	     &( internal_context->block[ internal_context->block_offset ] ),
-	     0,
-	     block_size - internal_context->block_offset ) == NULL )
+		return( -1 );
+	}
+	if( state[ 5 ] != LIBHMAC_HASH_ALGORITHM_SHA256 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear context block.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid state - unsupported hash algorithm: %" PRIu8 ".",
+		 function,
+		 state[ 5 ] );
 
 		return( -1 );
 	}
-	/* The first byte of the padding contains 0x80
-	 */
-	internal_context->block[ internal_context->block_offset ] = 0x80;
-
-	bit_size = ( internal_context->hash_count + internal_context->block_offset ) * 8;
-
-	byte_stream_copy_from_uint64_big_endian(
-	 &( internal_context->block[ block_size - 8 ] ),
-	 bit_size );
+	byte_stream_copy_to_uint16_big_endian(
+	 &( state[ 6 ] ),
+	 block_offset );
 
-	process_count = libhmac_sha256_context_transform(
-	                 internal_context,
-	                 internal_context->block,
-	                 block_size,
-	                 error );
+	byte_stream_copy_to_uint64_big_endian(
+	 &( state[ 8 ] ),
+	 hash_count );
 
-	if( process_count == -1 )
+	if( block_offset >= LIBHMAC_SHA256_BLOCK_SIZE )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to transform context block.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid state - block offset value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-#if !defined( LIBHMAC_UNFOLLED_LOOPS )
-	for( hash_values_index = 0;
-	     hash_values_index < 8;
-	     hash_values_index++ )
+	if( ( hash_count % LIBHMAC_SHA256_BLOCK_SIZE ) != 0 )
 	{
-		byte_stream_copy_from_uint32_big_endian(
-		 &( hash[ hash_index ] ),
-		 internal_context->hash_values[ hash_values_index ] );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid state - hash count value not a multiple of the block size.",
+		 function );
 
-		hash_index += sizeof( uint32_t );
+		return( -1 );
 	}
-#else
-	byte_stream_copy_from_uint32_big_endian(
-	 &( hash[ 0 ] ),
-	 internal_context->hash_values[ 0 ] );
-
-	byte_stream_copy_from_uint32_big_endian(
-	 &( hash[ 4 ] ),
-	 internal_context->hash_values[ 1 ] );
-
-	byte_stream_copy_from_uint32_big_endian(
-	 &( hash[ 8 ] ),
-	 internal_context->hash_values[ 2 ] );
-
-	byte_stream_copy_from_uint32_big_endian(
-	 &( hash[ 12 ] ),
-	 internal_context->hash_values[ 3 ] );
+	state_offset = 16;
 
-	byte_stream_copy_from_uint32_big_endian(
-	 &( hash[ 16 ] ),
-	 internal_context->hash_values[ 4 ] );
-
-	byte_stream_copy_from_uint32_big_endian(
-	 &( hash[ 20 ] ),
-	 internal_context->hash_values[ 5 ] );
-
-	byte_stream_copy_from_uint32_big_endian(
-	 &( hash[ 24 ] ),
-	 internal_context->hash_values[ 6 ] );
-
-	byte_stream_copy_from_uint32_big_endian(
-	 &( hash[ 28 ] ),
-	 internal_context->hash_values[ 7 ] );
-
-#endif /* !defined( LIBHMAC_UNFOLLED_LOOPS ) */
+	for( value_index = 0;
+	     value_index < 8;
+	     value_index++ )
+	{
+		byte_stream_copy_to_uint32_big_endian(
+		 &( state[ state_offset ] ),
+		 internal_context->hash_values[ value_index ] );
 
-	/* Prevent sensitive data from leaking
-	 */
-	if( memory_set(
-	     internal_context,
-	     0,
-	     sizeof( libhmac_internal_sha256_context_t ) ) == NULL )
+		state_offset += 4;
+	}
+	if( memory_copy(
+	     internal_context->block,
+	     &( state[ state_offset ] ),
+	     LIBHMAC_SHA256_BLOCK_SIZE ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear context.",
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy block from state.",
 		 function );
 
 		return( -1 );
 	}
+	internal_context->hash_count   = hash_count;
+	internal_context->block_offset = (size_t) block_offset;
+
 	return( 1 );
 }
 
-#endif /* defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_SHA_H ) && defined( SHA256_DIGEST_LENGTH ) */
-
+#endif /* defined( LIBHMAC_HAVE_SHA256_SUPPORT ) */
@@ -32,7 +32,9 @@
 #include <openssl/evp.h>
 #endif
 
+#include "libhmac_definitions.h"
 #include "libhmac_extern.h"
+#include "libhmac_kernel.h"
 #include "libhmac_libcerror.h"
 #include "libhmac_types.h"
 
@@ -48,7 +50,9 @@ extern "C" {
 
 #endif
 
-#define LIBHMAC_SHA256_BLOCK_SIZE	64
+extern const uint32_t libhmac_sha256_context_prime_square_roots[ 8 ];
+
+extern const uint32_t libhmac_sha256_context_prime_cube_roots[ 64 ];
 
 typedef struct libhmac_internal_sha256_context libhmac_internal_sha256_context_t;
 
@@ -88,6 +92,25 @@ struct libhmac_internal_sha256_context
 #endif /* defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_SHA_H ) && defined( SHA256_DIGEST_LENGTH ) */
 };
 
+int libhmac_sha256_context_transform_portable(
+     uint32_t *context_hash_values,
+     const uint8_t *buffer,
+     size_t number_of_blocks );
+
+int libhmac_sha256_context_transform_schedule_portable(
+     uint32_t *context_hash_values,
+     const uint32_t *schedule );
+
+int libhmac_sha256_context_get_transform_function(
+     int kernel_type,
+     libhmac_kernel_transform_32bit_function_t *transform_function,
+     libcerror_error_t **error );
+
+int libhmac_sha256_context_get_pair_transform_function(
+     int kernel_type,
+     libhmac_kernel_pair_transform_32bit_function_t *pair_transform_function,
+     libcerror_error_t **error );
+
 #if !defined( LIBHMAC_HAVE_SHA256_SUPPORT )
 
 ssize_t libhmac_sha256_context_transform(
@@ -98,6 +121,47 @@ ssize_t libhmac_sha256_context_transform(
 
 #endif /* !defined( LIBHMAC_HAVE_SHA256_SUPPORT ) */
 
+int libhmac_sha256_context_transform_blocks(
+     uint32_t *hash_values,
+     const uint8_t *blocks,
+     size_t number_of_blocks );
+
+int libhmac_sha256_context_calculate_32_bytes(
+     const uint8_t *buffer,
+     uint8_t *hash );
+
+int libhmac_sha256_context_calculate_64_bytes(
+     const uint8_t *buffer,
+     uint8_t *hash );
+
+#if !defined( LIBHMAC_HAVE_SHA256_SUPPORT )
+
+ssize_t libhmac_sha256_context_transform_pair(
+         libhmac_internal_sha256_context_t *first_internal_context,
+         const uint8_t *first_buffer,
+         libhmac_internal_sha256_context_t *second_internal_context,
+         const uint8_t *second_buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+#endif /* !defined( LIBHMAC_HAVE_SHA256_SUPPORT ) */
+
+int libhmac_sha256_context_get_kernel_type(
+     void );
+
+int libhmac_internal_sha256_context_initialize(
+     libhmac_internal_sha256_context_t *internal_context,
+     libcerror_error_t **error );
+
+int libhmac_internal_sha256_context_clear(
+     libhmac_internal_sha256_context_t *internal_context,
+     libcerror_error_t **error );
+
+int libhmac_internal_sha256_context_copy(
+     libhmac_internal_sha256_context_t *destination_internal_context,
+     libhmac_internal_sha256_context_t *source_internal_context,
+     libcerror_error_t **error );
+
 LIBHMAC_EXTERN \
 int libhmac_sha256_context_initialize(
      libhmac_sha256_context_t **context,
@@ -108,6 +172,35 @@ int libhmac_sha256_context_free(
      libhmac_sha256_context_t **context,
      libcerror_error_t **error );
 
+LIBHMAC_EXTERN \
+int libhmac_sha256_context_get_size(
+     size_t *context_size,
+     size_t *context_alignment,
+     libcerror_error_t **error );
+
+LIBHMAC_EXTERN \
+int libhmac_sha256_context_initialize_in_place(
+     libhmac_sha256_context_t **context,
+     uint8_t *memory,
+     size_t memory_size,
+     libcerror_error_t **error );
+
+LIBHMAC_EXTERN \
+int libhmac_sha256_context_free_in_place(
+     libhmac_sha256_context_t **context,
+     libcerror_error_t **error );
+
+LIBHMAC_EXTERN \
+int libhmac_sha256_context_reset(
+     libhmac_sha256_context_t *context,
+     libcerror_error_t **error );
+
+LIBHMAC_EXTERN \
+int libhmac_sha256_context_clone(
+     libhmac_sha256_context_t **destination_context,
+     libhmac_sha256_context_t *source_context,
+     libcerror_error_t **error );
+
 LIBHMAC_EXTERN \
 int libhmac_sha256_context_update(
      libhmac_sha256_context_t *context,
@@ -115,6 +208,24 @@ int libhmac_sha256_context_update(
      size_t size,
      libcerror_error_t **error );
 
+LIBHMAC_EXTERN \
+int libhmac_sha256_context_update_iov(
+     libhmac_sha256_context_t *context,
+     const uint8_t **buffers,
+     const size_t *sizes,
+     int number_of_buffers,
+     libcerror_error_t **error );
+
+LIBHMAC_EXTERN \
+int libhmac_sha256_context_update_pair(
+     libhmac_sha256_context_t *first_context,
+     const uint8_t *first_buffer,
+     size_t first_size,
+     libhmac_sha256_context_t *second_context,
+     const uint8_t *second_buffer,
+     size_t second_size,
+     libcerror_error_t **error );
+
 LIBHMAC_EXTERN \
 int libhmac_sha256_context_finalize(
      libhmac_sha256_context_t *context,
@@ -122,6 +233,20 @@ int libhmac_sha256_context_finalize(
      size_t hash_size,
      libcerror_error_t **error );
 
+LIBHMAC_EXTERN \
+int libhmac_sha256_context_export_state(
+     libhmac_sha256_context_t *context,
+     uint8_t *state,
+     size_t state_size,
+     libcerror_error_t **error );
+
+LIBHMAC_EXTERN \
+int libhmac_sha256_context_import_state(
+     libhmac_sha256_context_t *context,
+     const uint8_t *state,
+     size_t state_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
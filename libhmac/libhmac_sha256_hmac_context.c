@@ -0,0 +1,426 @@
+/*
+ * SHA-256 HMAC context functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libhmac_definitions.h"
+#include "libhmac_libcerror.h"
+#include "libhmac_sha256_context.h"
+#include "libhmac_sha256_hmac_context.h"
+#include "libhmac_sha256_key.h"
+
+/* Creates a SHA-256 HMAC context
+ * The context calculates the HMAC of data that is provided incrementally
+ * Make sure the value hmac_context is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_sha256_hmac_context_initialize(
+     libhmac_sha256_hmac_context_t **hmac_context,
+     const uint8_t *key_data,
+     size_t key_data_size,
+     libcerror_error_t **error )
+{
+	libhmac_internal_sha256_hmac_context_t *internal_hmac_context = NULL;
+	static char *function                                         = "libhmac_sha256_hmac_context_initialize";
+
+	if( hmac_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid HMAC context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *hmac_context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid HMAC context value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_hmac_context = memory_allocate_structure(
+	                         libhmac_internal_sha256_hmac_context_t );
+
+	if( internal_hmac_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create HMAC context.",
+		 function );
+
+		goto on_error;
+	}
+	if( libhmac_internal_sha256_key_initialize(
+	     &( internal_hmac_context->key ),
+	     key_data,
+	     key_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize key.",
+		 function );
+
+		memory_free(
+		 internal_hmac_context );
+
+		return( -1 );
+	}
+	if( libhmac_internal_sha256_context_initialize(
+	     &( internal_hmac_context->context ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize context.",
+		 function );
+
+		libhmac_internal_sha256_key_clear(
+		 &( internal_hmac_context->key ),
+		 NULL );
+
+		memory_free(
+		 internal_hmac_context );
+
+		return( -1 );
+	}
+	if( libhmac_internal_sha256_context_copy(
+	     &( internal_hmac_context->context ),
+	     &( internal_hmac_context->key.inner_context ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy inner context.",
+		 function );
+
+		goto on_error;
+	}
+	*hmac_context = (libhmac_sha256_hmac_context_t *) internal_hmac_context;
+
+	return( 1 );
+
+on_error:
+	if( internal_hmac_context != NULL )
+	{
+		libhmac_internal_sha256_context_clear(
+		 &( internal_hmac_context->context ),
+		 NULL );
+
+		libhmac_internal_sha256_key_clear(
+		 &( internal_hmac_context->key ),
+		 NULL );
+
+		memory_free(
+		 internal_hmac_context );
+	}
+	return( -1 );
+}
+
+/* Frees a SHA-256 HMAC context
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_sha256_hmac_context_free(
+     libhmac_sha256_hmac_context_t **hmac_context,
+     libcerror_error_t **error )
+{
+	libhmac_internal_sha256_hmac_context_t *internal_hmac_context = NULL;
+	static char *function                                         = "libhmac_sha256_hmac_context_free";
+	int result                                                    = 1;
+
+	if( hmac_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid HMAC context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *hmac_context != NULL )
+	{
+		internal_hmac_context = (libhmac_internal_sha256_hmac_context_t *) *hmac_context;
+		*hmac_context         = NULL;
+
+		if( libhmac_internal_sha256_context_clear(
+		     &( internal_hmac_context->context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear context.",
+			 function );
+
+			result = -1;
+		}
+		if( libhmac_internal_sha256_key_clear(
+		     &( internal_hmac_context->key ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear key.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_hmac_context );
+	}
+	return( result );
+}
+
+/* Updates the SHA-256 HMAC context
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_sha256_hmac_context_update(
+     libhmac_sha256_hmac_context_t *hmac_context,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	libhmac_internal_sha256_hmac_context_t *internal_hmac_context = NULL;
+	static char *function                                         = "libhmac_sha256_hmac_context_update";
+
+	if( hmac_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid HMAC context.",
+		 function );
+
+		return( -1 );
+	}
+	internal_hmac_context = (libhmac_internal_sha256_hmac_context_t *) hmac_context;
+
+	if( libhmac_sha256_context_update(
+	     (libhmac_sha256_context_t *) &( internal_hmac_context->context ),
+	     buffer,
+	     size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update context.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Finalizes the SHA-256 HMAC context
+ * Afterwards the HMAC context can be updated to calculate a new HMAC with the same key
+ * Returns 1 if successful or -1 on error
+ */
+int libhmac_sha256_hmac_context_finalize(
+     libhmac_sha256_hmac_context_t *hmac_context,
+     uint8_t *hmac,
+     size_t hmac_size,
+     libcerror_error_t **error )
+{
+	uint8_t inner_hash[ LIBHMAC_SHA256_HASH_SIZE ];
+
+	libhmac_internal_sha256_hmac_context_t *internal_hmac_context = NULL;
+	static char *function                                         = "libhmac_sha256_hmac_context_finalize";
+
+	if( hmac_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid HMAC context.",
+		 function );
+
+		return( -1 );
+	}
+	internal_hmac_context = (libhmac_internal_sha256_hmac_context_t *) hmac_context;
+
+	if( hmac == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid HMAC.",
+		 function );
+
+		return( -1 );
+	}
+	if( hmac_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid HMAC size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( hmac_size < (size_t) LIBHMAC_SHA256_HASH_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid HMAC size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( libhmac_sha256_context_finalize(
+	     (libhmac_sha256_context_t *) &( internal_hmac_context->context ),
+	     inner_hash,
+	     LIBHMAC_SHA256_HASH_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize inner context.",
+		 function );
+
+		goto on_error;
+	}
+	if( libhmac_internal_sha256_context_copy(
+	     &( internal_hmac_context->context ),
+	     &( internal_hmac_context->key.outer_context ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy outer context.",
+		 function );
+
+		goto on_error;
+	}
+	if( libhmac_sha256_context_update(
+	     (libhmac_sha256_context_t *) &( internal_hmac_context->context ),
+	     inner_hash,
+	     LIBHMAC_SHA256_HASH_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update outer context.",
+		 function );
+
+		goto on_error;
+	}
+	if( libhmac_sha256_context_finalize(
+	     (libhmac_sha256_context_t *) &( internal_hmac_context->context ),
+	     hmac,
+	     hmac_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize outer context.",
+		 function );
+
+		goto on_error;
+	}
+	/* Prevent sensitive data from leaking
+	 */
+	if( memory_set(
+	     inner_hash,
+	     0,
+	     LIBHMAC_SHA256_HASH_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear inner hash.",
+		 function );
+
+		goto on_error;
+	}
+	/* Reset the context to the inner state so a new HMAC can be calculated
+	 */
+	if( libhmac_internal_sha256_context_copy(
+	     &( internal_hmac_context->context ),
+	     &( internal_hmac_context->key.inner_context ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy inner context.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	memory_set(
+	 inner_hash,
+	 0,
+	 LIBHMAC_SHA256_HASH_SIZE );
+
+	/* Restore the inner state so the HMAC context remains usable
+	 */
+	libhmac_internal_sha256_context_copy(
+	 &( internal_hmac_context->context ),
+	 &( internal_hmac_context->key.inner_context ),
+	 NULL );
+
+	return( -1 );
+}
+
@@ -0,0 +1,144 @@
+/*
+ * SHA-256 job manager functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBHMAC_SHA256_JOB_MANAGER_H )
+#define _LIBHMAC_SHA256_JOB_MANAGER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libhmac_definitions.h"
+#include "libhmac_extern.h"
+#include "libhmac_libcerror.h"
+#include "libhmac_sha256_context.h"
+#include "libhmac_sha256_multi_buffer.h"
+#include "libhmac_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libhmac_sha256_job_manager_completed_job libhmac_sha256_job_manager_completed_job_t;
+
+struct libhmac_sha256_job_manager_completed_job
+{
+	/* The user data of the job
+	 */
+	intptr_t *user_data;
+
+	/* The hash of the job
+	 */
+	uint8_t hash[ LIBHMAC_SHA256_HASH_SIZE ];
+};
+
+typedef struct libhmac_internal_sha256_job_manager libhmac_internal_sha256_job_manager_t;
+
+struct libhmac_internal_sha256_job_manager
+{
+#if !defined( LIBHMAC_HAVE_SHA256_SUPPORT )
+	/* The multi-buffer scheduler
+	 */
+	libhmac_sha256_multi_buffer_scheduler_t scheduler;
+
+	/* Value to indicate the multi-buffer scheduler is used
+	 */
+	uint8_t use_scheduler;
+
+	/* The user data of the jobs in the lanes
+	 */
+	intptr_t *lanes_user_data[ LIBHMAC_SHA256_MULTI_BUFFER_MAXIMUM_NUMBER_OF_LANES ];
+
+#endif /* !defined( LIBHMAC_HAVE_SHA256_SUPPORT ) */
+
+	/* The completed jobs
+	 */
+	libhmac_sha256_job_manager_completed_job_t *completed_jobs;
+
+	/* The index of the first completed job
+	 */
+	int completed_jobs_index;
+
+	/* The number of completed jobs
+	 */
+	int number_of_completed_jobs;
+
+	/* The number of allocated completed jobs
+	 */
+	int number_of_allocated_completed_jobs;
+};
+
+LIBHMAC_EXTERN \
+int libhmac_sha256_job_manager_initialize(
+     libhmac_sha256_job_manager_t **job_manager,
+     libcerror_error_t **error );
+
+LIBHMAC_EXTERN \
+int libhmac_sha256_job_manager_free(
+     libhmac_sha256_job_manager_t **job_manager,
+     libcerror_error_t **error );
+
+int libhmac_sha256_job_manager_append_completed_job(
+     libhmac_internal_sha256_job_manager_t *internal_job_manager,
+     intptr_t *user_data,
+     libhmac_sha256_job_manager_completed_job_t **completed_job,
+     libcerror_error_t **error );
+
+#if !defined( LIBHMAC_HAVE_SHA256_SUPPORT )
+
+int libhmac_sha256_job_manager_complete_lanes(
+     libhmac_internal_sha256_job_manager_t *internal_job_manager,
+     libcerror_error_t **error );
+
+#endif /* !defined( LIBHMAC_HAVE_SHA256_SUPPORT ) */
+
+LIBHMAC_EXTERN \
+int libhmac_sha256_job_manager_submit(
+     libhmac_sha256_job_manager_t *job_manager,
+     const uint8_t *buffer,
+     size_t size,
+     intptr_t *user_data,
+     libcerror_error_t **error );
+
+LIBHMAC_EXTERN \
+int libhmac_sha256_job_manager_flush(
+     libhmac_sha256_job_manager_t *job_manager,
+     libcerror_error_t **error );
+
+LIBHMAC_EXTERN \
+int libhmac_sha256_job_manager_get_number_of_completed_jobs(
+     libhmac_sha256_job_manager_t *job_manager,
+     int *number_of_completed_jobs,
+     libcerror_error_t **error );
+
+LIBHMAC_EXTERN \
+int libhmac_sha256_job_manager_get_completed_job(
+     libhmac_sha256_job_manager_t *job_manager,
+     intptr_t **user_data,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBHMAC_SHA256_JOB_MANAGER_H ) */
+
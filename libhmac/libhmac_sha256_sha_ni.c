@@ -0,0 +1,460 @@
+/*
+ * SHA-256 SHA-NI kernel functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libhmac_cpu.h"
+#include "libhmac_sha256_context.h"
+#include "libhmac_sha256_sha_ni.h"
+
+#if defined( LIBHMAC_HAVE_X86_KERNELS )
+
+#include <immintrin.h>
+
+/* Calculates 4 rounds, sha256rnds2 calculates 2 rounds using the message values in the lower 64-bits
+ */
+#define libhmac_sha256_sha_ni_calculate_rounds( state_abef, state_cdgh, message, message_values, round_index ) \
+	message    = _mm_add_epi32( message_values, _mm_loadu_si128( (const __m128i *) &( libhmac_sha256_context_prime_cube_roots[ round_index ] ) ) ); \
+	state_cdgh = _mm_sha256rnds2_epu32( state_cdgh, state_abef, message ); \
+	message    = _mm_shuffle_epi32( message, 0x0e ); \
+	state_abef = _mm_sha256rnds2_epu32( state_abef, state_cdgh, message );
+
+/* Calculates 4 rounds using message values to which the round constants have already been added
+ */
+#define libhmac_sha256_sha_ni_calculate_scheduled_rounds( state_abef, state_cdgh, message, schedule, round_index ) \
+	message    = _mm_loadu_si128( (const __m128i *) &( schedule[ round_index ] ) ); \
+	state_cdgh = _mm_sha256rnds2_epu32( state_cdgh, state_abef, message ); \
+	message    = _mm_shuffle_epi32( message, 0x0e ); \
+	state_abef = _mm_sha256rnds2_epu32( state_abef, state_cdgh, message );
+
+/* Calculates the first part of the extension of the message values
+ */
+#define libhmac_sha256_sha_ni_extend_message_values1( message_values_previous, message_values_current ) \
+	message_values_previous = _mm_sha256msg1_epu32( message_values_previous, message_values_current );
+
+/* Calculates the second part of the extension of the message values
+ */
+#define libhmac_sha256_sha_ni_extend_message_values2( message_values_next, message_values_current, message_values_previous, temporary ) \
+	temporary           = _mm_alignr_epi8( message_values_current, message_values_previous, 4 ); \
+	message_values_next = _mm_add_epi32( message_values_next, temporary ); \
+	message_values_next = _mm_sha256msg2_epu32( message_values_next, message_values_current );
+
+/* Calculates the SHA-256 of 64 byte sized blocks of data in a buffer
+ * This kernel requires the SHA, SSSE3 and SSE4.1 extensions
+ * Returns 1 if successful or -1 on error
+ */
+LIBHMAC_X86_TARGET( "sse2,ssse3,sse4.1,sha" ) \
+int libhmac_sha256_sha_ni_transform(
+     uint32_t *hash_values,
+     const uint8_t *buffer,
+     size_t number_of_blocks )
+{
+	__m128i byte_order_mask;
+	__m128i message;
+	__m128i message_values0;
+	__m128i message_values1;
+	__m128i message_values2;
+	__m128i message_values3;
+	__m128i previous_state_abef;
+	__m128i previous_state_cdgh;
+	__m128i state_abef;
+	__m128i state_cdgh;
+	__m128i temporary;
+
+	byte_order_mask = _mm_set_epi64x(
+	                   0x0c0d0e0f08090a0bULL,
+	                   0x0405060700010203ULL );
+
+	/* The SHA instructions expect the state as ABEF and CDGH
+	 */
+	temporary  = _mm_loadu_si128( (const __m128i *) &( hash_values[ 0 ] ) );
+	state_cdgh = _mm_loadu_si128( (const __m128i *) &( hash_values[ 4 ] ) );
+
+	temporary  = _mm_shuffle_epi32( temporary, 0xb1 );
+	state_cdgh = _mm_shuffle_epi32( state_cdgh, 0x1b );
+	state_abef = _mm_alignr_epi8( temporary, state_cdgh, 8 );
+	state_cdgh = _mm_blend_epi16( state_cdgh, temporary, 0xf0 );
+
+	while( number_of_blocks > 0 )
+	{
+		previous_state_abef = state_abef;
+		previous_state_cdgh = state_cdgh;
+
+		/* Break the block into 16 x 32-bit values
+		 */
+		message_values0 = _mm_shuffle_epi8( _mm_loadu_si128( (const __m128i *) &( buffer[ 0 ] ) ), byte_order_mask );
+		message_values1 = _mm_shuffle_epi8( _mm_loadu_si128( (const __m128i *) &( buffer[ 16 ] ) ), byte_order_mask );
+		message_values2 = _mm_shuffle_epi8( _mm_loadu_si128( (const __m128i *) &( buffer[ 32 ] ) ), byte_order_mask );
+		message_values3 = _mm_shuffle_epi8( _mm_loadu_si128( (const __m128i *) &( buffer[ 48 ] ) ), byte_order_mask );
+
+		/* Calculate the hash values while extending to 64 x 32-bit values
+		 */
+		libhmac_sha256_sha_ni_calculate_rounds( state_abef, state_cdgh, message, message_values0, 0 )
+
+		libhmac_sha256_sha_ni_calculate_rounds( state_abef, state_cdgh, message, message_values1, 4 )
+		libhmac_sha256_sha_ni_extend_message_values1( message_values0, message_values1 )
+
+		libhmac_sha256_sha_ni_calculate_rounds( state_abef, state_cdgh, message, message_values2, 8 )
+		libhmac_sha256_sha_ni_extend_message_values1( message_values1, message_values2 )
+
+		libhmac_sha256_sha_ni_calculate_rounds( state_abef, state_cdgh, message, message_values3, 12 )
+		libhmac_sha256_sha_ni_extend_message_values2( message_values0, message_values3, message_values2, temporary )
+		libhmac_sha256_sha_ni_extend_message_values1( message_values2, message_values3 )
+
+		libhmac_sha256_sha_ni_calculate_rounds( state_abef, state_cdgh, message, message_values0, 16 )
+		libhmac_sha256_sha_ni_extend_message_values2( message_values1, message_values0, message_values3, temporary )
+		libhmac_sha256_sha_ni_extend_message_values1( message_values3, message_values0 )
+
+		libhmac_sha256_sha_ni_calculate_rounds( state_abef, state_cdgh, message, message_values1, 20 )
+		libhmac_sha256_sha_ni_extend_message_values2( message_values2, message_values1, message_values0, temporary )
+		libhmac_sha256_sha_ni_extend_message_values1( message_values0, message_values1 )
+
+		libhmac_sha256_sha_ni_calculate_rounds( state_abef, state_cdgh, message, message_values2, 24 )
+		libhmac_sha256_sha_ni_extend_message_values2( message_values3, message_values2, message_values1, temporary )
+		libhmac_sha256_sha_ni_extend_message_values1( message_values1, message_values2 )
+
+		libhmac_sha256_sha_ni_calculate_rounds( state_abef, state_cdgh, message, message_values3, 28 )
+		libhmac_sha256_sha_ni_extend_message_values2( message_values0, message_values3, message_values2, temporary )
+		libhmac_sha256_sha_ni_extend_message_values1( message_values2, message_values3 )
+
+		libhmac_sha256_sha_ni_calculate_rounds( state_abef, state_cdgh, message, message_values0, 32 )
+		libhmac_sha256_sha_ni_extend_message_values2( message_values1, message_values0, message_values3, temporary )
+		libhmac_sha256_sha_ni_extend_message_values1( message_values3, message_values0 )
+
+		libhmac_sha256_sha_ni_calculate_rounds( state_abef, state_cdgh, message, message_values1, 36 )
+		libhmac_sha256_sha_ni_extend_message_values2( message_values2, message_values1, message_values0, temporary )
+		libhmac_sha256_sha_ni_extend_message_values1( message_values0, message_values1 )
+
+		libhmac_sha256_sha_ni_calculate_rounds( state_abef, state_cdgh, message, message_values2, 40 )
+		libhmac_sha256_sha_ni_extend_message_values2( message_values3, message_values2, message_values1, temporary )
+		libhmac_sha256_sha_ni_extend_message_values1( message_values1, message_values2 )
+
+		libhmac_sha256_sha_ni_calculate_rounds( state_abef, state_cdgh, message, message_values3, 44 )
+		libhmac_sha256_sha_ni_extend_message_values2( message_values0, message_values3, message_values2, temporary )
+		libhmac_sha256_sha_ni_extend_message_values1( message_values2, message_values3 )
+
+		libhmac_sha256_sha_ni_calculate_rounds( state_abef, state_cdgh, message, message_values0, 48 )
+		libhmac_sha256_sha_ni_extend_message_values2( message_values1, message_values0, message_values3, temporary )
+		libhmac_sha256_sha_ni_extend_message_values1( message_values3, message_values0 )
+
+		libhmac_sha256_sha_ni_calculate_rounds( state_abef, state_cdgh, message, message_values1, 52 )
+		libhmac_sha256_sha_ni_extend_message_values2( message_values2, message_values1, message_values0, temporary )
+
+		libhmac_sha256_sha_ni_calculate_rounds( state_abef, state_cdgh, message, message_values2, 56 )
+		libhmac_sha256_sha_ni_extend_message_values2( message_values3, message_values2, message_values1, temporary )
+
+		libhmac_sha256_sha_ni_calculate_rounds( state_abef, state_cdgh, message, message_values3, 60 )
+
+		/* Update the hash values
+		 */
+		state_abef = _mm_add_epi32( state_abef, previous_state_abef );
+		state_cdgh = _mm_add_epi32( state_cdgh, previous_state_cdgh );
+
+		buffer           += 64;
+		number_of_blocks -= 1;
+	}
+	temporary  = _mm_shuffle_epi32( state_abef, 0x1b );
+	state_cdgh = _mm_shuffle_epi32( state_cdgh, 0xb1 );
+	state_abef = _mm_blend_epi16( temporary, state_cdgh, 0xf0 );
+	state_cdgh = _mm_alignr_epi8( state_cdgh, temporary, 8 );
+
+	_mm_storeu_si128( (__m128i *) &( hash_values[ 0 ] ), state_abef );
+	_mm_storeu_si128( (__m128i *) &( hash_values[ 4 ] ), state_cdgh );
+
+	return( 1 );
+}
+
+/* Calculates the SHA-256 of 64 byte sized blocks of data in two buffers
+ * The blocks of the first buffer are transformed into the first hash values
+ * and the blocks of the second buffer into the second hash values
+ * This kernel requires the SHA, SSSE3 and SSE4.1 extensions
+ * Returns 1 if successful or -1 on error
+ */
+LIBHMAC_X86_TARGET( "sse2,ssse3,sse4.1,sha" ) \
+int libhmac_sha256_sha_ni_transform_pair(
+     uint32_t *first_hash_values,
+     const uint8_t *first_buffer,
+     uint32_t *second_hash_values,
+     const uint8_t *second_buffer,
+     size_t number_of_blocks )
+{
+	__m128i byte_order_mask;
+	__m128i first_message;
+	__m128i first_message_values0;
+	__m128i first_message_values1;
+	__m128i first_message_values2;
+	__m128i first_message_values3;
+	__m128i first_previous_state_abef;
+	__m128i first_previous_state_cdgh;
+	__m128i first_state_abef;
+	__m128i first_state_cdgh;
+	__m128i first_temporary;
+	__m128i second_message;
+	__m128i second_message_values0;
+	__m128i second_message_values1;
+	__m128i second_message_values2;
+	__m128i second_message_values3;
+	__m128i second_previous_state_abef;
+	__m128i second_previous_state_cdgh;
+	__m128i second_state_abef;
+	__m128i second_state_cdgh;
+	__m128i second_temporary;
+
+	byte_order_mask = _mm_set_epi64x(
+	                   0x0c0d0e0f08090a0bULL,
+	                   0x0405060700010203ULL );
+
+	/* The SHA instructions expect the state as ABEF and CDGH
+	 */
+	first_temporary  = _mm_loadu_si128( (const __m128i *) &( first_hash_values[ 0 ] ) );
+	first_state_cdgh = _mm_loadu_si128( (const __m128i *) &( first_hash_values[ 4 ] ) );
+
+	first_temporary  = _mm_shuffle_epi32( first_temporary, 0xb1 );
+	first_state_cdgh = _mm_shuffle_epi32( first_state_cdgh, 0x1b );
+	first_state_abef = _mm_alignr_epi8( first_temporary, first_state_cdgh, 8 );
+	first_state_cdgh = _mm_blend_epi16( first_state_cdgh, first_temporary, 0xf0 );
+
+	second_temporary  = _mm_loadu_si128( (const __m128i *) &( second_hash_values[ 0 ] ) );
+	second_state_cdgh = _mm_loadu_si128( (const __m128i *) &( second_hash_values[ 4 ] ) );
+
+	second_temporary  = _mm_shuffle_epi32( second_temporary, 0xb1 );
+	second_state_cdgh = _mm_shuffle_epi32( second_state_cdgh, 0x1b );
+	second_state_abef = _mm_alignr_epi8( second_temporary, second_state_cdgh, 8 );
+	second_state_cdgh = _mm_blend_epi16( second_state_cdgh, second_temporary, 0xf0 );
+
+	while( number_of_blocks > 0 )
+	{
+		first_previous_state_abef  = first_state_abef;
+		first_previous_state_cdgh  = first_state_cdgh;
+		second_previous_state_abef = second_state_abef;
+		second_previous_state_cdgh = second_state_cdgh;
+
+		/* Break the blocks into 16 x 32-bit values
+		 */
+		first_message_values0 = _mm_shuffle_epi8( _mm_loadu_si128( (const __m128i *) &( first_buffer[ 0 ] ) ), byte_order_mask );
+		first_message_values1 = _mm_shuffle_epi8( _mm_loadu_si128( (const __m128i *) &( first_buffer[ 16 ] ) ), byte_order_mask );
+		first_message_values2 = _mm_shuffle_epi8( _mm_loadu_si128( (const __m128i *) &( first_buffer[ 32 ] ) ), byte_order_mask );
+		first_message_values3 = _mm_shuffle_epi8( _mm_loadu_si128( (const __m128i *) &( first_buffer[ 48 ] ) ), byte_order_mask );
+
+		second_message_values0 = _mm_shuffle_epi8( _mm_loadu_si128( (const __m128i *) &( second_buffer[ 0 ] ) ), byte_order_mask );
+		second_message_values1 = _mm_shuffle_epi8( _mm_loadu_si128( (const __m128i *) &( second_buffer[ 16 ] ) ), byte_order_mask );
+		second_message_values2 = _mm_shuffle_epi8( _mm_loadu_si128( (const __m128i *) &( second_buffer[ 32 ] ) ), byte_order_mask );
+		second_message_values3 = _mm_shuffle_epi8( _mm_loadu_si128( (const __m128i *) &( second_buffer[ 48 ] ) ), byte_order_mask );
+
+		/* Calculate the hash values while extending to 64 x 32-bit values
+		 * the rounds of both blocks are interleaved so that the latency of sha256rnds2 of one block
+		 * is hidden by the rounds of the other block
+		 */
+		libhmac_sha256_sha_ni_calculate_rounds( first_state_abef, first_state_cdgh, first_message, first_message_values0, 0 )
+		libhmac_sha256_sha_ni_calculate_rounds( second_state_abef, second_state_cdgh, second_message, second_message_values0, 0 )
+
+		libhmac_sha256_sha_ni_calculate_rounds( first_state_abef, first_state_cdgh, first_message, first_message_values1, 4 )
+		libhmac_sha256_sha_ni_calculate_rounds( second_state_abef, second_state_cdgh, second_message, second_message_values1, 4 )
+		libhmac_sha256_sha_ni_extend_message_values1( first_message_values0, first_message_values1 )
+		libhmac_sha256_sha_ni_extend_message_values1( second_message_values0, second_message_values1 )
+
+		libhmac_sha256_sha_ni_calculate_rounds( first_state_abef, first_state_cdgh, first_message, first_message_values2, 8 )
+		libhmac_sha256_sha_ni_calculate_rounds( second_state_abef, second_state_cdgh, second_message, second_message_values2, 8 )
+		libhmac_sha256_sha_ni_extend_message_values1( first_message_values1, first_message_values2 )
+		libhmac_sha256_sha_ni_extend_message_values1( second_message_values1, second_message_values2 )
+
+		libhmac_sha256_sha_ni_calculate_rounds( first_state_abef, first_state_cdgh, first_message, first_message_values3, 12 )
+		libhmac_sha256_sha_ni_calculate_rounds( second_state_abef, second_state_cdgh, second_message, second_message_values3, 12 )
+		libhmac_sha256_sha_ni_extend_message_values2( first_message_values0, first_message_values3, first_message_values2, first_temporary )
+		libhmac_sha256_sha_ni_extend_message_values2( second_message_values0, second_message_values3, second_message_values2, second_temporary )
+		libhmac_sha256_sha_ni_extend_message_values1( first_message_values2, first_message_values3 )
+		libhmac_sha256_sha_ni_extend_message_values1( second_message_values2, second_message_values3 )
+
+		libhmac_sha256_sha_ni_calculate_rounds( first_state_abef, first_state_cdgh, first_message, first_message_values0, 16 )
+		libhmac_sha256_sha_ni_calculate_rounds( second_state_abef, second_state_cdgh, second_message, second_message_values0, 16 )
+		libhmac_sha256_sha_ni_extend_message_values2( first_message_values1, first_message_values0, first_message_values3, first_temporary )
+		libhmac_sha256_sha_ni_extend_message_values2( second_message_values1, second_message_values0, second_message_values3, second_temporary )
+		libhmac_sha256_sha_ni_extend_message_values1( first_message_values3, first_message_values0 )
+		libhmac_sha256_sha_ni_extend_message_values1( second_message_values3, second_message_values0 )
+
+		libhmac_sha256_sha_ni_calculate_rounds( first_state_abef, first_state_cdgh, first_message, first_message_values1, 20 )
+		libhmac_sha256_sha_ni_calculate_rounds( second_state_abef, second_state_cdgh, second_message, second_message_values1, 20 )
+		libhmac_sha256_sha_ni_extend_message_values2( first_message_values2, first_message_values1, first_message_values0, first_temporary )
+		libhmac_sha256_sha_ni_extend_message_values2( second_message_values2, second_message_values1, second_message_values0, second_temporary )
+		libhmac_sha256_sha_ni_extend_message_values1( first_message_values0, first_message_values1 )
+		libhmac_sha256_sha_ni_extend_message_values1( second_message_values0, second_message_values1 )
+
+		libhmac_sha256_sha_ni_calculate_rounds( first_state_abef, first_state_cdgh, first_message, first_message_values2, 24 )
+		libhmac_sha256_sha_ni_calculate_rounds( second_state_abef, second_state_cdgh, second_message, second_message_values2, 24 )
+		libhmac_sha256_sha_ni_extend_message_values2( first_message_values3, first_message_values2, first_message_values1, first_temporary )
+		libhmac_sha256_sha_ni_extend_message_values2( second_message_values3, second_message_values2, second_message_values1, second_temporary )
+		libhmac_sha256_sha_ni_extend_message_values1( first_message_values1, first_message_values2 )
+		libhmac_sha256_sha_ni_extend_message_values1( second_message_values1, second_message_values2 )
+
+		libhmac_sha256_sha_ni_calculate_rounds( first_state_abef, first_state_cdgh, first_message, first_message_values3, 28 )
+		libhmac_sha256_sha_ni_calculate_rounds( second_state_abef, second_state_cdgh, second_message, second_message_values3, 28 )
+		libhmac_sha256_sha_ni_extend_message_values2( first_message_values0, first_message_values3, first_message_values2, first_temporary )
+		libhmac_sha256_sha_ni_extend_message_values2( second_message_values0, second_message_values3, second_message_values2, second_temporary )
+		libhmac_sha256_sha_ni_extend_message_values1( first_message_values2, first_message_values3 )
+		libhmac_sha256_sha_ni_extend_message_values1( second_message_values2, second_message_values3 )
+
+		libhmac_sha256_sha_ni_calculate_rounds( first_state_abef, first_state_cdgh, first_message, first_message_values0, 32 )
+		libhmac_sha256_sha_ni_calculate_rounds( second_state_abef, second_state_cdgh, second_message, second_message_values0, 32 )
+		libhmac_sha256_sha_ni_extend_message_values2( first_message_values1, first_message_values0, first_message_values3, first_temporary )
+		libhmac_sha256_sha_ni_extend_message_values2( second_message_values1, second_message_values0, second_message_values3, second_temporary )
+		libhmac_sha256_sha_ni_extend_message_values1( first_message_values3, first_message_values0 )
+		libhmac_sha256_sha_ni_extend_message_values1( second_message_values3, second_message_values0 )
+
+		libhmac_sha256_sha_ni_calculate_rounds( first_state_abef, first_state_cdgh, first_message, first_message_values1, 36 )
+		libhmac_sha256_sha_ni_calculate_rounds( second_state_abef, second_state_cdgh, second_message, second_message_values1, 36 )
+		libhmac_sha256_sha_ni_extend_message_values2( first_message_values2, first_message_values1, first_message_values0, first_temporary )
+		libhmac_sha256_sha_ni_extend_message_values2( second_message_values2, second_message_values1, second_message_values0, second_temporary )
+		libhmac_sha256_sha_ni_extend_message_values1( first_message_values0, first_message_values1 )
+		libhmac_sha256_sha_ni_extend_message_values1( second_message_values0, second_message_values1 )
+
+		libhmac_sha256_sha_ni_calculate_rounds( first_state_abef, first_state_cdgh, first_message, first_message_values2, 40 )
+		libhmac_sha256_sha_ni_calculate_rounds( second_state_abef, second_state_cdgh, second_message, second_message_values2, 40 )
+		libhmac_sha256_sha_ni_extend_message_values2( first_message_values3, first_message_values2, first_message_values1, first_temporary )
+		libhmac_sha256_sha_ni_extend_message_values2( second_message_values3, second_message_values2, second_message_values1, second_temporary )
+		libhmac_sha256_sha_ni_extend_message_values1( first_message_values1, first_message_values2 )
+		libhmac_sha256_sha_ni_extend_message_values1( second_message_values1, second_message_values2 )
+
+		libhmac_sha256_sha_ni_calculate_rounds( first_state_abef, first_state_cdgh, first_message, first_message_values3, 44 )
+		libhmac_sha256_sha_ni_calculate_rounds( second_state_abef, second_state_cdgh, second_message, second_message_values3, 44 )
+		libhmac_sha256_sha_ni_extend_message_values2( first_message_values0, first_message_values3, first_message_values2, first_temporary )
+		libhmac_sha256_sha_ni_extend_message_values2( second_message_values0, second_message_values3, second_message_values2, second_temporary )
+		libhmac_sha256_sha_ni_extend_message_values1( first_message_values2, first_message_values3 )
+		libhmac_sha256_sha_ni_extend_message_values1( second_message_values2, second_message_values3 )
+
+		libhmac_sha256_sha_ni_calculate_rounds( first_state_abef, first_state_cdgh, first_message, first_message_values0, 48 )
+		libhmac_sha256_sha_ni_calculate_rounds( second_state_abef, second_state_cdgh, second_message, second_message_values0, 48 )
+		libhmac_sha256_sha_ni_extend_message_values2( first_message_values1, first_message_values0, first_message_values3, first_temporary )
+		libhmac_sha256_sha_ni_extend_message_values2( second_message_values1, second_message_values0, second_message_values3, second_temporary )
+		libhmac_sha256_sha_ni_extend_message_values1( first_message_values3, first_message_values0 )
+		libhmac_sha256_sha_ni_extend_message_values1( second_message_values3, second_message_values0 )
+
+		libhmac_sha256_sha_ni_calculate_rounds( first_state_abef, first_state_cdgh, first_message, first_message_values1, 52 )
+		libhmac_sha256_sha_ni_calculate_rounds( second_state_abef, second_state_cdgh, second_message, second_message_values1, 52 )
+		libhmac_sha256_sha_ni_extend_message_values2( first_message_values2, first_message_values1, first_message_values0, first_temporary )
+		libhmac_sha256_sha_ni_extend_message_values2( second_message_values2, second_message_values1, second_message_values0, second_temporary )
+
+		libhmac_sha256_sha_ni_calculate_rounds( first_state_abef, first_state_cdgh, first_message, first_message_values2, 56 )
+		libhmac_sha256_sha_ni_calculate_rounds( second_state_abef, second_state_cdgh, second_message, second_message_values2, 56 )
+		libhmac_sha256_sha_ni_extend_message_values2( first_message_values3, first_message_values2, first_message_values1, first_temporary )
+		libhmac_sha256_sha_ni_extend_message_values2( second_message_values3, second_message_values2, second_message_values1, second_temporary )
+
+		libhmac_sha256_sha_ni_calculate_rounds( first_state_abef, first_state_cdgh, first_message, first_message_values3, 60 )
+		libhmac_sha256_sha_ni_calculate_rounds( second_state_abef, second_state_cdgh, second_message, second_message_values3, 60 )
+
+		/* Update the hash values
+		 */
+		first_state_abef  = _mm_add_epi32( first_state_abef, first_previous_state_abef );
+		first_state_cdgh  = _mm_add_epi32( first_state_cdgh, first_previous_state_cdgh );
+		second_state_abef = _mm_add_epi32( second_state_abef, second_previous_state_abef );
+		second_state_cdgh = _mm_add_epi32( second_state_cdgh, second_previous_state_cdgh );
+
+		first_buffer     += 64;
+		second_buffer    += 64;
+		number_of_blocks -= 1;
+	}
+	first_temporary  = _mm_shuffle_epi32( first_state_abef, 0x1b );
+	first_state_cdgh = _mm_shuffle_epi32( first_state_cdgh, 0xb1 );
+	first_state_abef = _mm_blend_epi16( first_temporary, first_state_cdgh, 0xf0 );
+	first_state_cdgh = _mm_alignr_epi8( first_state_cdgh, first_temporary, 8 );
+
+	_mm_storeu_si128( (__m128i *) &( first_hash_values[ 0 ] ), first_state_abef );
+	_mm_storeu_si128( (__m128i *) &( first_hash_values[ 4 ] ), first_state_cdgh );
+
+	second_temporary  = _mm_shuffle_epi32( second_state_abef, 0x1b );
+	second_state_cdgh = _mm_shuffle_epi32( second_state_cdgh, 0xb1 );
+	second_state_abef = _mm_blend_epi16( second_temporary, second_state_cdgh, 0xf0 );
+	second_state_cdgh = _mm_alignr_epi8( second_state_cdgh, second_temporary, 8 );
+
+	_mm_storeu_si128( (__m128i *) &( second_hash_values[ 0 ] ), second_state_abef );
+	_mm_storeu_si128( (__m128i *) &( second_hash_values[ 4 ] ), second_state_cdgh );
+
+	return( 1 );
+}
+
+/* Calculates the SHA-256 of a single 64 byte sized block of which the message schedule is precomputed
+ * The schedule contains the 64 x 32-bit message values with the round constants added,
+ * so only the rounds are calculated
+ * This kernel requires the SHA, SSSE3 and SSE4.1 extensions
+ * Returns 1 if successful or -1 on error
+ */
+LIBHMAC_X86_TARGET( "sse2,ssse3,sse4.1,sha" ) \
+int libhmac_sha256_sha_ni_transform_schedule(
+     uint32_t *hash_values,
+     const uint32_t *schedule )
+{
+	__m128i message;
+	__m128i previous_state_abef;
+	__m128i previous_state_cdgh;
+	__m128i state_abef;
+	__m128i state_cdgh;
+	__m128i temporary;
+
+	/* The SHA instructions expect the state as ABEF and CDGH
+	 */
+	temporary  = _mm_loadu_si128( (const __m128i *) &( hash_values[ 0 ] ) );
+	state_cdgh = _mm_loadu_si128( (const __m128i *) &( hash_values[ 4 ] ) );
+
+	temporary  = _mm_shuffle_epi32( temporary, 0xb1 );
+	state_cdgh = _mm_shuffle_epi32( state_cdgh, 0x1b );
+	state_abef = _mm_alignr_epi8( temporary, state_cdgh, 8 );
+	state_cdgh = _mm_blend_epi16( state_cdgh, temporary, 0xf0 );
+
+	previous_state_abef = state_abef;
+	previous_state_cdgh = state_cdgh;
+
+	/* Calculate the hash values for the precomputed 32-bit values
+	 */
+	libhmac_sha256_sha_ni_calculate_scheduled_rounds( state_abef, state_cdgh, message, schedule, 0 )
+	libhmac_sha256_sha_ni_calculate_scheduled_rounds( state_abef, state_cdgh, message, schedule, 4 )
+	libhmac_sha256_sha_ni_calculate_scheduled_rounds( state_abef, state_cdgh, message, schedule, 8 )
+	libhmac_sha256_sha_ni_calculate_scheduled_rounds( state_abef, state_cdgh, message, schedule, 12 )
+	libhmac_sha256_sha_ni_calculate_scheduled_rounds( state_abef, state_cdgh, message, schedule, 16 )
+	libhmac_sha256_sha_ni_calculate_scheduled_rounds( state_abef, state_cdgh, message, schedule, 20 )
+	libhmac_sha256_sha_ni_calculate_scheduled_rounds( state_abef, state_cdgh, message, schedule, 24 )
+	libhmac_sha256_sha_ni_calculate_scheduled_rounds( state_abef, state_cdgh, message, schedule, 28 )
+	libhmac_sha256_sha_ni_calculate_scheduled_rounds( state_abef, state_cdgh, message, schedule, 32 )
+	libhmac_sha256_sha_ni_calculate_scheduled_rounds( state_abef, state_cdgh, message, schedule, 36 )
+	libhmac_sha256_sha_ni_calculate_scheduled_rounds( state_abef, state_cdgh, message, schedule, 40 )
+	libhmac_sha256_sha_ni_calculate_scheduled_rounds( state_abef, state_cdgh, message, schedule, 44 )
+	libhmac_sha256_sha_ni_calculate_scheduled_rounds( state_abef, state_cdgh, message, schedule, 48 )
+	libhmac_sha256_sha_ni_calculate_scheduled_rounds( state_abef, state_cdgh, message, schedule, 52 )
+	libhmac_sha256_sha_ni_calculate_scheduled_rounds( state_abef, state_cdgh, message, schedule, 56 )
+	libhmac_sha256_sha_ni_calculate_scheduled_rounds( state_abef, state_cdgh, message, schedule, 60 )
+
+	/* Update the hash values
+	 */
+	state_abef = _mm_add_epi32( state_abef, previous_state_abef );
+	state_cdgh = _mm_add_epi32( state_cdgh, previous_state_cdgh );
+
+	temporary  = _mm_shuffle_epi32( state_abef, 0x1b );
+	state_cdgh = _mm_shuffle_epi32( state_cdgh, 0xb1 );
+	state_abef = _mm_blend_epi16( temporary, state_cdgh, 0xf0 );
+	state_cdgh = _mm_alignr_epi8( state_cdgh, temporary, 8 );
+
+	_mm_storeu_si128( (__m128i *) &( hash_values[ 0 ] ), state_abef );
+	_mm_storeu_si128( (__m128i *) &( hash_values[ 4 ] ), state_cdgh );
+
+	return( 1 );
+}
+
+#endif /* defined( LIBHMAC_HAVE_X86_KERNELS ) */
+
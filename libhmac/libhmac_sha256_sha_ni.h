@@ -0,0 +1,59 @@
+/*
+ * SHA-256 SHA-NI kernel functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBHMAC_SHA256_SHA_NI_H )
+#define _LIBHMAC_SHA256_SHA_NI_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libhmac_cpu.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( LIBHMAC_HAVE_X86_KERNELS )
+
+int libhmac_sha256_sha_ni_transform(
+     uint32_t *hash_values,
+     const uint8_t *buffer,
+     size_t number_of_blocks );
+
+int libhmac_sha256_sha_ni_transform_pair(
+     uint32_t *first_hash_values,
+     const uint8_t *first_buffer,
+     uint32_t *second_hash_values,
+     const uint8_t *second_buffer,
+     size_t number_of_blocks );
+
+int libhmac_sha256_sha_ni_transform_schedule(
+     uint32_t *hash_values,
+     const uint32_t *schedule );
+
+#endif /* defined( LIBHMAC_HAVE_X86_KERNELS ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBHMAC_SHA256_SHA_NI_H ) */
+
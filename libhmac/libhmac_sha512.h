@@ -65,6 +65,15 @@ int libhmac_sha512_calculate(
      size_t hash_size,
      libcerror_error_t **error );
 
+LIBHMAC_EXTERN \
+int libhmac_sha512_calculate_batch(
+     const uint8_t **buffers,
+     const size_t *sizes,
+     int number_of_buffers,
+     uint8_t *hashes,
+     size_t hashes_size,
+     libcerror_error_t **error );
+
 LIBHMAC_EXTERN \
 int libhmac_sha512_calculate_hmac(
      const uint8_t *key,
@@ -75,6 +84,13 @@ int libhmac_sha512_calculate_hmac(
      size_t hmac_size,
      libcerror_error_t **error );
 
+LIBHMAC_EXTERN \
+int libhmac_sha512_compress_blocks(
+     uint64_t *hash_values,
+     const uint8_t *blocks,
+     size_t number_of_blocks,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
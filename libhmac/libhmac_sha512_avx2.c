@@ -0,0 +1,263 @@
+/*
+ * SHA-512 AVX2 kernel functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libhmac_cpu.h"
+#include "libhmac_sha512_avx2.h"
+#include "libhmac_sha512_context.h"
+
+#if defined( LIBHMAC_HAVE_X86_KERNELS )
+
+#include <immintrin.h>
+
+/* Rotates the 4 x 64-bit values to the right, AVX2 has no 64-bit vector rotate
+ */
+#define libhmac_sha512_avx2_rotate_right( values, number_of_bits ) \
+	_mm256_or_si256( \
+	 _mm256_srli_epi64( values, number_of_bits ), \
+	 _mm256_slli_epi64( values, 64 - number_of_bits ) )
+
+#define libhmac_sha512_avx2_sigma0( values ) \
+	_mm256_xor_si256( \
+	 _mm256_xor_si256( \
+	  libhmac_sha512_avx2_rotate_right( values, 1 ), \
+	  libhmac_sha512_avx2_rotate_right( values, 8 ) ), \
+	 _mm256_srli_epi64( values, 7 ) )
+
+#define libhmac_sha512_avx2_sigma1( values ) \
+	_mm256_xor_si256( \
+	 _mm256_xor_si256( \
+	  libhmac_sha512_avx2_rotate_right( values, 19 ), \
+	  libhmac_sha512_avx2_rotate_right( values, 61 ) ), \
+	 _mm256_srli_epi64( values, 6 ) )
+
+/* Extends the message values with the next 4 x 64-bit values
+ * message_values0 contains W[t-16..t-13] and is overwritten with W[t..t+3]
+ * message_values1, message_values2 and message_values3 contain W[t-12..t-1]
+ * W[t+2] and W[t+3] depend on W[t] and W[t+1] hence sigma1 is calculated in 2 steps
+ */
+#define libhmac_sha512_avx2_extend_message_values( message_values0, message_values1, message_values2, message_values3, temporary1, temporary2 ) \
+	temporary1      = _mm256_alignr_epi8( _mm256_permute2x128_si256( message_values0, message_values1, 0x21 ), message_values0, 8 ); \
+	temporary2      = _mm256_alignr_epi8( _mm256_permute2x128_si256( message_values2, message_values3, 0x21 ), message_values2, 8 ); \
+	message_values0 = _mm256_add_epi64( message_values0, temporary2 ); \
+	message_values0 = _mm256_add_epi64( message_values0, libhmac_sha512_avx2_sigma0( temporary1 ) ); \
+	temporary2      = _mm256_permute4x64_epi64( message_values3, 0xee ); \
+	temporary1      = _mm256_add_epi64( message_values0, libhmac_sha512_avx2_sigma1( temporary2 ) ); \
+	temporary2      = _mm256_permute4x64_epi64( temporary1, 0x44 ); \
+	message_values0 = _mm256_add_epi64( message_values0, libhmac_sha512_avx2_sigma1( temporary2 ) ); \
+	message_values0 = _mm256_blend_epi32( temporary1, message_values0, 0xf0 );
+
+/* Stores the 4 x 64-bit message values with the round constants added
+ */
+#define libhmac_sha512_avx2_store_message_values_plus_k( message_values_plus_k, round_index, message_values ) \
+	_mm256_storeu_si256( \
+	 (__m256i *) &( message_values_plus_k[ round_index ] ), \
+	 _mm256_add_epi64( \
+	  message_values, \
+	  _mm256_loadu_si256( (const __m256i *) &( libhmac_sha512_context_prime_cube_roots[ round_index ] ) ) ) );
+
+/* Calculates a round, with BMI2 the rotates are compiled into rorx which does not affect the flags
+ */
+#define libhmac_sha512_avx2_calculate_hash_value( message_values_plus_k, round_index, hash_values, hash_value_index0, hash_value_index1, hash_value_index2, hash_value_index3, hash_value_index4, hash_value_index5, hash_value_index6, hash_value_index7, s0, s1, t1, t2 ) \
+	s0 = byte_stream_bit_rotate_right_64bit( hash_values[ hash_value_index0 ], 28 ) \
+	   ^ byte_stream_bit_rotate_right_64bit( hash_values[ hash_value_index0 ], 34 ) \
+	   ^ byte_stream_bit_rotate_right_64bit( hash_values[ hash_value_index0 ], 39 ); \
+	s1 = byte_stream_bit_rotate_right_64bit( hash_values[ hash_value_index4 ], 14 ) \
+	   ^ byte_stream_bit_rotate_right_64bit( hash_values[ hash_value_index4 ], 18 ) \
+	   ^ byte_stream_bit_rotate_right_64bit( hash_values[ hash_value_index4 ], 41 ); \
+\
+	t1  = hash_values[ hash_value_index7 ]; \
+	t1 += s1; \
+	t1 += ( ( hash_values[ hash_value_index5 ] ^ hash_values[ hash_value_index6 ] ) & hash_values[ hash_value_index4 ] ) \
+	    ^ hash_values[ hash_value_index6 ]; \
+	t1 += message_values_plus_k[ round_index ]; \
+	t2  = s0; \
+	t2 += ( ( hash_values[ hash_value_index0 ] | hash_values[ hash_value_index2 ] ) & hash_values[ hash_value_index1 ] ) \
+	    | ( hash_values[ hash_value_index0 ] & hash_values[ hash_value_index2 ] ); \
+\
+	hash_values[ hash_value_index3 ] += t1; \
+	hash_values[ hash_value_index7 ]  = t1 + t2;
+
+/* Calculates the SHA-512 of 128 byte sized blocks of data in a buffer
+ * The message schedule is calculated 4 x 64-bit values at a time with AVX2
+ * and interleaved with the rounds of the preceding values
+ * This kernel requires the AVX, AVX2 and BMI2 extensions
+ * Returns 1 if successful or -1 on error
+ */
+LIBHMAC_X86_TARGET( "avx,avx2,bmi2" ) \
+int libhmac_sha512_avx2_transform(
+     uint64_t *context_hash_values,
+     const uint8_t *buffer,
+     size_t number_of_blocks )
+{
+	uint64_t hash_values[ 8 ];
+	uint64_t message_values_plus_k[ 80 ];
+
+	__m256i byte_order_mask;
+	__m256i message_values0;
+	__m256i message_values1;
+	__m256i message_values2;
+	__m256i message_values3;
+	__m256i temporary1;
+	__m256i temporary2;
+
+	uint64_t s0      = 0;
+	uint64_t s1      = 0;
+	uint64_t t1      = 0;
+	uint64_t t2      = 0;
+	int round_index  = 0;
+
+	byte_order_mask = _mm256_set_epi64x(
+	                   0x08090a0b0c0d0e0fULL,
+	                   0x0001020304050607ULL,
+	                   0x08090a0b0c0d0e0fULL,
+	                   0x0001020304050607ULL );
+
+	while( number_of_blocks > 0 )
+	{
+		if( memory_copy(
+		     hash_values,
+		     context_hash_values,
+		     sizeof( uint64_t ) * 8 ) == NULL )
+		{
+			goto on_error;
+		}
+		/* Break the block into 16 x 64-bit values
+		 */
+		message_values0 = _mm256_shuffle_epi8( _mm256_loadu_si256( (const __m256i *) &( buffer[ 0 ] ) ), byte_order_mask );
+		message_values1 = _mm256_shuffle_epi8( _mm256_loadu_si256( (const __m256i *) &( buffer[ 32 ] ) ), byte_order_mask );
+		message_values2 = _mm256_shuffle_epi8( _mm256_loadu_si256( (const __m256i *) &( buffer[ 64 ] ) ), byte_order_mask );
+		message_values3 = _mm256_shuffle_epi8( _mm256_loadu_si256( (const __m256i *) &( buffer[ 96 ] ) ), byte_order_mask );
+
+		libhmac_sha512_avx2_store_message_values_plus_k( message_values_plus_k, 0, message_values0 )
+		libhmac_sha512_avx2_store_message_values_plus_k( message_values_plus_k, 4, message_values1 )
+		libhmac_sha512_avx2_store_message_values_plus_k( message_values_plus_k, 8, message_values2 )
+		libhmac_sha512_avx2_store_message_values_plus_k( message_values_plus_k, 12, message_values3 )
+
+		/* Extend to 80 x 64-bit values while calculating the hash values of the preceding 64-bit values
+		 */
+		for( round_index = 0;
+		     round_index < 64;
+		     round_index += 16 )
+		{
+			libhmac_sha512_avx2_extend_message_values( message_values0, message_values1, message_values2, message_values3, temporary1, temporary2 )
+			libhmac_sha512_avx2_store_message_values_plus_k( message_values_plus_k, round_index + 16, message_values0 )
+
+			libhmac_sha512_avx2_calculate_hash_value( message_values_plus_k, round_index + 0, hash_values, 0, 1, 2, 3, 4, 5, 6, 7, s0, s1, t1, t2 )
+			libhmac_sha512_avx2_calculate_hash_value( message_values_plus_k, round_index + 1, hash_values, 7, 0, 1, 2, 3, 4, 5, 6, s0, s1, t1, t2 )
+			libhmac_sha512_avx2_calculate_hash_value( message_values_plus_k, round_index + 2, hash_values, 6, 7, 0, 1, 2, 3, 4, 5, s0, s1, t1, t2 )
+			libhmac_sha512_avx2_calculate_hash_value( message_values_plus_k, round_index + 3, hash_values, 5, 6, 7, 0, 1, 2, 3, 4, s0, s1, t1, t2 )
+
+			libhmac_sha512_avx2_extend_message_values( message_values1, message_values2, message_values3, message_values0, temporary1, temporary2 )
+			libhmac_sha512_avx2_store_message_values_plus_k( message_values_plus_k, round_index + 20, message_values1 )
+
+			libhmac_sha512_avx2_calculate_hash_value( message_values_plus_k, round_index + 4, hash_values, 4, 5, 6, 7, 0, 1, 2, 3, s0, s1, t1, t2 )
+			libhmac_sha512_avx2_calculate_hash_value( message_values_plus_k, round_index + 5, hash_values, 3, 4, 5, 6, 7, 0, 1, 2, s0, s1, t1, t2 )
+			libhmac_sha512_avx2_calculate_hash_value( message_values_plus_k, round_index + 6, hash_values, 2, 3, 4, 5, 6, 7, 0, 1, s0, s1, t1, t2 )
+			libhmac_sha512_avx2_calculate_hash_value( message_values_plus_k, round_index + 7, hash_values, 1, 2, 3, 4, 5, 6, 7, 0, s0, s1, t1, t2 )
+
+			libhmac_sha512_avx2_extend_message_values( message_values2, message_values3, message_values0, message_values1, temporary1, temporary2 )
+			libhmac_sha512_avx2_store_message_values_plus_k( message_values_plus_k, round_index + 24, message_values2 )
+
+			libhmac_sha512_avx2_calculate_hash_value( message_values_plus_k, round_index + 8, hash_values, 0, 1, 2, 3, 4, 5, 6, 7, s0, s1, t1, t2 )
+			libhmac_sha512_avx2_calculate_hash_value( message_values_plus_k, round_index + 9, hash_values, 7, 0, 1, 2, 3, 4, 5, 6, s0, s1, t1, t2 )
+			libhmac_sha512_avx2_calculate_hash_value( message_values_plus_k, round_index + 10, hash_values, 6, 7, 0, 1, 2, 3, 4, 5, s0, s1, t1, t2 )
+			libhmac_sha512_avx2_calculate_hash_value( message_values_plus_k, round_index + 11, hash_values, 5, 6, 7, 0, 1, 2, 3, 4, s0, s1, t1, t2 )
+
+			libhmac_sha512_avx2_extend_message_values( message_values3, message_values0, message_values1, message_values2, temporary1, temporary2 )
+			libhmac_sha512_avx2_store_message_values_plus_k( message_values_plus_k, round_index + 28, message_values3 )
+
+			libhmac_sha512_avx2_calculate_hash_value( message_values_plus_k, round_index + 12, hash_values, 4, 5, 6, 7, 0, 1, 2, 3, s0, s1, t1, t2 )
+			libhmac_sha512_avx2_calculate_hash_value( message_values_plus_k, round_index + 13, hash_values, 3, 4, 5, 6, 7, 0, 1, 2, s0, s1, t1, t2 )
+			libhmac_sha512_avx2_calculate_hash_value( message_values_plus_k, round_index + 14, hash_values, 2, 3, 4, 5, 6, 7, 0, 1, s0, s1, t1, t2 )
+			libhmac_sha512_avx2_calculate_hash_value( message_values_plus_k, round_index + 15, hash_values, 1, 2, 3, 4, 5, 6, 7, 0, s0, s1, t1, t2 )
+		}
+		/* Calculate the hash values of the last 16 x 64-bit values
+		 */
+		libhmac_sha512_avx2_calculate_hash_value( message_values_plus_k, 64, hash_values, 0, 1, 2, 3, 4, 5, 6, 7, s0, s1, t1, t2 )
+		libhmac_sha512_avx2_calculate_hash_value( message_values_plus_k, 65, hash_values, 7, 0, 1, 2, 3, 4, 5, 6, s0, s1, t1, t2 )
+		libhmac_sha512_avx2_calculate_hash_value( message_values_plus_k, 66, hash_values, 6, 7, 0, 1, 2, 3, 4, 5, s0, s1, t1, t2 )
+		libhmac_sha512_avx2_calculate_hash_value( message_values_plus_k, 67, hash_values, 5, 6, 7, 0, 1, 2, 3, 4, s0, s1, t1, t2 )
+		libhmac_sha512_avx2_calculate_hash_value( message_values_plus_k, 68, hash_values, 4, 5, 6, 7, 0, 1, 2, 3, s0, s1, t1, t2 )
+		libhmac_sha512_avx2_calculate_hash_value( message_values_plus_k, 69, hash_values, 3, 4, 5, 6, 7, 0, 1, 2, s0, s1, t1, t2 )
+		libhmac_sha512_avx2_calculate_hash_value( message_values_plus_k, 70, hash_values, 2, 3, 4, 5, 6, 7, 0, 1, s0, s1, t1, t2 )
+		libhmac_sha512_avx2_calculate_hash_value( message_values_plus_k, 71, hash_values, 1, 2, 3, 4, 5, 6, 7, 0, s0, s1, t1, t2 )
+		libhmac_sha512_avx2_calculate_hash_value( message_values_plus_k, 72, hash_values, 0, 1, 2, 3, 4, 5, 6, 7, s0, s1, t1, t2 )
+		libhmac_sha512_avx2_calculate_hash_value( message_values_plus_k, 73, hash_values, 7, 0, 1, 2, 3, 4, 5, 6, s0, s1, t1, t2 )
+		libhmac_sha512_avx2_calculate_hash_value( message_values_plus_k, 74, hash_values, 6, 7, 0, 1, 2, 3, 4, 5, s0, s1, t1, t2 )
+		libhmac_sha512_avx2_calculate_hash_value( message_values_plus_k, 75, hash_values, 5, 6, 7, 0, 1, 2, 3, 4, s0, s1, t1, t2 )
+		libhmac_sha512_avx2_calculate_hash_value( message_values_plus_k, 76, hash_values, 4, 5, 6, 7, 0, 1, 2, 3, s0, s1, t1, t2 )
+		libhmac_sha512_avx2_calculate_hash_value( message_values_plus_k, 77, hash_values, 3, 4, 5, 6, 7, 0, 1, 2, s0, s1, t1, t2 )
+		libhmac_sha512_avx2_calculate_hash_value( message_values_plus_k, 78, hash_values, 2, 3, 4, 5, 6, 7, 0, 1, s0, s1, t1, t2 )
+		libhmac_sha512_avx2_calculate_hash_value( message_values_plus_k, 79, hash_values, 1, 2, 3, 4, 5, 6, 7, 0, s0, s1, t1, t2 )
+
+		/* Update the hash values in the context
+		 */
+		context_hash_values[ 0 ] += hash_values[ 0 ];
+		context_hash_values[ 1 ] += hash_values[ 1 ];
+		context_hash_values[ 2 ] += hash_values[ 2 ];
+		context_hash_values[ 3 ] += hash_values[ 3 ];
+		context_hash_values[ 4 ] += hash_values[ 4 ];
+		context_hash_values[ 5 ] += hash_values[ 5 ];
+		context_hash_values[ 6 ] += hash_values[ 6 ];
+		context_hash_values[ 7 ] += hash_values[ 7 ];
+
+		buffer           += 128;
+		number_of_blocks -= 1;
+	}
+	/* Prevent sensitive data from leaking
+	 */
+	if( memory_set(
+	     hash_values,
+	     0,
+	     sizeof( uint64_t ) * 8 ) == NULL )
+	{
+		goto on_error;
+	}
+	if( memory_set(
+	     message_values_plus_k,
+	     0,
+	     sizeof( uint64_t ) * 80 ) == NULL )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	memory_set(
+	 message_values_plus_k,
+	 0,
+	 sizeof( uint64_t ) * 80 );
+
+	memory_set(
+	 hash_values,
+	 0,
+	 sizeof( uint64_t ) * 8 );
+
+	return( -1 );
+}
+
+#endif /* defined( LIBHMAC_HAVE_X86_KERNELS ) */
+
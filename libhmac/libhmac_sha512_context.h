@@ -32,7 +32,9 @@
 #include <openssl/evp.h>
 #endif
 
+#include "libhmac_definitions.h"
 #include "libhmac_extern.h"
+#include "libhmac_kernel.h"
 #include "libhmac_libcerror.h"
 #include "libhmac_types.h"
 
@@ -48,8 +50,6 @@ extern "C" {
 
 #endif
 
-#define LIBHMAC_SHA512_BLOCK_SIZE	128
-
 typedef struct libhmac_internal_sha512_context libhmac_internal_sha512_context_t;
 
 struct libhmac_internal_sha512_context
@@ -88,6 +88,20 @@ struct libhmac_internal_sha512_context
 #endif /* defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_SHA_H ) && defined( SHA512_DIGEST_LENGTH ) */
 };
 
+extern const uint64_t libhmac_sha512_context_prime_square_roots[ 8 ];
+
+extern const uint64_t libhmac_sha512_context_prime_cube_roots[ 80 ];
+
+int libhmac_sha512_context_transform_portable(
+     uint64_t *context_hash_values,
+     const uint8_t *buffer,
+     size_t number_of_blocks );
+
+int libhmac_sha512_context_get_transform_function(
+     int kernel_type,
+     libhmac_kernel_transform_64bit_function_t *transform_function,
+     libcerror_error_t **error );
+
 #if !defined( LIBHMAC_HAVE_SHA512_SUPPORT )
 
 ssize_t libhmac_sha512_context_transform(
@@ -98,6 +112,27 @@ ssize_t libhmac_sha512_context_transform(
 
 #endif /* !defined( LIBHMAC_HAVE_SHA512_SUPPORT ) */
 
+int libhmac_sha512_context_transform_blocks(
+     uint64_t *hash_values,
+     const uint8_t *blocks,
+     size_t number_of_blocks );
+
+int libhmac_sha512_context_get_kernel_type(
+     void );
+
+int libhmac_internal_sha512_context_initialize(
+     libhmac_internal_sha512_context_t *internal_context,
+     libcerror_error_t **error );
+
+int libhmac_internal_sha512_context_clear(
+     libhmac_internal_sha512_context_t *internal_context,
+     libcerror_error_t **error );
+
+int libhmac_internal_sha512_context_copy(
+     libhmac_internal_sha512_context_t *destination_internal_context,
+     libhmac_internal_sha512_context_t *source_internal_context,
+     libcerror_error_t **error );
+
 LIBHMAC_EXTERN \
 int libhmac_sha512_context_initialize(
      libhmac_sha512_context_t **context,
@@ -108,6 +143,35 @@ int libhmac_sha512_context_free(
      libhmac_sha512_context_t **context,
      libcerror_error_t **error );
 
+LIBHMAC_EXTERN \
+int libhmac_sha512_context_get_size(
+     size_t *context_size,
+     size_t *context_alignment,
+     libcerror_error_t **error );
+
+LIBHMAC_EXTERN \
+int libhmac_sha512_context_initialize_in_place(
+     libhmac_sha512_context_t **context,
+     uint8_t *memory,
+     size_t memory_size,
+     libcerror_error_t **error );
+
+LIBHMAC_EXTERN \
+int libhmac_sha512_context_free_in_place(
+     libhmac_sha512_context_t **context,
+     libcerror_error_t **error );
+
+LIBHMAC_EXTERN \
+int libhmac_sha512_context_reset(
+     libhmac_sha512_context_t *context,
+     libcerror_error_t **error );
+
+LIBHMAC_EXTERN \
+int libhmac_sha512_context_clone(
+     libhmac_sha512_context_t **destination_context,
+     libhmac_sha512_context_t *source_context,
+     libcerror_error_t **error );
+
 LIBHMAC_EXTERN \
 int libhmac_sha512_context_update(
      libhmac_sha512_context_t *context,
@@ -115,6 +179,14 @@ int libhmac_sha512_context_update(
      size_t size,
      libcerror_error_t **error );
 
+LIBHMAC_EXTERN \
+int libhmac_sha512_context_update_iov(
+     libhmac_sha512_context_t *context,
+     const uint8_t **buffers,
+     const size_t *sizes,
+     int number_of_buffers,
+     libcerror_error_t **error );
+
 LIBHMAC_EXTERN \
 int libhmac_sha512_context_finalize(
      libhmac_sha512_context_t *context,
@@ -122,6 +194,20 @@ int libhmac_sha512_context_finalize(
      size_t hash_size,
      libcerror_error_t **error );
 
+LIBHMAC_EXTERN \
+int libhmac_sha512_context_export_state(
+     libhmac_sha512_context_t *context,
+     uint8_t *state,
+     size_t state_size,
+     libcerror_error_t **error );
+
+LIBHMAC_EXTERN \
+int libhmac_sha512_context_import_state(
+     libhmac_sha512_context_t *context,
+     const uint8_t *state,
+     size_t state_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
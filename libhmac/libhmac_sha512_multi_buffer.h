@@ -0,0 +1,193 @@
+/*
+ * SHA-512 multi-buffer functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBHMAC_SHA512_MULTI_BUFFER_H )
+#define _LIBHMAC_SHA512_MULTI_BUFFER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libhmac_kernel.h"
+#include "libhmac_libcerror.h"
+#include "libhmac_sha512_context.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if !defined( LIBHMAC_HAVE_SHA512_SUPPORT )
+
+#define LIBHMAC_SHA512_MULTI_BUFFER_MAXIMUM_NUMBER_OF_LANES	8
+
+typedef struct libhmac_sha512_multi_buffer_lane libhmac_sha512_multi_buffer_lane_t;
+
+struct libhmac_sha512_multi_buffer_lane
+{
+	/* The index of the message in the lane or -1 if the lane is empty
+	 */
+	int message_index;
+
+	/* The blocks of data of the message that remain to be transformed
+	 */
+	const uint8_t *buffer;
+
+	/* The number of blocks that remain to be transformed
+	 */
+	size_t number_of_blocks;
+
+	/* Value to indicate the lane is transforming the final blocks
+	 */
+	uint8_t is_final;
+
+	/* The final blocks, containing the remaining data and the padding
+	 */
+	uint8_t final_blocks[ 2 * LIBHMAC_SHA512_BLOCK_SIZE ];
+
+	/* The number of final blocks
+	 */
+	size_t number_of_final_blocks;
+};
+
+typedef struct libhmac_sha512_multi_buffer_scheduler libhmac_sha512_multi_buffer_scheduler_t;
+
+struct libhmac_sha512_multi_buffer_scheduler
+{
+	/* The multi-buffer transform function
+	 */
+	libhmac_kernel_multi_buffer_transform_64bit_function_t transform_function;
+
+	/* The single-stream transform function
+	 */
+	libhmac_kernel_transform_64bit_function_t single_stream_transform_function;
+
+	/* The number of lanes
+	 */
+	int number_of_lanes;
+
+	/* The minimum number of active lanes for which the multi-buffer kernel is faster
+	 */
+	int minimum_number_of_active_lanes;
+
+	/* The number of active lanes
+	 */
+	int number_of_active_lanes;
+
+	/* The lanes
+	 */
+	libhmac_sha512_multi_buffer_lane_t lanes[ LIBHMAC_SHA512_MULTI_BUFFER_MAXIMUM_NUMBER_OF_LANES ];
+
+	/* The buffers of the lanes as passed to the multi-buffer transform function
+	 */
+	const uint8_t *lanes_buffer[ LIBHMAC_SHA512_MULTI_BUFFER_MAXIMUM_NUMBER_OF_LANES ];
+
+	/* The 32-bit hash values of the lanes
+	 */
+	uint64_t lanes_hash_values[ 8 * LIBHMAC_SHA512_MULTI_BUFFER_MAXIMUM_NUMBER_OF_LANES ];
+
+	/* The 32-bit hash values of a single lane
+	 */
+	uint64_t hash_values[ 8 ];
+};
+
+int libhmac_sha512_multi_buffer_get_transform_function(
+     int kernel_type,
+     libhmac_kernel_multi_buffer_transform_64bit_function_t *transform_function,
+     int *number_of_lanes,
+     libcerror_error_t **error );
+
+int libhmac_sha512_multi_buffer_get_kernel_type(
+     void );
+
+int libhmac_sha512_multi_buffer_scheduler_initialize(
+     libhmac_sha512_multi_buffer_scheduler_t *scheduler,
+     libcerror_error_t **error );
+
+int libhmac_sha512_multi_buffer_scheduler_clear(
+     libhmac_sha512_multi_buffer_scheduler_t *scheduler,
+     libcerror_error_t **error );
+
+int libhmac_sha512_multi_buffer_scheduler_get_empty_lane(
+     libhmac_sha512_multi_buffer_scheduler_t *scheduler,
+     int *lane_index,
+     libcerror_error_t **error );
+
+int libhmac_sha512_multi_buffer_scheduler_set_lane_message_with_state(
+     libhmac_sha512_multi_buffer_scheduler_t *scheduler,
+     int lane_index,
+     int message_index,
+     const uint8_t *buffer,
+     size_t size,
+     const uint64_t *hash_values,
+     uint64_t prefix_size,
+     libcerror_error_t **error );
+
+int libhmac_sha512_multi_buffer_scheduler_set_lane_message(
+     libhmac_sha512_multi_buffer_scheduler_t *scheduler,
+     int lane_index,
+     int message_index,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error );
+
+int libhmac_sha512_multi_buffer_scheduler_lane_is_complete(
+     libhmac_sha512_multi_buffer_scheduler_t *scheduler,
+     int lane_index );
+
+int libhmac_sha512_multi_buffer_scheduler_transform(
+     libhmac_sha512_multi_buffer_scheduler_t *scheduler,
+     libcerror_error_t **error );
+
+int libhmac_sha512_multi_buffer_scheduler_transform_lane(
+     libhmac_sha512_multi_buffer_scheduler_t *scheduler,
+     int lane_index,
+     libcerror_error_t **error );
+
+int libhmac_sha512_multi_buffer_scheduler_get_lane_hash(
+     libhmac_sha512_multi_buffer_scheduler_t *scheduler,
+     int lane_index,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error );
+
+int libhmac_sha512_multi_buffer_calculate_with_state(
+     const uint8_t **buffers,
+     const size_t *sizes,
+     int number_of_buffers,
+     const uint64_t *hash_values,
+     uint64_t prefix_size,
+     uint8_t *hashes,
+     libcerror_error_t **error );
+
+int libhmac_sha512_multi_buffer_calculate(
+     const uint8_t **buffers,
+     const size_t *sizes,
+     int number_of_buffers,
+     uint8_t *hashes,
+     libcerror_error_t **error );
+
+#endif /* !defined( LIBHMAC_HAVE_SHA512_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBHMAC_SHA512_MULTI_BUFFER_H ) */
+
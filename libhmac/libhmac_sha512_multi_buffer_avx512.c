@@ -0,0 +1,278 @@
+/*
+ * SHA-512 AVX-512 multi-buffer kernel functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libhmac_cpu.h"
+#include "libhmac_sha512_context.h"
+#include "libhmac_sha512_multi_buffer_avx512.h"
+
+#if defined( LIBHMAC_HAVE_X86_KERNELS ) && !defined( LIBHMAC_HAVE_SHA512_SUPPORT )
+
+#include <immintrin.h>
+
+/* The 3-input logic functions of vpternlogq
+ * 0x96 => x ^ y ^ z
+ * 0xca => ( x & y ) | ( ~x & z ), the SHA-512 Ch function
+ * 0xe8 => ( x & y ) | ( x & z ) | ( y & z ), the SHA-512 Maj function
+ */
+#define libhmac_sha512_multi_buffer_avx512_xor3( values1, values2, values3 ) \
+	_mm512_ternarylogic_epi64( values1, values2, values3, 0x96 )
+
+#define libhmac_sha512_multi_buffer_avx512_sigma0( values ) \
+	libhmac_sha512_multi_buffer_avx512_xor3( \
+	 _mm512_ror_epi64( values, 1 ), \
+	 _mm512_ror_epi64( values, 8 ), \
+	 _mm512_srli_epi64( values, 7 ) )
+
+#define libhmac_sha512_multi_buffer_avx512_sigma1( values ) \
+	libhmac_sha512_multi_buffer_avx512_xor3( \
+	 _mm512_ror_epi64( values, 19 ), \
+	 _mm512_ror_epi64( values, 61 ), \
+	 _mm512_srli_epi64( values, 6 ) )
+
+#define libhmac_sha512_multi_buffer_avx512_upper_sigma0( values ) \
+	libhmac_sha512_multi_buffer_avx512_xor3( \
+	 _mm512_ror_epi64( values, 28 ), \
+	 _mm512_ror_epi64( values, 34 ), \
+	 _mm512_ror_epi64( values, 39 ) )
+
+#define libhmac_sha512_multi_buffer_avx512_upper_sigma1( values ) \
+	libhmac_sha512_multi_buffer_avx512_xor3( \
+	 _mm512_ror_epi64( values, 14 ), \
+	 _mm512_ror_epi64( values, 18 ), \
+	 _mm512_ror_epi64( values, 41 ) )
+
+/* Extends the message values of the 8 lanes with W[t], where the 16 x 64-bit message values
+ * are used as a circular buffer containing W[t-16..t-1]
+ */
+#define libhmac_sha512_multi_buffer_avx512_extend_message_value( message_values, round_index ) \
+	message_values[ ( round_index ) & 15 ] = _mm512_add_epi64( \
+	 _mm512_add_epi64( \
+	  message_values[ ( round_index ) & 15 ], \
+	  libhmac_sha512_multi_buffer_avx512_sigma0( message_values[ ( ( round_index ) - 15 ) & 15 ] ) ), \
+	 _mm512_add_epi64( \
+	  message_values[ ( ( round_index ) - 7 ) & 15 ], \
+	  libhmac_sha512_multi_buffer_avx512_sigma1( message_values[ ( ( round_index ) - 2 ) & 15 ] ) ) );
+
+/* Calculates a round of the 8 lanes
+ */
+#define libhmac_sha512_multi_buffer_avx512_calculate_hash_value( message_values, round_index, hash_values, hash_value_index0, hash_value_index1, hash_value_index2, hash_value_index3, hash_value_index4, hash_value_index5, hash_value_index6, hash_value_index7, t1, t2 ) \
+	t1 = _mm512_add_epi64( \
+	      message_values[ ( round_index ) & 15 ], \
+	      _mm512_set1_epi64( (long long) libhmac_sha512_context_prime_cube_roots[ round_index ] ) ); \
+	t1 = _mm512_add_epi64( t1, hash_values[ hash_value_index7 ] ); \
+	t1 = _mm512_add_epi64( t1, libhmac_sha512_multi_buffer_avx512_upper_sigma1( hash_values[ hash_value_index4 ] ) ); \
+	t1 = _mm512_add_epi64( \
+	      t1, \
+	      _mm512_ternarylogic_epi64( hash_values[ hash_value_index4 ], hash_values[ hash_value_index5 ], hash_values[ hash_value_index6 ], 0xca ) ); \
+	t2 = _mm512_add_epi64( \
+	      libhmac_sha512_multi_buffer_avx512_upper_sigma0( hash_values[ hash_value_index0 ] ), \
+	      _mm512_ternarylogic_epi64( hash_values[ hash_value_index0 ], hash_values[ hash_value_index1 ], hash_values[ hash_value_index2 ], 0xe8 ) ); \
+\
+	hash_values[ hash_value_index3 ] = _mm512_add_epi64( hash_values[ hash_value_index3 ], t1 ); \
+	hash_values[ hash_value_index7 ] = _mm512_add_epi64( t1, t2 );
+
+/* Calculates 8 rounds of the 8 lanes
+ */
+#define libhmac_sha512_multi_buffer_avx512_calculate_hash_values( message_values, round_index, hash_values, t1, t2 ) \
+	libhmac_sha512_multi_buffer_avx512_calculate_hash_value( message_values, ( round_index ) + 0, hash_values, 0, 1, 2, 3, 4, 5, 6, 7, t1, t2 ) \
+	libhmac_sha512_multi_buffer_avx512_calculate_hash_value( message_values, ( round_index ) + 1, hash_values, 7, 0, 1, 2, 3, 4, 5, 6, t1, t2 ) \
+	libhmac_sha512_multi_buffer_avx512_calculate_hash_value( message_values, ( round_index ) + 2, hash_values, 6, 7, 0, 1, 2, 3, 4, 5, t1, t2 ) \
+	libhmac_sha512_multi_buffer_avx512_calculate_hash_value( message_values, ( round_index ) + 3, hash_values, 5, 6, 7, 0, 1, 2, 3, 4, t1, t2 ) \
+	libhmac_sha512_multi_buffer_avx512_calculate_hash_value( message_values, ( round_index ) + 4, hash_values, 4, 5, 6, 7, 0, 1, 2, 3, t1, t2 ) \
+	libhmac_sha512_multi_buffer_avx512_calculate_hash_value( message_values, ( round_index ) + 5, hash_values, 3, 4, 5, 6, 7, 0, 1, 2, t1, t2 ) \
+	libhmac_sha512_multi_buffer_avx512_calculate_hash_value( message_values, ( round_index ) + 6, hash_values, 2, 3, 4, 5, 6, 7, 0, 1, t1, t2 ) \
+	libhmac_sha512_multi_buffer_avx512_calculate_hash_value( message_values, ( round_index ) + 7, hash_values, 1, 2, 3, 4, 5, 6, 7, 0, t1, t2 )
+
+/* Calculates the SHA-512 of 128 byte sized blocks of data of 8 independent messages at the same time
+ * Every lane of the 512-bit registers contains the values of one message
+ * lanes_hash_values contains the 8 x 64-bit hash values per word, hash value 0 of the 8 lanes
+ * followed by hash value 1 of the 8 lanes, etc.
+ * lanes_buffer contains a pointer to the blocks of data of every lane
+ * This kernel requires the AVX-512F and AVX-512BW extensions
+ * Returns 1 if successful or -1 on error
+ */
+LIBHMAC_X86_TARGET( "avx,avx2,avx512f,avx512bw" ) \
+int libhmac_sha512_multi_buffer_avx512_transform(
+     uint64_t *lanes_hash_values,
+     const uint8_t **lanes_buffer,
+     size_t number_of_blocks )
+{
+	__m512i hash_values[ 8 ];
+	__m512i lane_values[ 8 ];
+	__m512i message_values[ 16 ];
+	__m512i previous_hash_values[ 8 ];
+	__m512i temporary_values[ 8 ];
+
+	__m512i byte_order_mask;
+	__m512i t1;
+	__m512i t2;
+
+	size_t buffer_offset = 0;
+	int lane_index       = 0;
+	int round_index      = 0;
+	int values_index     = 0;
+
+	byte_order_mask = _mm512_set_epi64(
+	                   0x08090a0b0c0d0e0fULL,
+	                   0x0001020304050607ULL,
+	                   0x08090a0b0c0d0e0fULL,
+	                   0x0001020304050607ULL,
+	                   0x08090a0b0c0d0e0fULL,
+	                   0x0001020304050607ULL,
+	                   0x08090a0b0c0d0e0fULL,
+	                   0x0001020304050607ULL );
+
+	for( values_index = 0;
+	     values_index < 8;
+	     values_index++ )
+	{
+		hash_values[ values_index ] = _mm512_loadu_si512(
+		                               (const void *) &( lanes_hash_values[ values_index * 8 ] ) );
+	}
+	while( number_of_blocks > 0 )
+	{
+		/* Break the blocks into 16 x 64-bit values per lane by transposing 2 times 8 x 8 x 64-bit values
+		 */
+		for( values_index = 0;
+		     values_index < 16;
+		     values_index += 8 )
+		{
+			for( lane_index = 0;
+			     lane_index < 8;
+			     lane_index++ )
+			{
+				lane_values[ lane_index ] = _mm512_loadu_si512(
+				                             (const void *) &( ( lanes_buffer[ lane_index ] )[ buffer_offset + ( values_index * 8 ) ] ) );
+			}
+			/* Every 128-bit part M of temporary_values[ ( 2 x N ) + K ] contains value ( 2 x M ) + K of lanes 2 x N and ( 2 x N ) + 1
+			 */
+			for( lane_index = 0;
+			     lane_index < 8;
+			     lane_index += 2 )
+			{
+				temporary_values[ lane_index ]     = _mm512_unpacklo_epi64( lane_values[ lane_index ], lane_values[ lane_index + 1 ] );
+				temporary_values[ lane_index + 1 ] = _mm512_unpackhi_epi64( lane_values[ lane_index ], lane_values[ lane_index + 1 ] );
+			}
+			for( lane_index = 0;
+			     lane_index < 2;
+			     lane_index++ )
+			{
+				lane_values[ lane_index ]     = _mm512_shuffle_i64x2( temporary_values[ lane_index ], temporary_values[ lane_index + 2 ], 0x44 );
+				lane_values[ lane_index + 2 ] = _mm512_shuffle_i64x2( temporary_values[ lane_index ], temporary_values[ lane_index + 2 ], 0xee );
+				lane_values[ lane_index + 4 ] = _mm512_shuffle_i64x2( temporary_values[ lane_index + 4 ], temporary_values[ lane_index + 6 ], 0x44 );
+				lane_values[ lane_index + 6 ] = _mm512_shuffle_i64x2( temporary_values[ lane_index + 4 ], temporary_values[ lane_index + 6 ], 0xee );
+
+				message_values[ values_index + lane_index ]     = _mm512_shuffle_i64x2( lane_values[ lane_index ], lane_values[ lane_index + 4 ], 0x88 );
+				message_values[ values_index + lane_index + 2 ] = _mm512_shuffle_i64x2( lane_values[ lane_index ], lane_values[ lane_index + 4 ], 0xdd );
+				message_values[ values_index + lane_index + 4 ] = _mm512_shuffle_i64x2( lane_values[ lane_index + 2 ], lane_values[ lane_index + 6 ], 0x88 );
+				message_values[ values_index + lane_index + 6 ] = _mm512_shuffle_i64x2( lane_values[ lane_index + 2 ], lane_values[ lane_index + 6 ], 0xdd );
+			}
+		}
+		for( values_index = 0;
+		     values_index < 16;
+		     values_index++ )
+		{
+			message_values[ values_index ] = _mm512_shuffle_epi8(
+			                                  message_values[ values_index ],
+			                                  byte_order_mask );
+		}
+		for( values_index = 0;
+		     values_index < 8;
+		     values_index++ )
+		{
+			previous_hash_values[ values_index ] = hash_values[ values_index ];
+		}
+		/* Calculate the hash values of the first 16 x 64-bit values
+		 */
+		for( round_index = 0;
+		     round_index < 16;
+		     round_index += 8 )
+		{
+			libhmac_sha512_multi_buffer_avx512_calculate_hash_values( message_values, round_index, hash_values, t1, t2 )
+		}
+		/* Extend to 80 x 64-bit values while calculating the hash values
+		 */
+		for( round_index = 16;
+		     round_index < 80;
+		     round_index += 8 )
+		{
+			libhmac_sha512_multi_buffer_avx512_extend_message_value( message_values, round_index + 0 )
+			libhmac_sha512_multi_buffer_avx512_extend_message_value( message_values, round_index + 1 )
+			libhmac_sha512_multi_buffer_avx512_extend_message_value( message_values, round_index + 2 )
+			libhmac_sha512_multi_buffer_avx512_extend_message_value( message_values, round_index + 3 )
+			libhmac_sha512_multi_buffer_avx512_extend_message_value( message_values, round_index + 4 )
+			libhmac_sha512_multi_buffer_avx512_extend_message_value( message_values, round_index + 5 )
+			libhmac_sha512_multi_buffer_avx512_extend_message_value( message_values, round_index + 6 )
+			libhmac_sha512_multi_buffer_avx512_extend_message_value( message_values, round_index + 7 )
+
+			libhmac_sha512_multi_buffer_avx512_calculate_hash_values( message_values, round_index, hash_values, t1, t2 )
+		}
+		for( values_index = 0;
+		     values_index < 8;
+		     values_index++ )
+		{
+			hash_values[ values_index ] = _mm512_add_epi64(
+			                               hash_values[ values_index ],
+			                               previous_hash_values[ values_index ] );
+		}
+		buffer_offset    += 128;
+		number_of_blocks -= 1;
+	}
+	for( values_index = 0;
+	     values_index < 8;
+	     values_index++ )
+	{
+		_mm512_storeu_si512(
+		 (void *) &( lanes_hash_values[ values_index * 8 ] ),
+		 hash_values[ values_index ] );
+	}
+	/* Prevent sensitive data from leaking
+	 */
+	if( memory_set(
+	     message_values,
+	     0,
+	     sizeof( __m512i ) * 16 ) == NULL )
+	{
+		return( -1 );
+	}
+	if( memory_set(
+	     lane_values,
+	     0,
+	     sizeof( __m512i ) * 8 ) == NULL )
+	{
+		return( -1 );
+	}
+	if( memory_set(
+	     temporary_values,
+	     0,
+	     sizeof( __m512i ) * 8 ) == NULL )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( LIBHMAC_HAVE_X86_KERNELS ) && !defined( LIBHMAC_HAVE_SHA512_SUPPORT ) */
+
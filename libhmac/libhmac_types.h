@@ -35,17 +35,47 @@
  */
 #if defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI )
 typedef struct libhmac_md5_context {}		libhmac_md5_context_t;
+typedef struct libhmac_md5_job_manager {}	libhmac_md5_job_manager_t;
+typedef struct libhmac_md5_key {}		libhmac_md5_key_t;
+typedef struct libhmac_md5_hmac_context {}	libhmac_md5_hmac_context_t;
 typedef struct libhmac_sha1_context {}		libhmac_sha1_context_t;
+typedef struct libhmac_sha1_job_manager {}	libhmac_sha1_job_manager_t;
+typedef struct libhmac_sha1_key {}		libhmac_sha1_key_t;
+typedef struct libhmac_sha1_hmac_context {}	libhmac_sha1_hmac_context_t;
 typedef struct libhmac_sha224_context {}	libhmac_sha224_context_t;
+typedef struct libhmac_sha224_job_manager {}	libhmac_sha224_job_manager_t;
+typedef struct libhmac_sha224_key {}		libhmac_sha224_key_t;
+typedef struct libhmac_sha224_hmac_context {}	libhmac_sha224_hmac_context_t;
 typedef struct libhmac_sha256_context {}	libhmac_sha256_context_t;
+typedef struct libhmac_sha256_job_manager {}	libhmac_sha256_job_manager_t;
+typedef struct libhmac_sha256_key {}		libhmac_sha256_key_t;
+typedef struct libhmac_sha256_hmac_context {}	libhmac_sha256_hmac_context_t;
 typedef struct libhmac_sha512_context {}	libhmac_sha512_context_t;
+typedef struct libhmac_sha512_job_manager {}	libhmac_sha512_job_manager_t;
+typedef struct libhmac_sha512_key {}		libhmac_sha512_key_t;
+typedef struct libhmac_sha512_hmac_context {}	libhmac_sha512_hmac_context_t;
 
 #else
 typedef intptr_t libhmac_md5_context_t;
+typedef intptr_t libhmac_md5_job_manager_t;
+typedef intptr_t libhmac_md5_key_t;
+typedef intptr_t libhmac_md5_hmac_context_t;
 typedef intptr_t libhmac_sha1_context_t;
+typedef intptr_t libhmac_sha1_job_manager_t;
+typedef intptr_t libhmac_sha1_key_t;
+typedef intptr_t libhmac_sha1_hmac_context_t;
 typedef intptr_t libhmac_sha224_context_t;
+typedef intptr_t libhmac_sha224_job_manager_t;
+typedef intptr_t libhmac_sha224_key_t;
+typedef intptr_t libhmac_sha224_hmac_context_t;
 typedef intptr_t libhmac_sha256_context_t;
+typedef intptr_t libhmac_sha256_job_manager_t;
+typedef intptr_t libhmac_sha256_key_t;
+typedef intptr_t libhmac_sha256_hmac_context_t;
 typedef intptr_t libhmac_sha512_context_t;
+typedef intptr_t libhmac_sha512_job_manager_t;
+typedef intptr_t libhmac_sha512_key_t;
+typedef intptr_t libhmac_sha512_hmac_context_t;
 
 #endif /* defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI ) */
 
@@ -0,0 +1,365 @@
+/*
+ * Library kernel functions test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "hmac_test_libcerror.h"
+#include "hmac_test_libhmac.h"
+#include "hmac_test_macros.h"
+#include "hmac_test_unused.h"
+
+#include "../libhmac/libhmac_kernel.h"
+
+#if defined( __GNUC__ ) && !defined( LIBHMAC_DLL_IMPORT )
+
+/* Tests the libhmac_kernel_is_supported function
+ * Returns 1 if successful or 0 if not
+ */
+int hmac_test_kernel_is_supported(
+     void )
+{
+	int result = 0;
+
+	/* Test regular cases
+	 */
+	result = libhmac_kernel_is_supported(
+	          LIBHMAC_KERNEL_TYPE_PORTABLE );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libhmac_kernel_is_supported(
+	          LIBHMAC_KERNEL_TYPE_LIBCRYPTO );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libhmac_kernel_is_supported(
+	          -1 );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libhmac_kernel_select function
+ * Returns 1 if successful or 0 if not
+ */
+int hmac_test_kernel_select(
+     void )
+{
+	int kernel_types[ 3 ] = {
+		-1, LIBHMAC_KERNEL_TYPE_LIBCRYPTO, LIBHMAC_KERNEL_TYPE_PORTABLE };
+
+	int result            = 0;
+
+	/* Test regular cases
+	 */
+	result = libhmac_kernel_select(
+	          &( kernel_types[ 2 ] ),
+	          1 );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test if unsupported kernel types are skipped
+	 */
+	result = libhmac_kernel_select(
+	          kernel_types,
+	          3 );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 2 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBHMAC_DLL_IMPORT ) */
+
+/* Tests the libhmac_get_kernel_type function
+ * Returns 1 if successful or 0 if not
+ */
+int hmac_test_get_kernel_type(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int hash_algorithm       = 0;
+	int kernel_type          = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	for( hash_algorithm = LIBHMAC_HASH_ALGORITHM_MD5;
+	     hash_algorithm <= LIBHMAC_HASH_ALGORITHM_SHA512;
+	     hash_algorithm++ )
+	{
+		kernel_type = 0;
+
+		result = libhmac_get_kernel_type(
+		          hash_algorithm,
+		          &kernel_type,
+		          &error );
+
+		HMAC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HMAC_TEST_ASSERT_GREATER_THAN_INT(
+		 "kernel_type",
+		 kernel_type,
+		 0 );
+
+		HMAC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+#if defined( __GNUC__ ) && !defined( LIBHMAC_DLL_IMPORT )
+		if( kernel_type != LIBHMAC_KERNEL_TYPE_LIBCRYPTO )
+		{
+			result = libhmac_kernel_is_supported(
+			          kernel_type );
+
+			HMAC_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+		}
+#endif /* defined( __GNUC__ ) && !defined( LIBHMAC_DLL_IMPORT ) */
+	}
+	/* Test error cases
+	 */
+	result = libhmac_get_kernel_type(
+	          -1,
+	          &kernel_type,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_get_kernel_type(
+	          LIBHMAC_HASH_ALGORITHM_SHA256,
+	          NULL,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libhmac_get_multi_buffer_kernel_type function
+ * Returns 1 if successful or 0 if not
+ */
+int hmac_test_get_multi_buffer_kernel_type(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int hash_algorithm       = 0;
+	int kernel_type          = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	for( hash_algorithm = LIBHMAC_HASH_ALGORITHM_MD5;
+	     hash_algorithm <= LIBHMAC_HASH_ALGORITHM_SHA512;
+	     hash_algorithm++ )
+	{
+		kernel_type = 0;
+
+		result = libhmac_get_multi_buffer_kernel_type(
+		          hash_algorithm,
+		          &kernel_type,
+		          &error );
+
+		HMAC_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		HMAC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( result == 0 )
+		{
+			HMAC_TEST_ASSERT_EQUAL_INT(
+			 "kernel_type",
+			 kernel_type,
+			 0 );
+		}
+		else
+		{
+			HMAC_TEST_ASSERT_GREATER_THAN_INT(
+			 "kernel_type",
+			 kernel_type,
+			 LIBHMAC_KERNEL_TYPE_PORTABLE );
+
+#if defined( __GNUC__ ) && !defined( LIBHMAC_DLL_IMPORT )
+			result = libhmac_kernel_is_supported(
+			          kernel_type );
+
+			HMAC_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+#endif /* defined( __GNUC__ ) && !defined( LIBHMAC_DLL_IMPORT ) */
+		}
+	}
+	/* Test error cases
+	 */
+	result = libhmac_get_multi_buffer_kernel_type(
+	          -1,
+	          &kernel_type,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_get_multi_buffer_kernel_type(
+	          LIBHMAC_HASH_ALGORITHM_SHA256,
+	          NULL,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc HMAC_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] HMAC_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc HMAC_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] HMAC_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	HMAC_TEST_UNREFERENCED_PARAMETER( argc )
+	HMAC_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBHMAC_DLL_IMPORT )
+
+	HMAC_TEST_RUN(
+	 "libhmac_kernel_is_supported",
+	 hmac_test_kernel_is_supported );
+
+	HMAC_TEST_RUN(
+	 "libhmac_kernel_select",
+	 hmac_test_kernel_select );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBHMAC_DLL_IMPORT ) */
+
+	HMAC_TEST_RUN(
+	 "libhmac_get_kernel_type",
+	 hmac_test_get_kernel_type );
+
+	HMAC_TEST_RUN(
+	 "libhmac_get_multi_buffer_kernel_type",
+	 hmac_test_get_multi_buffer_kernel_type );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
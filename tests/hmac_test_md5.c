@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <memory.h>
 #include <types.h>
 
@@ -44,8 +45,13 @@ int hmac_test_md5_calculate(
 	uint8_t data[ 208 ];
 	uint8_t hash[ LIBHMAC_MD5_HASH_SIZE ];
 
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	libcerror_error_t *error        = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_HMAC_TEST_MEMORY )
+	int kernel_type                 = 0;
+	int malloc_attempts_before_fail = 0;
+#endif
 
 	/* Initialize test
 	 */
@@ -72,41 +78,58 @@ int hmac_test_md5_calculate(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
 #if defined( HAVE_HMAC_TEST_MEMORY )
 
-	/* Test libhmac_md5_calculate with malloc failing in libhmac_md5_context_initialize
+	/* Test libhmac_md5_calculate does not allocate memory
+	 * The libcrypto kernel is skipped since OpenSSL can allocate memory internally
 	 */
-	hmac_test_malloc_attempts_before_fail = 0;
-
-	result = libhmac_md5_calculate(
-	          data,
-	          208,
-	          hash,
-	          LIBHMAC_MD5_HASH_SIZE,
+	result = libhmac_get_kernel_type(
+	          LIBHMAC_HASH_ALGORITHM_MD5,
+	          &kernel_type,
 	          &error );
 
-	if( hmac_test_malloc_attempts_before_fail != -1 )
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( kernel_type != LIBHMAC_KERNEL_TYPE_LIBCRYPTO )
 	{
+		hmac_test_malloc_attempts_before_fail = 0;
+
+		result = libhmac_md5_calculate(
+		          data,
+		          208,
+		          hash,
+		          LIBHMAC_MD5_HASH_SIZE,
+		          &error );
+
+		malloc_attempts_before_fail = hmac_test_malloc_attempts_before_fail;
+
 		hmac_test_malloc_attempts_before_fail = -1;
-	}
-	else
-	{
+
 		HMAC_TEST_ASSERT_EQUAL_INT(
 		 "result",
 		 result,
-		 -1 );
+		 1 );
 
-		HMAC_TEST_ASSERT_IS_NOT_NULL(
+		HMAC_TEST_ASSERT_IS_NULL(
 		 "error",
 		 error );
 
-		libcerror_error_free(
-		 &error );
+		HMAC_TEST_ASSERT_EQUAL_INT(
+		 "malloc_attempts_before_fail",
+		 malloc_attempts_before_fail,
+		 0 );
 	}
 #endif /* defined( HAVE_HMAC_TEST_MEMORY ) */
 
+	/* Test error cases
+	 */
 	/* Test libhmac_md5_calculate with libhmac_md5_context_update failing
 	 */
 	result = libhmac_md5_calculate(
@@ -160,6 +183,216 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libhmac_md5_calculate_batch function
+ * Returns 1 if successful or 0 if not
+ */
+int hmac_test_md5_calculate_batch(
+     void )
+{
+	uint8_t expected_hashes[ 3 * LIBHMAC_MD5_HASH_SIZE ] = {
+		0xd4, 0x1d, 0x8c, 0xd9, 0x8f, 0x00, 0xb2, 0x04, 0xe9, 0x80, 0x09, 0x98, 0xec, 0xf8, 0x42, 0x7e,
+		0x90, 0x01, 0x50, 0x98, 0x3c, 0xd2, 0x4f, 0xb0, 0xd6, 0x96, 0x3f, 0x7d, 0x28, 0xe1, 0x7f, 0x72,
+		0x82, 0x15, 0xef, 0x07, 0x96, 0xa2, 0x0b, 0xca, 0xaa, 0xe1, 0x16, 0xd3, 0x87, 0x6c, 0x66, 0x4a };
+
+	uint8_t hashes[ 3 * LIBHMAC_MD5_HASH_SIZE ];
+
+	const uint8_t *buffers[ 3 ] = {
+		(uint8_t *) "",
+		(uint8_t *) "abc",
+		(uint8_t *) "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq" };
+
+	size_t sizes[ 3 ] = {
+		0, 3, 56 };
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libhmac_md5_calculate_batch(
+	          buffers,
+	          sizes,
+	          3,
+	          hashes,
+	          3 * LIBHMAC_MD5_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hashes,
+	          expected_hashes,
+	          3 * LIBHMAC_MD5_HASH_SIZE );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libhmac_md5_calculate_batch(
+	          NULL,
+	          sizes,
+	          3,
+	          hashes,
+	          3 * LIBHMAC_MD5_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_md5_calculate_batch(
+	          buffers,
+	          NULL,
+	          3,
+	          hashes,
+	          3 * LIBHMAC_MD5_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_md5_calculate_batch(
+	          buffers,
+	          sizes,
+	          -1,
+	          hashes,
+	          3 * LIBHMAC_MD5_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_md5_calculate_batch(
+	          buffers,
+	          sizes,
+	          3,
+	          NULL,
+	          3 * LIBHMAC_MD5_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_md5_calculate_batch(
+	          buffers,
+	          sizes,
+	          3,
+	          hashes,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_md5_calculate_batch(
+	          buffers,
+	          sizes,
+	          3,
+	          hashes,
+	          2 * LIBHMAC_MD5_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libhmac_md5_calculate_batch with a missing buffer
+	 */
+	buffers[ 0 ] = NULL;
+
+	result = libhmac_md5_calculate_batch(
+	          buffers,
+	          sizes,
+	          3,
+	          hashes,
+	          3 * LIBHMAC_MD5_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the libhmac_md5_calculate_hmac function
  * Returns 1 if successful or 0 if not
  */
@@ -170,8 +403,13 @@ int hmac_test_md5_calculate_hmac(
 	uint8_t hmac[ LIBHMAC_MD5_HASH_SIZE ];
 	uint8_t key[ 16 ];
 
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	libcerror_error_t *error        = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_HMAC_TEST_MEMORY )
+	int kernel_type                 = 0;
+	int malloc_attempts_before_fail = 0;
+#endif
 
 	/* Initialize test
 	 */
@@ -272,36 +510,53 @@ int hmac_test_md5_calculate_hmac(
 
 #if defined( HAVE_HMAC_TEST_MEMORY )
 
-	/* Test libhmac_md5_calculate_hmac with malloc failing
+	/* Test libhmac_md5_calculate_hmac does not allocate memory
+	 * The libcrypto kernel is skipped since OpenSSL can allocate memory internally
 	 */
-	hmac_test_malloc_attempts_before_fail = 0;
-
-	result = libhmac_md5_calculate_hmac(
-	          key,
-	          16,
-	          data,
-	          208,
-	          hmac,
-	          LIBHMAC_MD5_HASH_SIZE,
+	result = libhmac_get_kernel_type(
+	          LIBHMAC_HASH_ALGORITHM_MD5,
+	          &kernel_type,
 	          &error );
 
-	if( hmac_test_malloc_attempts_before_fail != -1 )
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( kernel_type != LIBHMAC_KERNEL_TYPE_LIBCRYPTO )
 	{
+		hmac_test_malloc_attempts_before_fail = 0;
+
+		result = libhmac_md5_calculate_hmac(
+		          key,
+		          16,
+		          data,
+		          208,
+		          hmac,
+		          LIBHMAC_MD5_HASH_SIZE,
+		          &error );
+
+		malloc_attempts_before_fail = hmac_test_malloc_attempts_before_fail;
+
 		hmac_test_malloc_attempts_before_fail = -1;
-	}
-	else
-	{
+
 		HMAC_TEST_ASSERT_EQUAL_INT(
 		 "result",
 		 result,
-		 -1 );
+		 1 );
 
-		HMAC_TEST_ASSERT_IS_NOT_NULL(
+		HMAC_TEST_ASSERT_IS_NULL(
 		 "error",
 		 error );
 
-		libcerror_error_free(
-		 &error );
+		HMAC_TEST_ASSERT_EQUAL_INT(
+		 "malloc_attempts_before_fail",
+		 malloc_attempts_before_fail,
+		 0 );
 	}
 #endif /* defined( HAVE_HMAC_TEST_MEMORY ) */
 
@@ -338,6 +593,179 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libhmac_md5_compress_blocks function
+ * Returns 1 if successful or 0 if not
+ */
+int hmac_test_md5_compress_blocks(
+     void )
+{
+	uint8_t blocks[ 3 * LIBHMAC_MD5_BLOCK_SIZE ];
+	uint8_t expected_hash[ LIBHMAC_MD5_HASH_SIZE ];
+	uint8_t hash[ LIBHMAC_MD5_HASH_SIZE ];
+	uint32_t hash_values[ 4 ] = {
+		0x67452301UL, 0xefcdab89UL, 0x98badcfeUL, 0x10325476UL };
+
+	libcerror_error_t *error = NULL;
+	size_t data_offset       = 0;
+	size_t hash_offset       = 0;
+	int result               = 0;
+	int value_index          = 0;
+
+	/* Initialize test
+	 * The last block contains the padding of 2 blocks of data
+	 */
+	for( data_offset = 0;
+	     data_offset < ( 2 * LIBHMAC_MD5_BLOCK_SIZE );
+	     data_offset++ )
+	{
+		blocks[ data_offset ] = (uint8_t) data_offset;
+	}
+	memory_set(
+	 &( blocks[ 2 * LIBHMAC_MD5_BLOCK_SIZE ] ),
+	 0,
+	 LIBHMAC_MD5_BLOCK_SIZE );
+
+	blocks[ 2 * LIBHMAC_MD5_BLOCK_SIZE ] = 0x80;
+
+	/* The size of the data in bits is stored as a 64-bit little-endian value
+	 */
+	blocks[ ( 3 * LIBHMAC_MD5_BLOCK_SIZE ) - 7 ] = 0x04;
+
+	result = libhmac_md5_calculate(
+	          blocks,
+	          2 * LIBHMAC_MD5_BLOCK_SIZE,
+	          expected_hash,
+	          LIBHMAC_MD5_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libhmac_md5_compress_blocks(
+	          hash_values,
+	          blocks,
+	          3,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( hash_offset = 0;
+	     hash_offset < LIBHMAC_MD5_HASH_SIZE;
+	     hash_offset += 4 )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 &( hash[ hash_offset ] ),
+		 hash_values[ value_index ] );
+
+		value_index++;
+	}
+	result = memory_compare(
+	          hash,
+	          expected_hash,
+	          LIBHMAC_MD5_HASH_SIZE );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libhmac_md5_compress_blocks(
+	          hash_values,
+	          blocks,
+	          0,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhmac_md5_compress_blocks(
+	          NULL,
+	          blocks,
+	          3,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_md5_compress_blocks(
+	          hash_values,
+	          NULL,
+	          3,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_md5_compress_blocks(
+	          hash_values,
+	          blocks,
+	          (size_t) SSIZE_MAX,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -357,10 +785,18 @@ int main(
 	 "libhmac_md5_calculate",
 	 hmac_test_md5_calculate );
 
+	HMAC_TEST_RUN(
+	 "libhmac_md5_calculate_batch",
+	 hmac_test_md5_calculate_batch );
+
 	HMAC_TEST_RUN(
 	 "libhmac_md5_calculate_hmac",
 	 hmac_test_md5_calculate_hmac );
 
+	HMAC_TEST_RUN(
+	 "libhmac_md5_compress_blocks",
+	 hmac_test_md5_compress_blocks );
+
 	return( EXIT_SUCCESS );
 
 on_error:
@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <memory.h>
 #include <types.h>
 
@@ -42,8 +43,13 @@ int hmac_test_sha1_calculate(
 	uint8_t data[ 208 ];
 	uint8_t hash[ LIBHMAC_SHA1_HASH_SIZE ];
 
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	libcerror_error_t *error        = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_HMAC_TEST_MEMORY )
+	int kernel_type                 = 0;
+	int malloc_attempts_before_fail = 0;
+#endif
 
 	/* Initialize test
 	 */
@@ -70,41 +76,58 @@ int hmac_test_sha1_calculate(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
 #if defined( HAVE_HMAC_TEST_MEMORY )
 
-	/* Test libhmac_sha1_calculate with malloc failing in libhmac_sha1_initialize
+	/* Test libhmac_sha1_calculate does not allocate memory
+	 * The libcrypto kernel is skipped since OpenSSL can allocate memory internally
 	 */
-	hmac_test_malloc_attempts_before_fail = 0;
-
-	result = libhmac_sha1_calculate(
-	          data,
-	          208,
-	          hash,
-	          LIBHMAC_SHA1_HASH_SIZE,
+	result = libhmac_get_kernel_type(
+	          LIBHMAC_HASH_ALGORITHM_SHA1,
+	          &kernel_type,
 	          &error );
 
-	if( hmac_test_malloc_attempts_before_fail != -1 )
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( kernel_type != LIBHMAC_KERNEL_TYPE_LIBCRYPTO )
 	{
+		hmac_test_malloc_attempts_before_fail = 0;
+
+		result = libhmac_sha1_calculate(
+		          data,
+		          208,
+		          hash,
+		          LIBHMAC_SHA1_HASH_SIZE,
+		          &error );
+
+		malloc_attempts_before_fail = hmac_test_malloc_attempts_before_fail;
+
 		hmac_test_malloc_attempts_before_fail = -1;
-	}
-	else
-	{
+
 		HMAC_TEST_ASSERT_EQUAL_INT(
 		 "result",
 		 result,
-		 -1 );
+		 1 );
 
-		HMAC_TEST_ASSERT_IS_NOT_NULL(
+		HMAC_TEST_ASSERT_IS_NULL(
 		 "error",
 		 error );
 
-		libcerror_error_free(
-		 &error );
+		HMAC_TEST_ASSERT_EQUAL_INT(
+		 "malloc_attempts_before_fail",
+		 malloc_attempts_before_fail,
+		 0 );
 	}
 #endif /* defined( HAVE_HMAC_TEST_MEMORY ) */
 
+	/* Test error cases
+	 */
 	/* Test libhmac_sha1_calculate with libhmac_sha1_update failing
 	 */
 	result = libhmac_sha1_calculate(
@@ -158,6 +181,219 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libhmac_sha1_calculate_batch function
+ * Returns 1 if successful or 0 if not
+ */
+int hmac_test_sha1_calculate_batch(
+     void )
+{
+	uint8_t expected_hashes[ 3 * LIBHMAC_SHA1_HASH_SIZE ] = {
+		0xda, 0x39, 0xa3, 0xee, 0x5e, 0x6b, 0x4b, 0x0d, 0x32, 0x55, 0xbf, 0xef, 0x95, 0x60, 0x18, 0x90,
+		0xaf, 0xd8, 0x07, 0x09,
+		0xa9, 0x99, 0x3e, 0x36, 0x47, 0x06, 0x81, 0x6a, 0xba, 0x3e, 0x25, 0x71, 0x78, 0x50, 0xc2, 0x6c,
+		0x9c, 0xd0, 0xd8, 0x9d,
+		0x84, 0x98, 0x3e, 0x44, 0x1c, 0x3b, 0xd2, 0x6e, 0xba, 0xae, 0x4a, 0xa1, 0xf9, 0x51, 0x29, 0xe5,
+		0xe5, 0x46, 0x70, 0xf1 };
+
+	uint8_t hashes[ 3 * LIBHMAC_SHA1_HASH_SIZE ];
+
+	const uint8_t *buffers[ 3 ] = {
+		(uint8_t *) "",
+		(uint8_t *) "abc",
+		(uint8_t *) "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq" };
+
+	size_t sizes[ 3 ] = {
+		0, 3, 56 };
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libhmac_sha1_calculate_batch(
+	          buffers,
+	          sizes,
+	          3,
+	          hashes,
+	          3 * LIBHMAC_SHA1_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hashes,
+	          expected_hashes,
+	          3 * LIBHMAC_SHA1_HASH_SIZE );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libhmac_sha1_calculate_batch(
+	          NULL,
+	          sizes,
+	          3,
+	          hashes,
+	          3 * LIBHMAC_SHA1_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha1_calculate_batch(
+	          buffers,
+	          NULL,
+	          3,
+	          hashes,
+	          3 * LIBHMAC_SHA1_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha1_calculate_batch(
+	          buffers,
+	          sizes,
+	          -1,
+	          hashes,
+	          3 * LIBHMAC_SHA1_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha1_calculate_batch(
+	          buffers,
+	          sizes,
+	          3,
+	          NULL,
+	          3 * LIBHMAC_SHA1_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha1_calculate_batch(
+	          buffers,
+	          sizes,
+	          3,
+	          hashes,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha1_calculate_batch(
+	          buffers,
+	          sizes,
+	          3,
+	          hashes,
+	          2 * LIBHMAC_SHA1_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libhmac_sha1_calculate_batch with a missing buffer
+	 */
+	buffers[ 0 ] = NULL;
+
+	result = libhmac_sha1_calculate_batch(
+	          buffers,
+	          sizes,
+	          3,
+	          hashes,
+	          3 * LIBHMAC_SHA1_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the libhmac_sha1_calculate_hmac function
  * Returns 1 if successful or 0 if not
  */
@@ -168,8 +404,13 @@ int hmac_test_sha1_calculate_hmac(
 	uint8_t hmac[ LIBHMAC_SHA1_HASH_SIZE ];
 	uint8_t key[ 16 ];
 
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	libcerror_error_t *error        = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_HMAC_TEST_MEMORY )
+	int kernel_type                 = 0;
+	int malloc_attempts_before_fail = 0;
+#endif
 
 	/* Initialize test
 	 */
@@ -270,36 +511,53 @@ int hmac_test_sha1_calculate_hmac(
 
 #if defined( HAVE_HMAC_TEST_MEMORY )
 
-	/* Test libhmac_sha1_calculate_hmac with malloc failing
+	/* Test libhmac_sha1_calculate_hmac does not allocate memory
+	 * The libcrypto kernel is skipped since OpenSSL can allocate memory internally
 	 */
-	hmac_test_malloc_attempts_before_fail = 0;
-
-	result = libhmac_sha1_calculate_hmac(
-	          key,
-	          16,
-	          data,
-	          208,
-	          hmac,
-	          LIBHMAC_SHA1_HASH_SIZE,
+	result = libhmac_get_kernel_type(
+	          LIBHMAC_HASH_ALGORITHM_SHA1,
+	          &kernel_type,
 	          &error );
 
-	if( hmac_test_malloc_attempts_before_fail != -1 )
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( kernel_type != LIBHMAC_KERNEL_TYPE_LIBCRYPTO )
 	{
+		hmac_test_malloc_attempts_before_fail = 0;
+
+		result = libhmac_sha1_calculate_hmac(
+		          key,
+		          16,
+		          data,
+		          208,
+		          hmac,
+		          LIBHMAC_SHA1_HASH_SIZE,
+		          &error );
+
+		malloc_attempts_before_fail = hmac_test_malloc_attempts_before_fail;
+
 		hmac_test_malloc_attempts_before_fail = -1;
-	}
-	else
-	{
+
 		HMAC_TEST_ASSERT_EQUAL_INT(
 		 "result",
 		 result,
-		 -1 );
+		 1 );
 
-		HMAC_TEST_ASSERT_IS_NOT_NULL(
+		HMAC_TEST_ASSERT_IS_NULL(
 		 "error",
 		 error );
 
-		libcerror_error_free(
-		 &error );
+		HMAC_TEST_ASSERT_EQUAL_INT(
+		 "malloc_attempts_before_fail",
+		 malloc_attempts_before_fail,
+		 0 );
 	}
 #endif /* defined( HAVE_HMAC_TEST_MEMORY ) */
 
@@ -336,6 +594,179 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libhmac_sha1_compress_blocks function
+ * Returns 1 if successful or 0 if not
+ */
+int hmac_test_sha1_compress_blocks(
+     void )
+{
+	uint8_t blocks[ 3 * LIBHMAC_SHA1_BLOCK_SIZE ];
+	uint8_t expected_hash[ LIBHMAC_SHA1_HASH_SIZE ];
+	uint8_t hash[ LIBHMAC_SHA1_HASH_SIZE ];
+	uint32_t hash_values[ 5 ] = {
+		0x67452301UL, 0xefcdab89UL, 0x98badcfeUL, 0x10325476UL, 0xc3d2e1f0UL };
+
+	libcerror_error_t *error = NULL;
+	size_t data_offset       = 0;
+	size_t hash_offset       = 0;
+	int result               = 0;
+	int value_index          = 0;
+
+	/* Initialize test
+	 * The last block contains the padding of 2 blocks of data
+	 */
+	for( data_offset = 0;
+	     data_offset < ( 2 * LIBHMAC_SHA1_BLOCK_SIZE );
+	     data_offset++ )
+	{
+		blocks[ data_offset ] = (uint8_t) data_offset;
+	}
+	memory_set(
+	 &( blocks[ 2 * LIBHMAC_SHA1_BLOCK_SIZE ] ),
+	 0,
+	 LIBHMAC_SHA1_BLOCK_SIZE );
+
+	blocks[ 2 * LIBHMAC_SHA1_BLOCK_SIZE ] = 0x80;
+
+	/* The size of the data in bits is stored as a 64-bit big-endian value
+	 */
+	blocks[ ( 3 * LIBHMAC_SHA1_BLOCK_SIZE ) - 2 ] = 0x04;
+
+	result = libhmac_sha1_calculate(
+	          blocks,
+	          2 * LIBHMAC_SHA1_BLOCK_SIZE,
+	          expected_hash,
+	          LIBHMAC_SHA1_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libhmac_sha1_compress_blocks(
+	          hash_values,
+	          blocks,
+	          3,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( hash_offset = 0;
+	     hash_offset < LIBHMAC_SHA1_HASH_SIZE;
+	     hash_offset += 4 )
+	{
+		byte_stream_copy_from_uint32_big_endian(
+		 &( hash[ hash_offset ] ),
+		 hash_values[ value_index ] );
+
+		value_index++;
+	}
+	result = memory_compare(
+	          hash,
+	          expected_hash,
+	          LIBHMAC_SHA1_HASH_SIZE );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libhmac_sha1_compress_blocks(
+	          hash_values,
+	          blocks,
+	          0,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhmac_sha1_compress_blocks(
+	          NULL,
+	          blocks,
+	          3,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha1_compress_blocks(
+	          hash_values,
+	          NULL,
+	          3,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha1_compress_blocks(
+	          hash_values,
+	          blocks,
+	          (size_t) SSIZE_MAX,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -355,10 +786,18 @@ int main(
 	 "libhmac_sha1_calculate",
 	 hmac_test_sha1_calculate );
 
+	HMAC_TEST_RUN(
+	 "libhmac_sha1_calculate_batch",
+	 hmac_test_sha1_calculate_batch );
+
 	HMAC_TEST_RUN(
 	 "libhmac_sha1_calculate_hmac",
 	 hmac_test_sha1_calculate_hmac );
 
+	HMAC_TEST_RUN(
+	 "libhmac_sha1_compress_blocks",
+	 hmac_test_sha1_compress_blocks );
+
 	return( EXIT_SUCCESS );
 
 on_error:
@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <file_stream.h>
 #include <memory.h>
 #include <types.h>
@@ -652,35 +653,159 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libhmac_sha1_context_update function
+/* Tests the libhmac_sha1_context_get_size function
  * Returns 1 if successful or 0 if not
  */
-int hmac_test_sha1_context_update(
+int hmac_test_sha1_context_get_size(
      void )
 {
-	uint8_t data[ 208 ];
+	libcerror_error_t *error = NULL;
+	size_t context_alignment = 0;
+	size_t context_size      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libhmac_sha1_context_get_size(
+	          &context_size,
+	          &context_alignment,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_NOT_EQUAL_SSIZE(
+	 "context_size",
+	 (ssize_t) context_size,
+	 (ssize_t) 0 );
+
+	HMAC_TEST_ASSERT_NOT_EQUAL_SSIZE(
+	 "context_alignment",
+	 (ssize_t) context_alignment,
+	 (ssize_t) 0 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhmac_sha1_context_get_size(
+	          NULL,
+	          &context_alignment,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha1_context_get_size(
+	          &context_size,
+	          NULL,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libhmac_sha1_context_initialize_in_place function
+ * Returns 1 if successful or 0 if not
+ */
+int hmac_test_sha1_context_initialize_in_place(
+     void )
+{
+	uint64_t memory[ 256 ];
 
+	uint8_t expected_hash[ LIBHMAC_SHA1_HASH_SIZE ];
+	uint8_t hash[ LIBHMAC_SHA1_HASH_SIZE ];
+
+	uint8_t test_data[ 3 ]          = { 'a', 'b', 'c' };
 	libcerror_error_t *error        = NULL;
 	libhmac_sha1_context_t *context = NULL;
-	size_t maximum_size             = 0;
+	uint8_t *aligned_memory         = NULL;
+	size_t context_alignment        = 0;
+	size_t context_size             = 0;
+	size_t memory_offset            = 0;
 	int result                      = 0;
 
-#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_SHA_H ) && defined( SHA_DIGEST_LENGTH )
-#if ( SIZEOF_LONG < SIZEOF_SIZE_T )
-	maximum_size = (size_t) ULONG_MAX;
-#else
-	maximum_size = (size_t) SSIZE_MAX;
-#endif
-#elif defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_SHA1 )
-	maximum_size = (size_t) SSIZE_MAX;
-#else
-	maximum_size = (size_t) SSIZE_MAX;
-#endif
+	result = libhmac_sha1_context_get_size(
+	          &context_size,
+	          &context_alignment,
+	          &error );
 
-	/* Initialize test
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_offset = (size_t) ( (intptr_t) memory % (intptr_t) context_alignment );
+
+	if( memory_offset != 0 )
+	{
+		memory_offset = context_alignment - memory_offset;
+	}
+	HMAC_TEST_ASSERT_LESS_THAN_UINT64(
+	 "context_size",
+	 (uint64_t) ( context_size + memory_offset ),
+	 (uint64_t) sizeof( memory ) );
+
+	aligned_memory = &( ( (uint8_t *) memory )[ memory_offset ] );
+
+	result = libhmac_sha1_calculate(
+	          test_data,
+	          3,
+	          expected_hash,
+	          LIBHMAC_SHA1_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
 	 */
-	result = libhmac_sha1_context_initialize(
+	result = libhmac_sha1_context_initialize_in_place(
 	          &context,
+	          aligned_memory,
+	          context_size,
 	          &error );
 
 	HMAC_TEST_ASSERT_EQUAL_INT(
@@ -696,12 +821,10 @@ int hmac_test_sha1_context_update(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
 	result = libhmac_sha1_context_update(
 	          context,
-	          data,
-	          208,
+	          test_data,
+	          3,
 	          &error );
 
 	HMAC_TEST_ASSERT_EQUAL_INT(
@@ -713,10 +836,33 @@ int hmac_test_sha1_context_update(
 	 "error",
 	 error );
 
-	result = libhmac_sha1_context_update(
+	result = libhmac_sha1_context_finalize(
 	          context,
-	          data,
-	          0,
+	          hash,
+	          LIBHMAC_SHA1_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hash,
+	          expected_hash,
+	          LIBHMAC_SHA1_HASH_SIZE );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libhmac_sha1_context_free_in_place(
+	          &context,
 	          &error );
 
 	HMAC_TEST_ASSERT_EQUAL_INT(
@@ -724,16 +870,20 @@ int hmac_test_sha1_context_update(
 	 result,
 	 1 );
 
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "context",
+	 context );
+
 	HMAC_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
 	/* Test error cases
 	 */
-	result = libhmac_sha1_context_update(
+	result = libhmac_sha1_context_initialize_in_place(
 	          NULL,
-	          data,
-	          208,
+	          aligned_memory,
+	          context_size,
 	          &error );
 
 	HMAC_TEST_ASSERT_EQUAL_INT(
@@ -748,12 +898,16 @@ int hmac_test_sha1_context_update(
 	libcerror_error_free(
 	 &error );
 
-	result = libhmac_sha1_context_update(
-	          context,
-	          NULL,
-	          208,
+	context = (libhmac_sha1_context_t *) 0x12345678UL;
+
+	result = libhmac_sha1_context_initialize_in_place(
+	          &context,
+	          aligned_memory,
+	          context_size,
 	          &error );
 
+	context = NULL;
+
 	HMAC_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
@@ -766,51 +920,89 @@ int hmac_test_sha1_context_update(
 	libcerror_error_free(
 	 &error );
 
-	if( maximum_size > 0 )
-	{
-		result = libhmac_sha1_context_update(
-		          context,
-		          data,
-		          maximum_size + 1,
-		          &error );
+	result = libhmac_sha1_context_initialize_in_place(
+	          &context,
+	          NULL,
+	          context_size,
+	          &error );
 
-		HMAC_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		HMAC_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "context",
+	 context );
 
-		libcerror_error_free(
-		 &error );
-	}
-#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_SHA_H ) && defined( SHA_DIGEST_LENGTH )
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-#if defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __clang__ ) && !defined( __CYGWIN__ )
+	libcerror_error_free(
+	 &error );
 
-	/* Test libhmac_sha1_context_update with SHA1_Update failing
-	 */
-	hmac_test_SHA1_Update_attempts_before_fail = 0;
+	result = libhmac_sha1_context_initialize_in_place(
+	          &context,
+	          aligned_memory,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
 
-	result = libhmac_sha1_context_update(
-	          context,
-	          data,
-	          208,
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "context",
+	 context );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha1_context_initialize_in_place(
+	          &context,
+	          aligned_memory,
+	          context_size - 1,
 	          &error );
 
-	if( hmac_test_SHA1_Update_attempts_before_fail != -1 )
-	{
-		hmac_test_SHA1_Update_attempts_before_fail = -1;
-	}
-	else
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "context",
+	 context );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( context_alignment > 1 )
 	{
+		result = libhmac_sha1_context_initialize_in_place(
+		          &context,
+		          &( aligned_memory[ 1 ] ),
+		          context_size,
+		          &error );
+
 		HMAC_TEST_ASSERT_EQUAL_INT(
 		 "result",
 		 result,
 		 -1 );
 
+		HMAC_TEST_ASSERT_IS_NULL(
+		 "context",
+		 context );
+
 		HMAC_TEST_ASSERT_IS_NOT_NULL(
 		 "error",
 		 error );
@@ -818,103 +1010,259 @@ int hmac_test_sha1_context_update(
 		libcerror_error_free(
 		 &error );
 	}
-#endif /* defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __clang__ ) && !defined( __CYGWIN__ ) */
-
-#elif defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_SHA1 )
-
-#if defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __clang__ ) && !defined( __CYGWIN__ )
-
-	/* Test libhmac_sha1_context_update with EVP_DigestUpdate failing
-	 */
-	hmac_test_EVP_DigestUpdate_attempts_before_fail = 0;
+	return( 1 );
 
-	result = libhmac_sha1_context_update(
-	          context,
-	          data,
-	          208,
-	          &error );
-
-	if( hmac_test_EVP_DigestUpdate_attempts_before_fail != -1 )
+on_error:
+	if( error != NULL )
 	{
-		hmac_test_EVP_DigestUpdate_attempts_before_fail = -1;
+		libcerror_error_free(
+		 &error );
 	}
-	else
+	if( context != NULL )
 	{
-		HMAC_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+		libhmac_sha1_context_free_in_place(
+		 &context,
+		 NULL );
+	}
+	return( 0 );
+}
 
-		HMAC_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+/* Tests the libhmac_sha1_context_free_in_place function
+ * Returns 1 if successful or 0 if not
+ */
+int hmac_test_sha1_context_free_in_place(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libhmac_sha1_context_free_in_place(
+	          NULL,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
 
+on_error:
+	if( error != NULL )
+	{
 		libcerror_error_free(
 		 &error );
 	}
-#endif /* defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __clang__ ) && !defined( __CYGWIN__ ) */
+	return( 0 );
+}
 
-#else
-#if defined( HAVE_CAES_TEST_MEMORY ) && defined( OPTIMIZATION_DISABLED )
+/* Tests the libhmac_sha1_context_reset function
+ * Returns 1 if successful or 0 if not
+ */
+int hmac_test_sha1_context_reset(
+     void )
+{
+	uint8_t expected_hash[ LIBHMAC_SHA1_HASH_SIZE ];
+	uint8_t hash[ LIBHMAC_SHA1_HASH_SIZE ];
+	uint8_t test_data[ 200 ];
 
-	/* Test libhmac_sha1_context_update with memcpy failing
+	libcerror_error_t *error        = NULL;
+	libhmac_sha1_context_t *context = NULL;
+	size_t data_offset              = 0;
+	int result                      = 0;
+
+	for( data_offset = 0;
+	     data_offset < 200;
+	     data_offset++ )
+	{
+		test_data[ data_offset ] = (uint8_t) data_offset;
+	}
+	result = libhmac_sha1_calculate(
+	          test_data,
+	          200,
+	          expected_hash,
+	          LIBHMAC_SHA1_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
 	 */
-	hmac_test_memcpy_attempts_before_fail = 0;
+	result = libhmac_sha1_context_initialize(
+	          &context,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "context",
+	 context );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
+	/* Test regular cases
+	 */
 	result = libhmac_sha1_context_update(
 	          context,
-	          data,
-	          208,
+	          test_data,
+	          150,
 	          &error );
 
-	if( hmac_test_memcpy_attempts_before_fail != -1 )
-	{
-		hmac_test_memcpy_attempts_before_fail = -1;
-	}
-	else
-	{
-		CAES_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		CAES_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-	/* Test libhmac_sha1_context_update with memcpy failing
+	result = libhmac_sha1_context_reset(
+	          context,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhmac_sha1_context_update(
+	          context,
+	          test_data,
+	          200,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhmac_sha1_context_finalize(
+	          context,
+	          hash,
+	          LIBHMAC_SHA1_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hash,
+	          expected_hash,
+	          LIBHMAC_SHA1_HASH_SIZE );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test reset after finalize
 	 */
-	hmac_test_memcpy_attempts_before_fail = 1;
+	result = libhmac_sha1_context_reset(
+	          context,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	result = libhmac_sha1_context_update(
 	          context,
-	          data,
-	          208,
+	          test_data,
+	          200,
 	          &error );
 
-	if( hmac_test_memcpy_attempts_before_fail != -1 )
-	{
-		hmac_test_memcpy_attempts_before_fail = -1;
-	}
-	else
-	{
-		CAES_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		CAES_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( HAVE_CAES_TEST_MEMORY ) && defined( OPTIMIZATION_DISABLED ) */
-#endif /* defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_SHA_H ) && defined( SHA_DIGEST_LENGTH ) */
+	result = libhmac_sha1_context_finalize(
+	          context,
+	          hash,
+	          LIBHMAC_SHA1_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hash,
+	          expected_hash,
+	          LIBHMAC_SHA1_HASH_SIZE );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libhmac_sha1_context_reset(
+	          NULL,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
 
 	/* Clean up
 	 */
@@ -952,69 +1300,1846 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libhmac_sha1_context_finalize function
+/* Tests the libhmac_sha1_context_clone function
  * Returns 1 if successful or 0 if not
  */
-int hmac_test_sha1_context_finalize(
+int hmac_test_sha1_context_clone(
      void )
 {
+	uint8_t expected_hash1[ LIBHMAC_SHA1_HASH_SIZE ];
+	uint8_t expected_hash2[ LIBHMAC_SHA1_HASH_SIZE ];
 	uint8_t hash[ LIBHMAC_SHA1_HASH_SIZE ];
+	uint8_t test_data[ 256 ];
 
-	libcerror_error_t *error        = NULL;
-	libhmac_sha1_context_t *context = NULL;
-	size_t maximum_size             = 0;
-	int result                      = 0;
+	libcerror_error_t *error                    = NULL;
+	libhmac_sha1_context_t *destination_context = NULL;
+	libhmac_sha1_context_t *source_context      = NULL;
+	size_t data_offset                          = 0;
+	int result                                  = 0;
 
-#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_SHA_H ) && defined( SHA_DIGEST_LENGTH )
+	for( data_offset = 0;
+	     data_offset < 256;
+	     data_offset++ )
+	{
+		test_data[ data_offset ] = (uint8_t) data_offset;
+	}
+	result = libhmac_sha1_calculate(
+	          test_data,
+	          200,
+	          expected_hash1,
+	          LIBHMAC_SHA1_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhmac_sha1_calculate(
+	          test_data,
+	          256,
+	          expected_hash2,
+	          LIBHMAC_SHA1_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
+	 */
+	result = libhmac_sha1_context_initialize(
+	          &source_context,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "source_context",
+	 source_context );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhmac_sha1_context_update(
+	          source_context,
+	          &( test_data[ 0 ] ),
+	          150,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libhmac_sha1_context_clone(
+	          &destination_context,
+	          source_context,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "destination_context",
+	 destination_context );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhmac_sha1_context_update(
+	          destination_context,
+	          &( test_data[ 150 ] ),
+	          50,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhmac_sha1_context_finalize(
+	          destination_context,
+	          hash,
+	          LIBHMAC_SHA1_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hash,
+	          expected_hash1,
+	          LIBHMAC_SHA1_HASH_SIZE );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libhmac_sha1_context_update(
+	          source_context,
+	          &( test_data[ 150 ] ),
+	          106,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhmac_sha1_context_finalize(
+	          source_context,
+	          hash,
+	          LIBHMAC_SHA1_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hash,
+	          expected_hash2,
+	          LIBHMAC_SHA1_HASH_SIZE );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libhmac_sha1_context_free(
+	          &destination_context,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "destination_context",
+	 destination_context );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhmac_sha1_context_clone(
+	          &destination_context,
+	          NULL,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "destination_context",
+	 destination_context );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhmac_sha1_context_clone(
+	          NULL,
+	          source_context,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	destination_context = (libhmac_sha1_context_t *) 0x12345678UL;
+
+	result = libhmac_sha1_context_clone(
+	          &destination_context,
+	          source_context,
+	          &error );
+
+	destination_context = NULL;
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libhmac_sha1_context_free(
+	          &source_context,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "source_context",
+	 source_context );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( destination_context != NULL )
+	{
+		libhmac_sha1_context_free(
+		 &destination_context,
+		 NULL );
+	}
+	if( source_context != NULL )
+	{
+		libhmac_sha1_context_free(
+		 &source_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libhmac_sha1_context_update function
+ * Returns 1 if successful or 0 if not
+ */
+int hmac_test_sha1_context_update(
+     void )
+{
+	uint8_t data[ 208 ];
+
+	libcerror_error_t *error        = NULL;
+	libhmac_sha1_context_t *context = NULL;
+	size_t maximum_size             = 0;
+	int result                      = 0;
+
+#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_SHA_H ) && defined( SHA_DIGEST_LENGTH )
+#if ( SIZEOF_LONG < SIZEOF_SIZE_T )
+	maximum_size = (size_t) ULONG_MAX;
+#else
 	maximum_size = (size_t) SSIZE_MAX;
+#endif
 #elif defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_SHA1 )
-	maximum_size = (size_t) UINT_MAX;
+	maximum_size = (size_t) SSIZE_MAX;
 #else
 	maximum_size = (size_t) SSIZE_MAX;
 #endif
 
-	/* Initialize test
+	/* Initialize test
+	 */
+	result = libhmac_sha1_context_initialize(
+	          &context,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "context",
+	 context );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libhmac_sha1_context_update(
+	          context,
+	          data,
+	          208,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhmac_sha1_context_update(
+	          context,
+	          data,
+	          0,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhmac_sha1_context_update(
+	          NULL,
+	          data,
+	          208,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha1_context_update(
+	          context,
+	          NULL,
+	          208,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( maximum_size > 0 )
+	{
+		result = libhmac_sha1_context_update(
+		          context,
+		          data,
+		          maximum_size + 1,
+		          &error );
+
+		HMAC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		HMAC_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_SHA_H ) && defined( SHA_DIGEST_LENGTH )
+
+#if defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __clang__ ) && !defined( __CYGWIN__ )
+
+	/* Test libhmac_sha1_context_update with SHA1_Update failing
+	 */
+	hmac_test_SHA1_Update_attempts_before_fail = 0;
+
+	result = libhmac_sha1_context_update(
+	          context,
+	          data,
+	          208,
+	          &error );
+
+	if( hmac_test_SHA1_Update_attempts_before_fail != -1 )
+	{
+		hmac_test_SHA1_Update_attempts_before_fail = -1;
+	}
+	else
+	{
+		HMAC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		HMAC_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __clang__ ) && !defined( __CYGWIN__ ) */
+
+#elif defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_SHA1 )
+
+#if defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __clang__ ) && !defined( __CYGWIN__ )
+
+	/* Test libhmac_sha1_context_update with EVP_DigestUpdate failing
+	 */
+	hmac_test_EVP_DigestUpdate_attempts_before_fail = 0;
+
+	result = libhmac_sha1_context_update(
+	          context,
+	          data,
+	          208,
+	          &error );
+
+	if( hmac_test_EVP_DigestUpdate_attempts_before_fail != -1 )
+	{
+		hmac_test_EVP_DigestUpdate_attempts_before_fail = -1;
+	}
+	else
+	{
+		HMAC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		HMAC_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __clang__ ) && !defined( __CYGWIN__ ) */
+
+#else
+#if defined( HAVE_CAES_TEST_MEMORY ) && defined( OPTIMIZATION_DISABLED )
+
+	/* Test libhmac_sha1_context_update with memcpy failing
+	 */
+	hmac_test_memcpy_attempts_before_fail = 0;
+
+	result = libhmac_sha1_context_update(
+	          context,
+	          data,
+	          208,
+	          &error );
+
+	if( hmac_test_memcpy_attempts_before_fail != -1 )
+	{
+		hmac_test_memcpy_attempts_before_fail = -1;
+	}
+	else
+	{
+		CAES_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CAES_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libhmac_sha1_context_update with memcpy failing
+	 */
+	hmac_test_memcpy_attempts_before_fail = 1;
+
+	result = libhmac_sha1_context_update(
+	          context,
+	          data,
+	          208,
+	          &error );
+
+	if( hmac_test_memcpy_attempts_before_fail != -1 )
+	{
+		hmac_test_memcpy_attempts_before_fail = -1;
+	}
+	else
+	{
+		CAES_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CAES_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_CAES_TEST_MEMORY ) && defined( OPTIMIZATION_DISABLED ) */
+#endif /* defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_SHA_H ) && defined( SHA_DIGEST_LENGTH ) */
+
+	/* Clean up
+	 */
+	result = libhmac_sha1_context_free(
+	          &context,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "context",
+	 context );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( context != NULL )
+	{
+		libhmac_sha1_context_free(
+		 &context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libhmac_sha1_context_update_iov function
+ * Returns 1 if successful or 0 if not
+ */
+int hmac_test_sha1_context_update_iov(
+     void )
+{
+	uint8_t expected_hash[ LIBHMAC_SHA1_HASH_SIZE ];
+	uint8_t hash[ LIBHMAC_SHA1_HASH_SIZE ];
+	uint8_t test_data[ 1000 ];
+	const uint8_t *buffers[ 3 ];
+	size_t sizes[ 3 ];
+
+	/* Fragment sizes that test fragments smaller than, equal to and larger
+	 * than a block, empty fragments and fragments that cross block boundaries
+	 */
+	size_t fragment_sizes[ 6 ][ 3 ] = {
+		{ 5, 200, 795 }, { 64, 64, 872 }, { 0, 1, 999 }, { 63, 2, 935 }, { 1000, 0, 0 }, { 1, 1, 998 } };
+
+	libcerror_error_t *error        = NULL;
+	libhmac_sha1_context_t *context = NULL;
+	size_t data_index               = 0;
+	size_t data_offset              = 0;
+	int fragment_index              = 0;
+	int fragment_sizes_index        = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	for( data_index = 0;
+	     data_index < 1000;
+	     data_index++ )
+	{
+		test_data[ data_index ] = (uint8_t) ( ( data_index * 7 ) + 3 );
+	}
+	result = libhmac_sha1_calculate(
+	          test_data,
+	          1000,
+	          expected_hash,
+	          LIBHMAC_SHA1_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhmac_sha1_context_initialize(
+	          &context,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "context",
+	 context );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( fragment_sizes_index = 0;
+	     fragment_sizes_index < 6;
+	     fragment_sizes_index++ )
+	{
+		data_offset = 0;
+
+		for( fragment_index = 0;
+		     fragment_index < 3;
+		     fragment_index++ )
+		{
+			buffers[ fragment_index ] = &( test_data[ data_offset ] );
+			sizes[ fragment_index ]   = fragment_sizes[ fragment_sizes_index ][ fragment_index ];
+
+			data_offset += sizes[ fragment_index ];
+		}
+		result = libhmac_sha1_context_reset(
+		          context,
+		          &error );
+
+		HMAC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HMAC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libhmac_sha1_context_update_iov(
+		          context,
+		          buffers,
+		          sizes,
+		          3,
+		          &error );
+
+		HMAC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HMAC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libhmac_sha1_context_finalize(
+		          context,
+		          hash,
+		          LIBHMAC_SHA1_HASH_SIZE,
+		          &error );
+
+		HMAC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HMAC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          hash,
+		          expected_hash,
+		          LIBHMAC_SHA1_HASH_SIZE );
+
+		HMAC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test with data remaining in the context from a previous update
+	 */
+	result = libhmac_sha1_context_reset(
+	          context,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhmac_sha1_context_update(
+	          context,
+	          test_data,
+	          7,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	buffers[ 0 ] = &( test_data[ 7 ] );
+	sizes[ 0 ]   = 57;
+	buffers[ 1 ] = &( test_data[ 64 ] );
+	sizes[ 1 ]   = 300;
+	buffers[ 2 ] = &( test_data[ 364 ] );
+	sizes[ 2 ]   = 636;
+
+	result = libhmac_sha1_context_update_iov(
+	          context,
+	          buffers,
+	          sizes,
+	          3,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhmac_sha1_context_finalize(
+	          context,
+	          hash,
+	          LIBHMAC_SHA1_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hash,
+	          expected_hash,
+	          LIBHMAC_SHA1_HASH_SIZE );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libhmac_sha1_context_update_iov(
+	          NULL,
+	          buffers,
+	          sizes,
+	          3,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha1_context_update_iov(
+	          context,
+	          NULL,
+	          sizes,
+	          3,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha1_context_update_iov(
+	          context,
+	          buffers,
+	          NULL,
+	          3,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha1_context_update_iov(
+	          context,
+	          buffers,
+	          sizes,
+	          -1,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	buffers[ 1 ] = NULL;
+
+	result = libhmac_sha1_context_update_iov(
+	          context,
+	          buffers,
+	          sizes,
+	          3,
+	          &error );
+
+	buffers[ 1 ] = &( test_data[ 64 ] );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	sizes[ 1 ] = (size_t) SSIZE_MAX + 1;
+
+	result = libhmac_sha1_context_update_iov(
+	          context,
+	          buffers,
+	          sizes,
+	          3,
+	          &error );
+
+	sizes[ 1 ] = 300;
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libhmac_sha1_context_free(
+	          &context,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "context",
+	 context );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( context != NULL )
+	{
+		libhmac_sha1_context_free(
+		 &context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libhmac_sha1_context_finalize function
+ * Returns 1 if successful or 0 if not
+ */
+int hmac_test_sha1_context_finalize(
+     void )
+{
+	uint8_t hash[ LIBHMAC_SHA1_HASH_SIZE ];
+
+	libcerror_error_t *error        = NULL;
+	libhmac_sha1_context_t *context = NULL;
+	size_t maximum_size             = 0;
+	int result                      = 0;
+
+#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_SHA_H ) && defined( SHA_DIGEST_LENGTH )
+	maximum_size = (size_t) SSIZE_MAX;
+#elif defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_SHA1 )
+	maximum_size = (size_t) UINT_MAX;
+#else
+	maximum_size = (size_t) SSIZE_MAX;
+#endif
+
+	/* Initialize test
+	 */
+	result = libhmac_sha1_context_initialize(
+	          &context,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "context",
+	 context );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libhmac_sha1_context_finalize(
+	          context,
+	          hash,
+	          LIBHMAC_SHA1_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhmac_sha1_context_finalize(
+	          NULL,
+	          hash,
+	          LIBHMAC_SHA1_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha1_context_finalize(
+	          context,
+	          NULL,
+	          LIBHMAC_SHA1_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( maximum_size > 0 )
+	{
+		result = libhmac_sha1_context_finalize(
+		          context,
+		          hash,
+		          maximum_size + 1,
+		          &error );
+
+		HMAC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		HMAC_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	result = libhmac_sha1_context_finalize(
+	          context,
+	          hash,
+	          0,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_SHA_H ) && defined( SHA_DIGEST_LENGTH )
+
+#if defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __clang__ ) && !defined( __CYGWIN__ )
+
+	/* Test libhmac_sha1_context_finalize with SHA1_Final failing
+	 */
+	hmac_test_SHA1_Final_attempts_before_fail = 0;
+
+	result = libhmac_sha1_context_finalize(
+	          context,
+	          hash,
+	          LIBHMAC_SHA1_HASH_SIZE,
+	          &error );
+
+	if( hmac_test_SHA1_Final_attempts_before_fail != -1 )
+	{
+		hmac_test_SHA1_Final_attempts_before_fail = -1;
+	}
+	else
+	{
+		HMAC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		HMAC_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __clang__ ) && !defined( __CYGWIN__ ) */
+
+#elif defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_SHA1 )
+
+#if defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __clang__ ) && !defined( __CYGWIN__ )
+
+	/* Test libhmac_sha1_context_finalize with EVP_DigestFinal_ex failing
+	 */
+	hmac_test_EVP_DigestFinal_ex_attempts_before_fail = 0;
+
+	result = libhmac_sha1_context_finalize(
+	          context,
+	          hash,
+	          LIBHMAC_SHA1_HASH_SIZE,
+	          &error );
+
+	if( hmac_test_EVP_DigestFinal_ex_attempts_before_fail != -1 )
+	{
+		hmac_test_EVP_DigestFinal_ex_attempts_before_fail = -1;
+	}
+	else
+	{
+		HMAC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		HMAC_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __clang__ ) && !defined( __CYGWIN__ ) */
+
+#else
+#if defined( HAVE_HMAC_TEST_MEMORY )
+#if defined( OPTIMIZATION_DISABLED )
+
+	/* Test libhmac_sha1_context_finalize with memset of internal_context->block failing
+	 */
+	hmac_test_memset_attempts_before_fail = 0;
+
+	result = libhmac_sha1_context_finalize(
+	          context,
+	          hash,
+	          LIBHMAC_SHA1_HASH_SIZE,
+	          &error );
+
+	if( hmac_test_memset_attempts_before_fail != -1 )
+	{
+		hmac_test_memset_attempts_before_fail = -1;
+	}
+	else
+	{
+		HMAC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		HMAC_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( OPTIMIZATION_DISABLED ) */
+
+	/* Test libhmac_sha1_context_finalize with memset of internal_context failing
+	 */
+	hmac_test_memset_attempts_before_fail = 1;
+
+	result = libhmac_sha1_context_finalize(
+	          context,
+	          hash,
+	          LIBHMAC_SHA1_HASH_SIZE,
+	          &error );
+
+	if( hmac_test_memset_attempts_before_fail != -1 )
+	{
+		hmac_test_memset_attempts_before_fail = -1;
+	}
+	else
+	{
+		HMAC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		HMAC_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_HMAC_TEST_MEMORY ) */
+#endif /* defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_SHA_H ) && defined( SHA_DIGEST_LENGTH ) */
+
+	/* Clean up
+	 */
+	result = libhmac_sha1_context_free(
+	          &context,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "context",
+	 context );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( context != NULL )
+	{
+		libhmac_sha1_context_free(
+		 &context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if !defined( LIBHMAC_HAVE_SHA1_SUPPORT )
+
+#if defined( __GNUC__ ) && !defined( LIBHMAC_DLL_IMPORT )
+
+/* Tests the libhmac_sha1_context_get_transform_function function
+ * and the transform function of every available kernel
+ * Returns 1 if successful or 0 if not
+ */
+int hmac_test_sha1_context_get_transform_function(
+     void )
+{
+	uint8_t test_data[ 128 ] = {
+		0x61, 0x62, 0x63, 0x64, 0x62, 0x63, 0x64, 0x65, 0x63, 0x64, 0x65, 0x66, 0x64, 0x65, 0x66, 0x67,
+		0x65, 0x66, 0x67, 0x68, 0x66, 0x67, 0x68, 0x69, 0x67, 0x68, 0x69, 0x6a, 0x68, 0x69, 0x6a, 0x6b,
+		0x69, 0x6a, 0x6b, 0x6c, 0x6a, 0x6b, 0x6c, 0x6d, 0x6b, 0x6c, 0x6d, 0x6e, 0x6c, 0x6d, 0x6e, 0x6f,
+		0x6d, 0x6e, 0x6f, 0x70, 0x6e, 0x6f, 0x70, 0x71, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc0 };
+
+	uint32_t expected_hash_values[ 5 ] = {
+		0x84983e44UL, 0x1c3bd26eUL, 0xbaae4aa1UL, 0xf95129e5UL,
+		0xe54670f1UL };
+
+	uint32_t initial_hash_values[ 5 ] = {
+		0x67452301UL, 0xefcdab89UL, 0x98badcfeUL, 0x10325476UL,
+		0xc3d2e1f0UL };
+
+	uint32_t hash_values[ 5 ];
+
+	libcerror_error_t *error                                     = NULL;
+	libhmac_kernel_transform_32bit_function_t transform_function = NULL;
+	int kernel_type                                              = 0;
+	int result                                                   = 0;
+
+	/* Test regular cases
+	 */
+	for( kernel_type = LIBHMAC_KERNEL_TYPE_PORTABLE;
+	     kernel_type <= LIBHMAC_KERNEL_TYPE_SHA_NI;
+	     kernel_type++ )
+	{
+		result = libhmac_sha1_context_get_transform_function(
+		          kernel_type,
+		          &transform_function,
+		          &error );
+
+		HMAC_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		HMAC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( kernel_type == LIBHMAC_KERNEL_TYPE_PORTABLE )
+		{
+			HMAC_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+		}
+		if( result == 0 )
+		{
+			continue;
+		}
+		memory_copy(
+		 hash_values,
+		 initial_hash_values,
+		 sizeof( uint32_t ) * 5 );
+
+		result = transform_function(
+		          hash_values,
+		          test_data,
+		          2 );
+
+		HMAC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = memory_compare(
+		          hash_values,
+		          expected_hash_values,
+		          sizeof( uint32_t ) * 5 );
+
+		HMAC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test error cases
+	 */
+	result = libhmac_sha1_context_get_transform_function(
+	          LIBHMAC_KERNEL_TYPE_PORTABLE,
+	          NULL,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBHMAC_DLL_IMPORT ) */
+
+/* Tests the libhmac_sha1_context_export_state function
+ * Returns 1 if successful or 0 if not
+ */
+int hmac_test_sha1_context_export_state(
+     void )
+{
+	uint8_t state[ LIBHMAC_SHA1_CONTEXT_STATE_SIZE ];
+	uint8_t test_data[ 100 ];
+
+	libcerror_error_t *error        = NULL;
+	libhmac_sha1_context_t *context = NULL;
+	size_t data_index               = 0;
+	uint16_t block_offset           = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	for( data_index = 0;
+	     data_index < 100;
+	     data_index++ )
+	{
+		test_data[ data_index ] = (uint8_t) data_index;
+	}
+	result = libhmac_sha1_context_initialize(
+	          &context,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "context",
+	 context );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhmac_sha1_context_update(
+	          context,
+	          test_data,
+	          100,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libhmac_sha1_context_export_state(
+	          context,
+	          state,
+	          LIBHMAC_SHA1_CONTEXT_STATE_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          state,
+	          "hmcs",
+	          4 );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	HMAC_TEST_ASSERT_EQUAL_UINT8(
+	 "state[ 4 ]",
+	 state[ 4 ],
+	 (uint8_t) 1 );
+
+	HMAC_TEST_ASSERT_EQUAL_UINT8(
+	 "state[ 5 ]",
+	 state[ 5 ],
+	 (uint8_t) LIBHMAC_HASH_ALGORITHM_SHA1 );
+
+	byte_stream_copy_to_uint16_big_endian(
+	 &( state[ 6 ] ),
+	 block_offset );
+
+	HMAC_TEST_ASSERT_EQUAL_UINT16(
+	 "block_offset",
+	 block_offset,
+	 (uint16_t) ( 100 % LIBHMAC_SHA1_BLOCK_SIZE ) );
+
+	/* Test error cases
+	 */
+	result = libhmac_sha1_context_export_state(
+	          NULL,
+	          state,
+	          LIBHMAC_SHA1_CONTEXT_STATE_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha1_context_export_state(
+	          context,
+	          NULL,
+	          LIBHMAC_SHA1_CONTEXT_STATE_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha1_context_export_state(
+	          context,
+	          state,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha1_context_export_state(
+	          context,
+	          state,
+	          LIBHMAC_SHA1_CONTEXT_STATE_SIZE - 1,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libhmac_sha1_context_free(
+	          &context,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "context",
+	 context );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( context != NULL )
+	{
+		libhmac_sha1_context_free(
+		 &context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libhmac_sha1_context_import_state function
+ * Returns 1 if successful or 0 if not
+ */
+int hmac_test_sha1_context_import_state(
+     void )
+{
+	uint8_t expected_hash[ LIBHMAC_SHA1_HASH_SIZE ];
+	uint8_t hash[ LIBHMAC_SHA1_HASH_SIZE ];
+	uint8_t state[ LIBHMAC_SHA1_CONTEXT_STATE_SIZE ];
+	uint8_t test_data[ 1000 ];
+
+	/* Sizes of the data hashed before the state is exported
+	 */
+	size_t split_sizes[ 6 ] = { 0, 1, 63, 64, 700, 1000 };
+
+	libcerror_error_t *error                    = NULL;
+	libhmac_sha1_context_t *destination_context = NULL;
+	libhmac_sha1_context_t *source_context      = NULL;
+	size_t data_index                           = 0;
+	size_t split_size                           = 0;
+	int result                                  = 0;
+	int split_sizes_index                       = 0;
+
+	/* Initialize test
+	 */
+	for( data_index = 0;
+	     data_index < 1000;
+	     data_index++ )
+	{
+		test_data[ data_index ] = (uint8_t) ( ( data_index * 11 ) + 5 );
+	}
+	result = libhmac_sha1_calculate(
+	          test_data,
+	          1000,
+	          expected_hash,
+	          LIBHMAC_SHA1_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhmac_sha1_context_initialize(
+	          &source_context,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhmac_sha1_context_initialize(
+	          &destination_context,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( split_sizes_index = 0;
+	     split_sizes_index < 6;
+	     split_sizes_index++ )
+	{
+		split_size = split_sizes[ split_sizes_index ];
+
+		result = libhmac_sha1_context_reset(
+		          source_context,
+		          &error );
+
+		HMAC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HMAC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libhmac_sha1_context_update(
+		          source_context,
+		          test_data,
+		          split_size,
+		          &error );
+
+		HMAC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HMAC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libhmac_sha1_context_export_state(
+		          source_context,
+		          state,
+		          LIBHMAC_SHA1_CONTEXT_STATE_SIZE,
+		          &error );
+
+		HMAC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HMAC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libhmac_sha1_context_import_state(
+		          destination_context,
+		          state,
+		          LIBHMAC_SHA1_CONTEXT_STATE_SIZE,
+		          &error );
+
+		HMAC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HMAC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libhmac_sha1_context_update(
+		          destination_context,
+		          &( test_data[ split_size ] ),
+		          1000 - split_size,
+		          &error );
+
+		HMAC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HMAC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libhmac_sha1_context_finalize(
+		          destination_context,
+		          hash,
+		          LIBHMAC_SHA1_HASH_SIZE,
+		          &error );
+
+		HMAC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HMAC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          hash,
+		          expected_hash,
+		          LIBHMAC_SHA1_HASH_SIZE );
+
+		HMAC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test error cases
 	 */
-	result = libhmac_sha1_context_initialize(
-	          &context,
+	result = libhmac_sha1_context_import_state(
+	          NULL,
+	          state,
+	          LIBHMAC_SHA1_CONTEXT_STATE_SIZE,
 	          &error );
 
 	HMAC_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	HMAC_TEST_ASSERT_IS_NOT_NULL(
-	 "context",
-	 context );
-
-	HMAC_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
-	result = libhmac_sha1_context_finalize(
-	          context,
-	          hash,
-	          LIBHMAC_SHA1_HASH_SIZE,
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha1_context_import_state(
+	          destination_context,
+	          NULL,
+	          LIBHMAC_SHA1_CONTEXT_STATE_SIZE,
 	          &error );
 
 	HMAC_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	HMAC_TEST_ASSERT_IS_NULL(
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libhmac_sha1_context_finalize(
-	          NULL,
-	          hash,
-	          LIBHMAC_SHA1_HASH_SIZE,
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha1_context_import_state(
+	          destination_context,
+	          state,
+	          (size_t) SSIZE_MAX + 1,
 	          &error );
 
 	HMAC_TEST_ASSERT_EQUAL_INT(
@@ -1029,10 +3154,10 @@ int hmac_test_sha1_context_finalize(
 	libcerror_error_free(
 	 &error );
 
-	result = libhmac_sha1_context_finalize(
-	          context,
-	          NULL,
-	          LIBHMAC_SHA1_HASH_SIZE,
+	result = libhmac_sha1_context_import_state(
+	          destination_context,
+	          state,
+	          LIBHMAC_SHA1_CONTEXT_STATE_SIZE - 1,
 	          &error );
 
 	HMAC_TEST_ASSERT_EQUAL_INT(
@@ -1047,32 +3172,18 @@ int hmac_test_sha1_context_finalize(
 	libcerror_error_free(
 	 &error );
 
-	if( maximum_size > 0 )
-	{
-		result = libhmac_sha1_context_finalize(
-		          context,
-		          hash,
-		          maximum_size + 1,
-		          &error );
-
-		HMAC_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		HMAC_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	/* Test import with an invalid signature
+	 */
+	state[ 0 ] ^= 0xff;
 
-		libcerror_error_free(
-		 &error );
-	}
-	result = libhmac_sha1_context_finalize(
-	          context,
-	          hash,
-	          0,
+	result = libhmac_sha1_context_import_state(
+	          destination_context,
+	          state,
+	          LIBHMAC_SHA1_CONTEXT_STATE_SIZE,
 	          &error );
 
+	state[ 0 ] ^= 0xff;
+
 	HMAC_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
@@ -1085,143 +3196,106 @@ int hmac_test_sha1_context_finalize(
 	libcerror_error_free(
 	 &error );
 
-#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_SHA_H ) && defined( SHA_DIGEST_LENGTH )
-
-#if defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __clang__ ) && !defined( __CYGWIN__ )
-
-	/* Test libhmac_sha1_context_finalize with SHA1_Final failing
+	/* Test import with an unsupported format version
 	 */
-	hmac_test_SHA1_Final_attempts_before_fail = 0;
+	state[ 4 ] += 1;
 
-	result = libhmac_sha1_context_finalize(
-	          context,
-	          hash,
-	          LIBHMAC_SHA1_HASH_SIZE,
+	result = libhmac_sha1_context_import_state(
+	          destination_context,
+	          state,
+	          LIBHMAC_SHA1_CONTEXT_STATE_SIZE,
 	          &error );
 
-	if( hmac_test_SHA1_Final_attempts_before_fail != -1 )
-	{
-		hmac_test_SHA1_Final_attempts_before_fail = -1;
-	}
-	else
-	{
-		HMAC_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		HMAC_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	state[ 4 ] -= 1;
 
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __clang__ ) && !defined( __CYGWIN__ ) */
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-#elif defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_SHA1 )
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-#if defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __clang__ ) && !defined( __CYGWIN__ )
+	libcerror_error_free(
+	 &error );
 
-	/* Test libhmac_sha1_context_finalize with EVP_DigestFinal_ex failing
+	/* Test import with the state of another hash algorithm
 	 */
-	hmac_test_EVP_DigestFinal_ex_attempts_before_fail = 0;
+	state[ 5 ] ^= 0x80;
 
-	result = libhmac_sha1_context_finalize(
-	          context,
-	          hash,
-	          LIBHMAC_SHA1_HASH_SIZE,
+	result = libhmac_sha1_context_import_state(
+	          destination_context,
+	          state,
+	          LIBHMAC_SHA1_CONTEXT_STATE_SIZE,
 	          &error );
 
-	if( hmac_test_EVP_DigestFinal_ex_attempts_before_fail != -1 )
-	{
-		hmac_test_EVP_DigestFinal_ex_attempts_before_fail = -1;
-	}
-	else
-	{
-		HMAC_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	state[ 5 ] ^= 0x80;
 
-		HMAC_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __clang__ ) && !defined( __CYGWIN__ ) */
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-#else
-#if defined( HAVE_HMAC_TEST_MEMORY )
-#if defined( OPTIMIZATION_DISABLED )
+	libcerror_error_free(
+	 &error );
 
-	/* Test libhmac_sha1_context_finalize with memset of internal_context->block failing
+	/* Test import with a block offset value out of bounds
 	 */
-	hmac_test_memset_attempts_before_fail = 0;
+	state[ 6 ] ^= 0x80;
 
-	result = libhmac_sha1_context_finalize(
-	          context,
-	          hash,
-	          LIBHMAC_SHA1_HASH_SIZE,
+	result = libhmac_sha1_context_import_state(
+	          destination_context,
+	          state,
+	          LIBHMAC_SHA1_CONTEXT_STATE_SIZE,
 	          &error );
 
-	if( hmac_test_memset_attempts_before_fail != -1 )
-	{
-		hmac_test_memset_attempts_before_fail = -1;
-	}
-	else
-	{
-		HMAC_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	state[ 6 ] ^= 0x80;
 
-		HMAC_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( OPTIMIZATION_DISABLED ) */
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-	/* Test libhmac_sha1_context_finalize with memset of internal_context failing
+	libcerror_error_free(
+	 &error );
+
+	/* Test import with a number of bytes hashed that is not a multiple of the block size
 	 */
-	hmac_test_memset_attempts_before_fail = 1;
+	state[ 15 ] ^= 0x01;
 
-	result = libhmac_sha1_context_finalize(
-	          context,
-	          hash,
-	          LIBHMAC_SHA1_HASH_SIZE,
+	result = libhmac_sha1_context_import_state(
+	          destination_context,
+	          state,
+	          LIBHMAC_SHA1_CONTEXT_STATE_SIZE,
 	          &error );
 
-	if( hmac_test_memset_attempts_before_fail != -1 )
-	{
-		hmac_test_memset_attempts_before_fail = -1;
-	}
-	else
-	{
-		HMAC_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	state[ 15 ] ^= 0x01;
 
-		HMAC_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( HAVE_HMAC_TEST_MEMORY ) */
-#endif /* defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_SHA_H ) && defined( SHA_DIGEST_LENGTH ) */
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
 
 	/* Clean up
 	 */
 	result = libhmac_sha1_context_free(
-	          &context,
+	          &destination_context,
 	          &error );
 
 	HMAC_TEST_ASSERT_EQUAL_INT(
@@ -1230,8 +3304,17 @@ int hmac_test_sha1_context_finalize(
 	 1 );
 
 	HMAC_TEST_ASSERT_IS_NULL(
-	 "context",
-	 context );
+	 "error",
+	 error );
+
+	result = libhmac_sha1_context_free(
+	          &source_context,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	HMAC_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -1245,15 +3328,23 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( context != NULL )
+	if( destination_context != NULL )
 	{
 		libhmac_sha1_context_free(
-		 &context,
+		 &destination_context,
+		 NULL );
+	}
+	if( source_context != NULL )
+	{
+		libhmac_sha1_context_free(
+		 &source_context,
 		 NULL );
 	}
 	return( 0 );
 }
 
+#endif /* !defined( LIBHMAC_HAVE_SHA1_SUPPORT ) */
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -1269,11 +3360,13 @@ int main(
 	HMAC_TEST_UNREFERENCED_PARAMETER( argc )
 	HMAC_TEST_UNREFERENCED_PARAMETER( argv )
 
-#if !defined( LIBHMAC_HAVE_SHA1_SUPPORT )
+#if defined( __GNUC__ ) && !defined( LIBHMAC_DLL_IMPORT ) && !defined( LIBHMAC_HAVE_SHA1_SUPPORT )
 
-	/* TODO add tests for libhmac_sha1_context_transform */
+	HMAC_TEST_RUN(
+	 "libhmac_sha1_context_get_transform_function",
+	 hmac_test_sha1_context_get_transform_function );
 
-#endif /* !defined( LIBHMAC_HAVE_SHA1_SUPPORT ) */
+#endif /* defined( __GNUC__ ) && !defined( LIBHMAC_DLL_IMPORT ) && !defined( LIBHMAC_HAVE_SHA1_SUPPORT ) */
 
 	HMAC_TEST_RUN(
 	 "libhmac_sha1_context_initialize",
@@ -1283,14 +3376,50 @@ int main(
 	 "libhmac_sha1_context_free",
 	 hmac_test_sha1_context_free );
 
+	HMAC_TEST_RUN(
+	 "libhmac_sha1_context_get_size",
+	 hmac_test_sha1_context_get_size );
+
+	HMAC_TEST_RUN(
+	 "libhmac_sha1_context_initialize_in_place",
+	 hmac_test_sha1_context_initialize_in_place );
+
+	HMAC_TEST_RUN(
+	 "libhmac_sha1_context_free_in_place",
+	 hmac_test_sha1_context_free_in_place );
+
+	HMAC_TEST_RUN(
+	 "libhmac_sha1_context_reset",
+	 hmac_test_sha1_context_reset );
+
+	HMAC_TEST_RUN(
+	 "libhmac_sha1_context_clone",
+	 hmac_test_sha1_context_clone );
+
 	HMAC_TEST_RUN(
 	 "libhmac_sha1_context_update",
 	 hmac_test_sha1_context_update );
 
+	HMAC_TEST_RUN(
+	 "libhmac_sha1_context_update_iov",
+	 hmac_test_sha1_context_update_iov );
+
 	HMAC_TEST_RUN(
 	 "libhmac_sha1_context_finalize",
 	 hmac_test_sha1_context_finalize );
 
+#if !defined( LIBHMAC_HAVE_SHA1_SUPPORT )
+
+	HMAC_TEST_RUN(
+	 "libhmac_sha1_context_export_state",
+	 hmac_test_sha1_context_export_state );
+
+	HMAC_TEST_RUN(
+	 "libhmac_sha1_context_import_state",
+	 hmac_test_sha1_context_import_state );
+
+#endif /* !defined( LIBHMAC_HAVE_SHA1_SUPPORT ) */
+
 	return( EXIT_SUCCESS );
 
 on_error:
@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <memory.h>
 #include <types.h>
 
@@ -75,8 +76,13 @@ int hmac_test_sha224_calculate(
 	uint8_t data[ 208 ];
 	uint8_t hash[ LIBHMAC_SHA224_HASH_SIZE ];
 
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	libcerror_error_t *error        = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_HMAC_TEST_MEMORY )
+	int kernel_type                 = 0;
+	int malloc_attempts_before_fail = 0;
+#endif
 
 	/* Initialize test
 	 */
@@ -103,41 +109,58 @@ int hmac_test_sha224_calculate(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
 #if defined( HAVE_HMAC_TEST_MEMORY )
 
-	/* Test libhmac_sha224_calculate with malloc failing in libhmac_sha224_initialize
+	/* Test libhmac_sha224_calculate does not allocate memory
+	 * The libcrypto kernel is skipped since OpenSSL can allocate memory internally
 	 */
-	hmac_test_malloc_attempts_before_fail = 0;
-
-	result = libhmac_sha224_calculate(
-	          data,
-	          208,
-	          hash,
-	          LIBHMAC_SHA224_HASH_SIZE,
+	result = libhmac_get_kernel_type(
+	          LIBHMAC_HASH_ALGORITHM_SHA224,
+	          &kernel_type,
 	          &error );
 
-	if( hmac_test_malloc_attempts_before_fail != -1 )
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( kernel_type != LIBHMAC_KERNEL_TYPE_LIBCRYPTO )
 	{
+		hmac_test_malloc_attempts_before_fail = 0;
+
+		result = libhmac_sha224_calculate(
+		          data,
+		          208,
+		          hash,
+		          LIBHMAC_SHA224_HASH_SIZE,
+		          &error );
+
+		malloc_attempts_before_fail = hmac_test_malloc_attempts_before_fail;
+
 		hmac_test_malloc_attempts_before_fail = -1;
-	}
-	else
-	{
+
 		HMAC_TEST_ASSERT_EQUAL_INT(
 		 "result",
 		 result,
-		 -1 );
+		 1 );
 
-		HMAC_TEST_ASSERT_IS_NOT_NULL(
+		HMAC_TEST_ASSERT_IS_NULL(
 		 "error",
 		 error );
 
-		libcerror_error_free(
-		 &error );
+		HMAC_TEST_ASSERT_EQUAL_INT(
+		 "malloc_attempts_before_fail",
+		 malloc_attempts_before_fail,
+		 0 );
 	}
 #endif /* defined( HAVE_HMAC_TEST_MEMORY ) */
 
+	/* Test error cases
+	 */
 	/* Test libhmac_sha224_calculate with libhmac_sha224_update failing
 	 */
 	result = libhmac_sha224_calculate(
@@ -191,6 +214,284 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libhmac_sha224_calculate_batch function
+ * Returns 1 if successful or 0 if not
+ */
+int hmac_test_sha224_calculate_batch(
+     void )
+{
+	uint8_t expected_hashes[ 3 * LIBHMAC_SHA224_HASH_SIZE ] = {
+		0xd1, 0x4a, 0x02, 0x8c, 0x2a, 0x3a, 0x2b, 0xc9, 0x47, 0x61, 0x02, 0xbb, 0x28, 0x82, 0x34, 0xc4,
+		0x15, 0xa2, 0xb0, 0x1f, 0x82, 0x8e, 0xa6, 0x2a, 0xc5, 0xb3, 0xe4, 0x2f, 0x23, 0x09, 0x7d, 0x22,
+		0x34, 0x05, 0xd8, 0x22, 0x86, 0x42, 0xa4, 0x77, 0xbd, 0xa2, 0x55, 0xb3, 0x2a, 0xad, 0xbc, 0xe4,
+		0xbd, 0xa0, 0xb3, 0xf7, 0xe3, 0x6c, 0x9d, 0xa7, 0x75, 0x38, 0x8b, 0x16, 0x51, 0x27, 0x76, 0xcc,
+		0x5d, 0xba, 0x5d, 0xa1, 0xfd, 0x89, 0x01, 0x50, 0xb0, 0xc6, 0x45, 0x5c, 0xb4, 0xf5, 0x8b, 0x19,
+		0x52, 0x52, 0x25, 0x25 };
+
+	uint8_t data[ 4096 ];
+	uint8_t expected_batch_hashes[ 40 * LIBHMAC_SHA224_HASH_SIZE ];
+	uint8_t batch_hashes[ 40 * LIBHMAC_SHA224_HASH_SIZE ];
+	uint8_t hashes[ 3 * LIBHMAC_SHA224_HASH_SIZE ];
+	const uint8_t *batch_buffers[ 40 ];
+	size_t batch_sizes[ 40 ];
+
+	const uint8_t *buffers[ 3 ] = {
+		(uint8_t *) "",
+		(uint8_t *) "abc",
+		(uint8_t *) "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq" };
+
+	size_t sizes[ 3 ] = {
+		0, 3, 56 };
+
+	libcerror_error_t *error = NULL;
+	size_t data_index        = 0;
+	int buffer_index         = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libhmac_sha224_calculate_batch(
+	          buffers,
+	          sizes,
+	          3,
+	          hashes,
+	          3 * LIBHMAC_SHA224_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hashes,
+	          expected_hashes,
+	          3 * LIBHMAC_SHA224_HASH_SIZE );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test more buffers than fit in a single batch and in the multi-buffer lanes
+	 */
+	for( data_index = 0;
+	     data_index < 4096;
+	     data_index++ )
+	{
+		data[ data_index ] = (uint8_t) ( data_index * 13 );
+	}
+	for( buffer_index = 0;
+	     buffer_index < 40;
+	     buffer_index++ )
+	{
+		batch_buffers[ buffer_index ] = &( data[ buffer_index ] );
+		batch_sizes[ buffer_index ]   = (size_t) buffer_index * 97;
+
+		result = libhmac_sha224_calculate(
+		          batch_buffers[ buffer_index ],
+		          batch_sizes[ buffer_index ],
+		          &( expected_batch_hashes[ buffer_index * LIBHMAC_SHA224_HASH_SIZE ] ),
+		          LIBHMAC_SHA224_HASH_SIZE,
+		          &error );
+
+		HMAC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HMAC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libhmac_sha224_calculate_batch(
+	          batch_buffers,
+	          batch_sizes,
+	          40,
+	          batch_hashes,
+	          40 * LIBHMAC_SHA224_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          batch_hashes,
+	          expected_batch_hashes,
+	          40 * LIBHMAC_SHA224_HASH_SIZE );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libhmac_sha224_calculate_batch(
+	          NULL,
+	          sizes,
+	          3,
+	          hashes,
+	          3 * LIBHMAC_SHA224_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha224_calculate_batch(
+	          buffers,
+	          NULL,
+	          3,
+	          hashes,
+	          3 * LIBHMAC_SHA224_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha224_calculate_batch(
+	          buffers,
+	          sizes,
+	          -1,
+	          hashes,
+	          3 * LIBHMAC_SHA224_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha224_calculate_batch(
+	          buffers,
+	          sizes,
+	          3,
+	          NULL,
+	          3 * LIBHMAC_SHA224_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha224_calculate_batch(
+	          buffers,
+	          sizes,
+	          3,
+	          hashes,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha224_calculate_batch(
+	          buffers,
+	          sizes,
+	          3,
+	          hashes,
+	          2 * LIBHMAC_SHA224_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libhmac_sha224_calculate_batch with a missing buffer
+	 */
+	buffers[ 0 ] = NULL;
+
+	result = libhmac_sha224_calculate_batch(
+	          buffers,
+	          sizes,
+	          3,
+	          hashes,
+	          3 * LIBHMAC_SHA224_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the libhmac_sha224_calculate_hmac function
  * Returns 1 if successful or 0 if not
  */
@@ -278,9 +579,14 @@ int hmac_test_sha224_calculate_hmac(
 		    0x94, 0x67, 0x70, 0xdb, 0x9c, 0x2b, 0x95, 0xc9, 0xf6, 0xf5, 0x65, 0xd1 }, 28 },
 	};
 
-	libcerror_error_t *error = NULL;
-	int result               = 0;
-	int test_number          = 0;
+	libcerror_error_t *error        = NULL;
+	int result                      = 0;
+	int test_number                 = 0;
+
+#if defined( HAVE_HMAC_TEST_MEMORY )
+	int kernel_type                 = 0;
+	int malloc_attempts_before_fail = 0;
+#endif
 
 	/* Test regular cases
 	 */
@@ -383,36 +689,53 @@ int hmac_test_sha224_calculate_hmac(
 
 #if defined( HAVE_HMAC_TEST_MEMORY )
 
-	/* Test libhmac_sha224_calculate_hmac with malloc failing
+	/* Test libhmac_sha224_calculate_hmac does not allocate memory
+	 * The libcrypto kernel is skipped since OpenSSL can allocate memory internally
 	 */
-	hmac_test_malloc_attempts_before_fail = 0;
-
-	result = libhmac_sha224_calculate_hmac(
-	          test_vectors[ 0 ].key,
-	          test_vectors[ 0 ].key_size,
-	          test_vectors[ 0 ].data,
-	          test_vectors[ 0 ].data_size,
-	          hmac,
-	          LIBHMAC_SHA224_HASH_SIZE,
+	result = libhmac_get_kernel_type(
+	          LIBHMAC_HASH_ALGORITHM_SHA224,
+	          &kernel_type,
 	          &error );
 
-	if( hmac_test_malloc_attempts_before_fail != -1 )
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( kernel_type != LIBHMAC_KERNEL_TYPE_LIBCRYPTO )
 	{
+		hmac_test_malloc_attempts_before_fail = 0;
+
+		result = libhmac_sha224_calculate_hmac(
+		          test_vectors[ 0 ].key,
+		          test_vectors[ 0 ].key_size,
+		          test_vectors[ 0 ].data,
+		          test_vectors[ 0 ].data_size,
+		          hmac,
+		          LIBHMAC_SHA224_HASH_SIZE,
+		          &error );
+
+		malloc_attempts_before_fail = hmac_test_malloc_attempts_before_fail;
+
 		hmac_test_malloc_attempts_before_fail = -1;
-	}
-	else
-	{
+
 		HMAC_TEST_ASSERT_EQUAL_INT(
 		 "result",
 		 result,
-		 -1 );
+		 1 );
 
-		HMAC_TEST_ASSERT_IS_NOT_NULL(
+		HMAC_TEST_ASSERT_IS_NULL(
 		 "error",
 		 error );
 
-		libcerror_error_free(
-		 &error );
+		HMAC_TEST_ASSERT_EQUAL_INT(
+		 "malloc_attempts_before_fail",
+		 malloc_attempts_before_fail,
+		 0 );
 	}
 #endif /* defined( HAVE_HMAC_TEST_MEMORY ) */
 
@@ -449,6 +772,182 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libhmac_sha224_compress_blocks function
+ * Returns 1 if successful or 0 if not
+ */
+int hmac_test_sha224_compress_blocks(
+     void )
+{
+	uint8_t blocks[ 3 * LIBHMAC_SHA224_BLOCK_SIZE ];
+	uint8_t expected_hash[ LIBHMAC_SHA224_HASH_SIZE ];
+	uint8_t hash[ LIBHMAC_SHA224_HASH_SIZE ];
+	uint32_t hash_values[ 8 ] = {
+		0xc1059ed8UL, 0x367cd507UL, 0x3070dd17UL, 0xf70e5939UL,
+		0xffc00b31UL, 0x68581511UL, 0x64f98fa7UL, 0xbefa4fa4UL };
+
+	libcerror_error_t *error = NULL;
+	size_t data_offset       = 0;
+	size_t hash_offset       = 0;
+	int result               = 0;
+	int value_index          = 0;
+
+	/* Initialize test
+	 * The last block contains the padding of 2 blocks of data
+	 */
+	for( data_offset = 0;
+	     data_offset < ( 2 * LIBHMAC_SHA224_BLOCK_SIZE );
+	     data_offset++ )
+	{
+		blocks[ data_offset ] = (uint8_t) data_offset;
+	}
+	memory_set(
+	 &( blocks[ 2 * LIBHMAC_SHA224_BLOCK_SIZE ] ),
+	 0,
+	 LIBHMAC_SHA224_BLOCK_SIZE );
+
+	blocks[ 2 * LIBHMAC_SHA224_BLOCK_SIZE ] = 0x80;
+
+	/* The size of the data in bits is stored as a 64-bit big-endian value
+	 */
+	blocks[ ( 3 * LIBHMAC_SHA224_BLOCK_SIZE ) - 2 ] = 0x04;
+
+	result = libhmac_sha224_calculate(
+	          blocks,
+	          2 * LIBHMAC_SHA224_BLOCK_SIZE,
+	          expected_hash,
+	          LIBHMAC_SHA224_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libhmac_sha224_compress_blocks(
+	          hash_values,
+	          blocks,
+	          3,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The SHA-224 hash consists of the first 7 hash values
+	 */
+	for( hash_offset = 0;
+	     hash_offset < LIBHMAC_SHA224_HASH_SIZE;
+	     hash_offset += 4 )
+	{
+		byte_stream_copy_from_uint32_big_endian(
+		 &( hash[ hash_offset ] ),
+		 hash_values[ value_index ] );
+
+		value_index++;
+	}
+	result = memory_compare(
+	          hash,
+	          expected_hash,
+	          LIBHMAC_SHA224_HASH_SIZE );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libhmac_sha224_compress_blocks(
+	          hash_values,
+	          blocks,
+	          0,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhmac_sha224_compress_blocks(
+	          NULL,
+	          blocks,
+	          3,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha224_compress_blocks(
+	          hash_values,
+	          NULL,
+	          3,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha224_compress_blocks(
+	          hash_values,
+	          blocks,
+	          (size_t) SSIZE_MAX,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -468,10 +967,18 @@ int main(
 	 "libhmac_sha224_calculate",
 	 hmac_test_sha224_calculate );
 
+	HMAC_TEST_RUN(
+	 "libhmac_sha224_calculate_batch",
+	 hmac_test_sha224_calculate_batch );
+
 	HMAC_TEST_RUN(
 	 "libhmac_sha224_calculate_hmac",
 	 hmac_test_sha224_calculate_hmac );
 
+	HMAC_TEST_RUN(
+	 "libhmac_sha224_compress_blocks",
+	 hmac_test_sha224_compress_blocks );
+
 	return( EXIT_SUCCESS );
 
 on_error:
@@ -0,0 +1,728 @@
+/*
+ * Library SHA-224 HMAC context functions test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "hmac_test_libcerror.h"
+#include "hmac_test_libhmac.h"
+#include "hmac_test_macros.h"
+#include "hmac_test_memory.h"
+#include "hmac_test_unused.h"
+
+/* Tests the libhmac_sha224_hmac_context_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int hmac_test_sha224_hmac_context_initialize(
+     void )
+{
+	uint8_t key_data[ 16 ]                      = {
+		0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f };
+
+	libcerror_error_t *error                    = NULL;
+	libhmac_sha224_hmac_context_t *hmac_context = NULL;
+	int result                                  = 0;
+
+#if defined( HAVE_HMAC_TEST_MEMORY )
+	int number_of_malloc_fail_tests             = 1;
+	int number_of_memset_fail_tests             = 1;
+	int test_number                             = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result                                      = libhmac_sha224_hmac_context_initialize(
+	          &hmac_context,
+	          key_data,
+	          16,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "hmac_context",
+	 hmac_context );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhmac_sha224_hmac_context_free(
+	          &hmac_context,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "hmac_context",
+	 hmac_context );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhmac_sha224_hmac_context_initialize(
+	          NULL,
+	          key_data,
+	          16,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	hmac_context = (libhmac_sha224_hmac_context_t *) 0x12345678UL;
+
+	result = libhmac_sha224_hmac_context_initialize(
+	          &hmac_context,
+	          key_data,
+	          16,
+	          &error );
+
+	hmac_context = NULL;
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha224_hmac_context_initialize(
+	          &hmac_context,
+	          NULL,
+	          16,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "hmac_context",
+	 hmac_context );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha224_hmac_context_initialize(
+	          &hmac_context,
+	          key_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "hmac_context",
+	 hmac_context );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_HMAC_TEST_MEMORY )
+
+	/* 1 fail in memory_allocate_structure
+	 */
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libhmac_sha224_hmac_context_initialize with malloc failing
+		 */
+		hmac_test_malloc_attempts_before_fail = test_number;
+
+		result = libhmac_sha224_hmac_context_initialize(
+		          &hmac_context,
+		          key_data,
+		          16,
+		          &error );
+
+		if( hmac_test_malloc_attempts_before_fail != -1 )
+		{
+			hmac_test_malloc_attempts_before_fail = -1;
+
+			if( hmac_context != NULL )
+			{
+				libhmac_sha224_hmac_context_free(
+				 &hmac_context,
+				 NULL );
+			}
+		}
+		else
+		{
+			HMAC_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			HMAC_TEST_ASSERT_IS_NULL(
+			 "hmac_context",
+			 hmac_context );
+
+			HMAC_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* 1 fail in memset after memory_allocate_structure
+	 */
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libhmac_sha224_hmac_context_initialize with memset failing
+		 */
+		hmac_test_memset_attempts_before_fail = test_number;
+
+		result = libhmac_sha224_hmac_context_initialize(
+		          &hmac_context,
+		          key_data,
+		          16,
+		          &error );
+
+		if( hmac_test_memset_attempts_before_fail != -1 )
+		{
+			hmac_test_memset_attempts_before_fail = -1;
+
+			if( hmac_context != NULL )
+			{
+				libhmac_sha224_hmac_context_free(
+				 &hmac_context,
+				 NULL );
+			}
+		}
+		else
+		{
+			HMAC_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			HMAC_TEST_ASSERT_IS_NULL(
+			 "hmac_context",
+			 hmac_context );
+
+			HMAC_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_HMAC_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( hmac_context != NULL )
+	{
+		libhmac_sha224_hmac_context_free(
+		 &hmac_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libhmac_sha224_hmac_context_free function
+ * Returns 1 if successful or 0 if not
+ */
+int hmac_test_sha224_hmac_context_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libhmac_sha224_hmac_context_free(
+	          NULL,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libhmac_sha224_hmac_context_update and libhmac_sha224_hmac_context_finalize functions
+ * Returns 1 if successful or 0 if not
+ */
+int hmac_test_sha224_hmac_context_update(
+     void )
+{
+	uint8_t expected_hmac[ LIBHMAC_SHA224_HASH_SIZE ];
+	uint8_t hmac[ LIBHMAC_SHA224_HASH_SIZE ];
+	uint8_t test_data[ 256 ];
+
+	size_t chunk_sizes[ 5 ]                     = { 1, 7, 55, 64, 200 };
+	size_t key_data_sizes[ 4 ]                  = { 0, 20, 64, 131 };
+	libcerror_error_t *error                    = NULL;
+	libhmac_sha224_hmac_context_t *hmac_context = NULL;
+	size_t chunk_size                           = 0;
+	size_t data_offset                          = 0;
+	int chunk_size_index                        = 0;
+	int key_data_size_index                     = 0;
+	int result                                  = 0;
+
+	for( data_offset = 0;
+	     data_offset < 256;
+	     data_offset++ )
+	{
+		test_data[ data_offset ] = (uint8_t) ( 0xff - data_offset );
+	}
+	/* Test regular cases
+	 */
+	for( key_data_size_index = 0;
+	     key_data_size_index < 4;
+	     key_data_size_index++ )
+	{
+		result = libhmac_sha224_calculate_hmac(
+		          test_data,
+		          key_data_sizes[ key_data_size_index ],
+		          &( test_data[ 56 ] ),
+		          200,
+		          expected_hmac,
+		          LIBHMAC_SHA224_HASH_SIZE,
+		          &error );
+
+		HMAC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HMAC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libhmac_sha224_hmac_context_initialize(
+		          &hmac_context,
+		          test_data,
+		          key_data_sizes[ key_data_size_index ],
+		          &error );
+
+		HMAC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HMAC_TEST_ASSERT_IS_NOT_NULL(
+		 "hmac_context",
+		 hmac_context );
+
+		HMAC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* The HMAC context is reused after finalize for every chunk size
+		 */
+		for( chunk_size_index = 0;
+		     chunk_size_index < 5;
+		     chunk_size_index++ )
+		{
+			for( data_offset = 0;
+			     data_offset < 200;
+			     data_offset += chunk_size )
+			{
+				chunk_size = chunk_sizes[ chunk_size_index ];
+
+				if( chunk_size > ( 200 - data_offset ) )
+				{
+					chunk_size = 200 - data_offset;
+				}
+				result = libhmac_sha224_hmac_context_update(
+				          hmac_context,
+				          &( test_data[ 56 + data_offset ] ),
+				          chunk_size,
+				          &error );
+
+				HMAC_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				HMAC_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+			}
+			result = libhmac_sha224_hmac_context_finalize(
+			          hmac_context,
+			          hmac,
+			          LIBHMAC_SHA224_HASH_SIZE,
+			          &error );
+
+			HMAC_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			HMAC_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = memory_compare(
+			          hmac,
+			          expected_hmac,
+			          LIBHMAC_SHA224_HASH_SIZE );
+
+			HMAC_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+		result = libhmac_sha224_hmac_context_free(
+		          &hmac_context,
+		          &error );
+
+		HMAC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HMAC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Initialize test
+	 */
+	result = libhmac_sha224_hmac_context_initialize(
+	          &hmac_context,
+	          test_data,
+	          20,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "hmac_context",
+	 hmac_context );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhmac_sha224_hmac_context_update(
+	          NULL,
+	          test_data,
+	          3,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha224_hmac_context_update(
+	          hmac_context,
+	          NULL,
+	          3,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha224_hmac_context_finalize(
+	          NULL,
+	          hmac,
+	          LIBHMAC_SHA224_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha224_hmac_context_finalize(
+	          hmac_context,
+	          NULL,
+	          LIBHMAC_SHA224_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha224_hmac_context_finalize(
+	          hmac_context,
+	          hmac,
+	          LIBHMAC_SHA224_HASH_SIZE - 1,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test that a failed finalize leaves the HMAC context usable
+	 */
+	result = libhmac_sha224_calculate_hmac(
+	          test_data,
+	          20,
+	          &( test_data[ 56 ] ),
+	          200,
+	          expected_hmac,
+	          LIBHMAC_SHA224_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhmac_sha224_hmac_context_update(
+	          hmac_context,
+	          &( test_data[ 56 ] ),
+	          200,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhmac_sha224_hmac_context_finalize(
+	          hmac_context,
+	          hmac,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha224_hmac_context_finalize(
+	          hmac_context,
+	          hmac,
+	          LIBHMAC_SHA224_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hmac,
+	          expected_hmac,
+	          LIBHMAC_SHA224_HASH_SIZE );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Clean up
+	 */
+	result = libhmac_sha224_hmac_context_free(
+	          &hmac_context,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "hmac_context",
+	 hmac_context );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( hmac_context != NULL )
+	{
+		libhmac_sha224_hmac_context_free(
+		 &hmac_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc HMAC_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] HMAC_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc HMAC_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] HMAC_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	HMAC_TEST_UNREFERENCED_PARAMETER( argc )
+	HMAC_TEST_UNREFERENCED_PARAMETER( argv )
+
+	HMAC_TEST_RUN(
+	 "libhmac_sha224_hmac_context_initialize",
+	 hmac_test_sha224_hmac_context_initialize );
+
+	HMAC_TEST_RUN(
+	 "libhmac_sha224_hmac_context_free",
+	 hmac_test_sha224_hmac_context_free );
+
+	HMAC_TEST_RUN(
+	 "libhmac_sha224_hmac_context_update",
+	 hmac_test_sha224_hmac_context_update );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
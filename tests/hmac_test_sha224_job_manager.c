@@ -0,0 +1,1044 @@
+/*
+ * Library SHA-224 job manager functions test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "hmac_test_libcerror.h"
+#include "hmac_test_libhmac.h"
+#include "hmac_test_macros.h"
+#include "hmac_test_memory.h"
+#include "hmac_test_unused.h"
+
+#define HMAC_TEST_SHA224_JOB_MANAGER_NUMBER_OF_JOBS	100
+
+/* Tests the libhmac_sha224_job_manager_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int hmac_test_sha224_job_manager_initialize(
+     void )
+{
+	libcerror_error_t *error                  = NULL;
+	libhmac_sha224_job_manager_t *job_manager = NULL;
+	int result                                = 0;
+
+#if defined( HAVE_HMAC_TEST_MEMORY )
+	int number_of_malloc_fail_tests           = 1;
+	int number_of_memset_fail_tests           = 1;
+	int test_number                           = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libhmac_sha224_job_manager_initialize(
+	          &job_manager,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "job_manager",
+	 job_manager );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhmac_sha224_job_manager_free(
+	          &job_manager,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "job_manager",
+	 job_manager );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhmac_sha224_job_manager_initialize(
+	          NULL,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	job_manager = (libhmac_sha224_job_manager_t *) 0x12345678UL;
+
+	result = libhmac_sha224_job_manager_initialize(
+	          &job_manager,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	job_manager = NULL;
+
+#if defined( HAVE_HMAC_TEST_MEMORY )
+
+	/* 1 fail in memory_allocate_structure
+	 */
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libhmac_sha224_job_manager_initialize with malloc failing
+		 */
+		hmac_test_malloc_attempts_before_fail = test_number;
+
+		result = libhmac_sha224_job_manager_initialize(
+		          &job_manager,
+		          &error );
+
+		if( hmac_test_malloc_attempts_before_fail != -1 )
+		{
+			hmac_test_malloc_attempts_before_fail = -1;
+
+			if( job_manager != NULL )
+			{
+				libhmac_sha224_job_manager_free(
+				 &job_manager,
+				 NULL );
+			}
+		}
+		else
+		{
+			HMAC_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			HMAC_TEST_ASSERT_IS_NULL(
+			 "job_manager",
+			 job_manager );
+
+			HMAC_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* 1 fail in memset after memory_allocate_structure
+	 */
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libhmac_sha224_job_manager_initialize with memset failing
+		 */
+		hmac_test_memset_attempts_before_fail = test_number;
+
+		result = libhmac_sha224_job_manager_initialize(
+		          &job_manager,
+		          &error );
+
+		if( hmac_test_memset_attempts_before_fail != -1 )
+		{
+			hmac_test_memset_attempts_before_fail = -1;
+
+			if( job_manager != NULL )
+			{
+				libhmac_sha224_job_manager_free(
+				 &job_manager,
+				 NULL );
+			}
+		}
+		else
+		{
+			HMAC_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			HMAC_TEST_ASSERT_IS_NULL(
+			 "job_manager",
+			 job_manager );
+
+			HMAC_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_HMAC_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( job_manager != NULL )
+	{
+		libhmac_sha224_job_manager_free(
+		 &job_manager,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libhmac_sha224_job_manager_free function
+ * Returns 1 if successful or 0 if not
+ */
+int hmac_test_sha224_job_manager_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libhmac_sha224_job_manager_free(
+	          NULL,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Retrieves the completed jobs and compares their hashes with the SHA-224 of the buffers
+ * Returns 1 if successful or 0 if not
+ */
+int hmac_test_sha224_job_manager_check_completed_jobs(
+     libhmac_sha224_job_manager_t *job_manager,
+     int maximum_number_of_completed_jobs,
+     const uint8_t *data,
+     const size_t *sizes,
+     uint8_t *is_completed )
+{
+	uint8_t expected_hash[ LIBHMAC_SHA224_HASH_SIZE ];
+	uint8_t hash[ LIBHMAC_SHA224_HASH_SIZE ];
+
+	libcerror_error_t *error   = NULL;
+	intptr_t *user_data        = NULL;
+	int job_index              = 0;
+	int number_of_checked_jobs = 0;
+	int result                 = 0;
+
+	while( number_of_checked_jobs < maximum_number_of_completed_jobs )
+	{
+		result = libhmac_sha224_job_manager_get_completed_job(
+		          job_manager,
+		          &user_data,
+		          hash,
+		          LIBHMAC_SHA224_HASH_SIZE,
+		          &error );
+
+		HMAC_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		HMAC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( result == 0 )
+		{
+			break;
+		}
+		HMAC_TEST_ASSERT_IS_NOT_NULL(
+		 "user_data",
+		 user_data );
+
+		job_index = *( (int *) user_data );
+
+		HMAC_TEST_ASSERT_GREATER_THAN_INT(
+		 "job_index",
+		 job_index,
+		 -1 );
+
+		HMAC_TEST_ASSERT_LESS_THAN_INT(
+		 "job_index",
+		 job_index,
+		 HMAC_TEST_SHA224_JOB_MANAGER_NUMBER_OF_JOBS );
+
+		HMAC_TEST_ASSERT_EQUAL_INT(
+		 "is_completed",
+		 (int) is_completed[ job_index ],
+		 0 );
+
+		is_completed[ job_index ] = 1;
+
+		result = libhmac_sha224_calculate(
+		          &( data[ job_index % 64 ] ),
+		          sizes[ job_index ],
+		          expected_hash,
+		          LIBHMAC_SHA224_HASH_SIZE,
+		          &error );
+
+		HMAC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HMAC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          hash,
+		          expected_hash,
+		          LIBHMAC_SHA224_HASH_SIZE );
+
+		HMAC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		number_of_checked_jobs++;
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libhmac_sha224_job_manager_submit, libhmac_sha224_job_manager_flush
+ * and libhmac_sha224_job_manager_get_completed_job functions
+ * Returns 1 if successful or 0 if not
+ */
+int hmac_test_sha224_job_manager_submit(
+     void )
+{
+	uint8_t data[ 4096 + 64 ];
+	int job_identifiers[ HMAC_TEST_SHA224_JOB_MANAGER_NUMBER_OF_JOBS ];
+	size_t sizes[ HMAC_TEST_SHA224_JOB_MANAGER_NUMBER_OF_JOBS ];
+	uint8_t is_completed[ HMAC_TEST_SHA224_JOB_MANAGER_NUMBER_OF_JOBS ];
+
+	libcerror_error_t *error                  = NULL;
+	libhmac_sha224_job_manager_t *job_manager = NULL;
+	size_t data_index                         = 0;
+	int job_index                             = 0;
+	int number_of_completed_jobs              = 0;
+	int result                                = 0;
+
+	/* Initialize test
+	 */
+	for( data_index = 0;
+	     data_index < ( 4096 + 64 );
+	     data_index++ )
+	{
+		data[ data_index ] = (uint8_t) ( ( data_index * 13 ) + ( data_index / 251 ) );
+	}
+	/* Sizes that test the padding boundaries and jobs of different sizes
+	 * that finish in different lanes
+	 */
+	for( job_index = 0;
+	     job_index < HMAC_TEST_SHA224_JOB_MANAGER_NUMBER_OF_JOBS;
+	     job_index++ )
+	{
+		job_identifiers[ job_index ] = job_index;
+		is_completed[ job_index ]    = 0;
+
+		switch( job_index % 8 )
+		{
+			case 0:
+				sizes[ job_index ] = 0;
+				break;
+
+			case 1:
+				sizes[ job_index ] = 55 + ( job_index % 3 );
+				break;
+
+			case 2:
+				sizes[ job_index ] = 64 * ( job_index % 5 );
+				break;
+
+			case 3:
+				sizes[ job_index ] = 4096;
+				break;
+
+			default:
+				sizes[ job_index ] = ( (size_t) job_index * 37 ) % 4096;
+				break;
+		}
+	}
+	result = libhmac_sha224_job_manager_initialize(
+	          &job_manager,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "job_manager",
+	 job_manager );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test submit while retrieving one completed job after every third submitted job
+	 */
+	for( job_index = 0;
+	     job_index < HMAC_TEST_SHA224_JOB_MANAGER_NUMBER_OF_JOBS;
+	     job_index++ )
+	{
+		result = libhmac_sha224_job_manager_submit(
+		          job_manager,
+		          &( data[ job_index % 64 ] ),
+		          sizes[ job_index ],
+		          (intptr_t *) &( job_identifiers[ job_index ] ),
+		          &error );
+
+		HMAC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HMAC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( ( job_index % 3 ) == 2 )
+		{
+			result = hmac_test_sha224_job_manager_check_completed_jobs(
+			          job_manager,
+			          1,
+			          data,
+			          sizes,
+			          is_completed );
+
+			HMAC_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+		}
+	}
+	result = libhmac_sha224_job_manager_flush(
+	          job_manager,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhmac_sha224_job_manager_get_number_of_completed_jobs(
+	          job_manager,
+	          &number_of_completed_jobs,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_completed_jobs",
+	 number_of_completed_jobs,
+	 0 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = hmac_test_sha224_job_manager_check_completed_jobs(
+	          job_manager,
+	          HMAC_TEST_SHA224_JOB_MANAGER_NUMBER_OF_JOBS,
+	          data,
+	          sizes,
+	          is_completed );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	for( job_index = 0;
+	     job_index < HMAC_TEST_SHA224_JOB_MANAGER_NUMBER_OF_JOBS;
+	     job_index++ )
+	{
+		HMAC_TEST_ASSERT_EQUAL_INT(
+		 "is_completed",
+		 (int) is_completed[ job_index ],
+		 1 );
+	}
+	result = libhmac_sha224_job_manager_get_number_of_completed_jobs(
+	          job_manager,
+	          &number_of_completed_jobs,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "number_of_completed_jobs",
+	 number_of_completed_jobs,
+	 0 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test free with jobs that have not been flushed
+	 */
+	for( job_index = 0;
+	     job_index < 3;
+	     job_index++ )
+	{
+		result = libhmac_sha224_job_manager_submit(
+		          job_manager,
+		          data,
+		          sizes[ job_index ],
+		          (intptr_t *) &( job_identifiers[ job_index ] ),
+		          &error );
+
+		HMAC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HMAC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libhmac_sha224_job_manager_submit(
+	          NULL,
+	          data,
+	          sizes[ 0 ],
+	          NULL,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha224_job_manager_submit(
+	          job_manager,
+	          NULL,
+	          sizes[ 0 ],
+	          NULL,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha224_job_manager_submit(
+	          job_manager,
+	          data,
+	          (size_t) SSIZE_MAX + 1,
+	          NULL,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha224_job_manager_flush(
+	          NULL,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libhmac_sha224_job_manager_free(
+	          &job_manager,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "job_manager",
+	 job_manager );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( job_manager != NULL )
+	{
+		libhmac_sha224_job_manager_free(
+		 &job_manager,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libhmac_sha224_job_manager_get_number_of_completed_jobs function
+ * Returns 1 if successful or 0 if not
+ */
+int hmac_test_sha224_job_manager_get_number_of_completed_jobs(
+     void )
+{
+	libcerror_error_t *error                  = NULL;
+	libhmac_sha224_job_manager_t *job_manager = NULL;
+	int number_of_completed_jobs              = 0;
+	int result                                = 0;
+
+	/* Initialize test
+	 */
+	result = libhmac_sha224_job_manager_initialize(
+	          &job_manager,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "job_manager",
+	 job_manager );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libhmac_sha224_job_manager_get_number_of_completed_jobs(
+	          job_manager,
+	          &number_of_completed_jobs,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "number_of_completed_jobs",
+	 number_of_completed_jobs,
+	 0 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhmac_sha224_job_manager_get_number_of_completed_jobs(
+	          NULL,
+	          &number_of_completed_jobs,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha224_job_manager_get_number_of_completed_jobs(
+	          job_manager,
+	          NULL,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libhmac_sha224_job_manager_free(
+	          &job_manager,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "job_manager",
+	 job_manager );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( job_manager != NULL )
+	{
+		libhmac_sha224_job_manager_free(
+		 &job_manager,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libhmac_sha224_job_manager_get_completed_job function
+ * Returns 1 if successful or 0 if not
+ */
+int hmac_test_sha224_job_manager_get_completed_job(
+     void )
+{
+	uint8_t hash[ LIBHMAC_SHA224_HASH_SIZE ];
+
+	libcerror_error_t *error                  = NULL;
+	libhmac_sha224_job_manager_t *job_manager = NULL;
+	intptr_t *user_data                       = NULL;
+	int result                                = 0;
+
+	/* Initialize test
+	 */
+	result = libhmac_sha224_job_manager_initialize(
+	          &job_manager,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "job_manager",
+	 job_manager );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libhmac_sha224_job_manager_get_completed_job(
+	          job_manager,
+	          &user_data,
+	          hash,
+	          LIBHMAC_SHA224_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhmac_sha224_job_manager_get_completed_job(
+	          NULL,
+	          &user_data,
+	          hash,
+	          LIBHMAC_SHA224_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha224_job_manager_get_completed_job(
+	          job_manager,
+	          NULL,
+	          hash,
+	          LIBHMAC_SHA224_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha224_job_manager_get_completed_job(
+	          job_manager,
+	          &user_data,
+	          NULL,
+	          LIBHMAC_SHA224_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha224_job_manager_get_completed_job(
+	          job_manager,
+	          &user_data,
+	          hash,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha224_job_manager_get_completed_job(
+	          job_manager,
+	          &user_data,
+	          hash,
+	          0,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libhmac_sha224_job_manager_free(
+	          &job_manager,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "job_manager",
+	 job_manager );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( job_manager != NULL )
+	{
+		libhmac_sha224_job_manager_free(
+		 &job_manager,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc HMAC_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] HMAC_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc HMAC_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] HMAC_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	HMAC_TEST_UNREFERENCED_PARAMETER( argc )
+	HMAC_TEST_UNREFERENCED_PARAMETER( argv )
+
+	HMAC_TEST_RUN(
+	 "libhmac_sha224_job_manager_initialize",
+	 hmac_test_sha224_job_manager_initialize );
+
+	HMAC_TEST_RUN(
+	 "libhmac_sha224_job_manager_free",
+	 hmac_test_sha224_job_manager_free );
+
+	HMAC_TEST_RUN(
+	 "libhmac_sha224_job_manager_submit",
+	 hmac_test_sha224_job_manager_submit );
+
+	HMAC_TEST_RUN(
+	 "libhmac_sha224_job_manager_get_number_of_completed_jobs",
+	 hmac_test_sha224_job_manager_get_number_of_completed_jobs );
+
+	HMAC_TEST_RUN(
+	 "libhmac_sha224_job_manager_get_completed_job",
+	 hmac_test_sha224_job_manager_get_completed_job );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <memory.h>
 #include <types.h>
 
@@ -75,76 +76,763 @@ int hmac_test_sha256_calculate(
 	uint8_t data[ 208 ];
 	uint8_t hash[ LIBHMAC_SHA256_HASH_SIZE ];
 
+	libcerror_error_t *error        = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_HMAC_TEST_MEMORY )
+	int kernel_type                 = 0;
+	int malloc_attempts_before_fail = 0;
+#endif
+
+	/* Initialize test
+	 */
+	memory_set(
+	 data,
+	 0,
+	 208 );
+
+	/* Test regular cases
+	 */
+	result = libhmac_sha256_calculate(
+	          data,
+	          208,
+	          hash,
+	          LIBHMAC_SHA256_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_HMAC_TEST_MEMORY )
+
+	/* Test libhmac_sha256_calculate does not allocate memory
+	 * The libcrypto kernel is skipped since OpenSSL can allocate memory internally
+	 */
+	result = libhmac_get_kernel_type(
+	          LIBHMAC_HASH_ALGORITHM_SHA256,
+	          &kernel_type,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( kernel_type != LIBHMAC_KERNEL_TYPE_LIBCRYPTO )
+	{
+		hmac_test_malloc_attempts_before_fail = 0;
+
+		result = libhmac_sha256_calculate(
+		          data,
+		          208,
+		          hash,
+		          LIBHMAC_SHA256_HASH_SIZE,
+		          &error );
+
+		malloc_attempts_before_fail = hmac_test_malloc_attempts_before_fail;
+
+		hmac_test_malloc_attempts_before_fail = -1;
+
+		HMAC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HMAC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		HMAC_TEST_ASSERT_EQUAL_INT(
+		 "malloc_attempts_before_fail",
+		 malloc_attempts_before_fail,
+		 0 );
+	}
+#endif /* defined( HAVE_HMAC_TEST_MEMORY ) */
+
+	/* Test error cases
+	 */
+	/* Test libhmac_sha256_calculate with libhmac_sha256_update failing
+	 */
+	result = libhmac_sha256_calculate(
+	          NULL,
+	          208,
+	          hash,
+	          LIBHMAC_SHA256_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libhmac_sha256_calculate with libhmac_sha256_finalize failing
+	 */
+	result = libhmac_sha256_calculate(
+	          data,
+	          208,
+	          NULL,
+	          LIBHMAC_SHA256_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libhmac_sha256_calculate_batch function
+ * Returns 1 if successful or 0 if not
+ */
+int hmac_test_sha256_calculate_batch(
+     void )
+{
+	uint8_t expected_hashes[ 3 * LIBHMAC_SHA256_HASH_SIZE ] = {
+		0xe3, 0xb0, 0xc4, 0x42, 0x98, 0xfc, 0x1c, 0x14, 0x9a, 0xfb, 0xf4, 0xc8, 0x99, 0x6f, 0xb9, 0x24,
+		0x27, 0xae, 0x41, 0xe4, 0x64, 0x9b, 0x93, 0x4c, 0xa4, 0x95, 0x99, 0x1b, 0x78, 0x52, 0xb8, 0x55,
+		0xba, 0x78, 0x16, 0xbf, 0x8f, 0x01, 0xcf, 0xea, 0x41, 0x41, 0x40, 0xde, 0x5d, 0xae, 0x22, 0x23,
+		0xb0, 0x03, 0x61, 0xa3, 0x96, 0x17, 0x7a, 0x9c, 0xb4, 0x10, 0xff, 0x61, 0xf2, 0x00, 0x15, 0xad,
+		0x24, 0x8d, 0x6a, 0x61, 0xd2, 0x06, 0x38, 0xb8, 0xe5, 0xc0, 0x26, 0x93, 0x0c, 0x3e, 0x60, 0x39,
+		0xa3, 0x3c, 0xe4, 0x59, 0x64, 0xff, 0x21, 0x67, 0xf6, 0xec, 0xed, 0xd4, 0x19, 0xdb, 0x06, 0xc1 };
+
+	uint8_t hashes[ 3 * LIBHMAC_SHA256_HASH_SIZE ];
+
+	const uint8_t *buffers[ 3 ] = {
+		(uint8_t *) "",
+		(uint8_t *) "abc",
+		(uint8_t *) "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq" };
+
+	size_t sizes[ 3 ] = {
+		0, 3, 56 };
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libhmac_sha256_calculate_batch(
+	          buffers,
+	          sizes,
+	          3,
+	          hashes,
+	          3 * LIBHMAC_SHA256_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hashes,
+	          expected_hashes,
+	          3 * LIBHMAC_SHA256_HASH_SIZE );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libhmac_sha256_calculate_batch(
+	          NULL,
+	          sizes,
+	          3,
+	          hashes,
+	          3 * LIBHMAC_SHA256_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha256_calculate_batch(
+	          buffers,
+	          NULL,
+	          3,
+	          hashes,
+	          3 * LIBHMAC_SHA256_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha256_calculate_batch(
+	          buffers,
+	          sizes,
+	          -1,
+	          hashes,
+	          3 * LIBHMAC_SHA256_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha256_calculate_batch(
+	          buffers,
+	          sizes,
+	          3,
+	          NULL,
+	          3 * LIBHMAC_SHA256_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha256_calculate_batch(
+	          buffers,
+	          sizes,
+	          3,
+	          hashes,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha256_calculate_batch(
+	          buffers,
+	          sizes,
+	          3,
+	          hashes,
+	          2 * LIBHMAC_SHA256_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libhmac_sha256_calculate_batch with a missing buffer
+	 */
+	buffers[ 0 ] = NULL;
+
+	result = libhmac_sha256_calculate_batch(
+	          buffers,
+	          sizes,
+	          3,
+	          hashes,
+	          3 * LIBHMAC_SHA256_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libhmac_sha256_calculate_32_bytes function
+ * Returns 1 if successful or 0 if not
+ */
+int hmac_test_sha256_calculate_32_bytes(
+     void )
+{
+	uint8_t data[ 32 ];
+	uint8_t expected_hash[ LIBHMAC_SHA256_HASH_SIZE ];
+	uint8_t hash[ LIBHMAC_SHA256_HASH_SIZE ];
+
+	libcerror_error_t *error = NULL;
+	size_t data_offset       = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	for( data_offset = 0;
+	     data_offset < 32;
+	     data_offset++ )
+	{
+		data[ data_offset ] = (uint8_t) ( 0xa5 ^ data_offset );
+	}
+	result = libhmac_sha256_calculate(
+	          data,
+	          32,
+	          expected_hash,
+	          LIBHMAC_SHA256_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libhmac_sha256_calculate_32_bytes(
+	          data,
+	          hash,
+	          LIBHMAC_SHA256_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hash,
+	          expected_hash,
+	          LIBHMAC_SHA256_HASH_SIZE );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libhmac_sha256_calculate_32_bytes(
+	          NULL,
+	          hash,
+	          LIBHMAC_SHA256_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha256_calculate_32_bytes(
+	          data,
+	          NULL,
+	          LIBHMAC_SHA256_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha256_calculate_32_bytes(
+	          data,
+	          hash,
+	          0,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libhmac_sha256_calculate_64_bytes function
+ * Returns 1 if successful or 0 if not
+ */
+int hmac_test_sha256_calculate_64_bytes(
+     void )
+{
+	uint8_t data[ 64 ];
+	uint8_t expected_hash[ LIBHMAC_SHA256_HASH_SIZE ];
+	uint8_t hash[ LIBHMAC_SHA256_HASH_SIZE ];
+
+	libcerror_error_t *error = NULL;
+	size_t data_offset       = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	for( data_offset = 0;
+	     data_offset < 64;
+	     data_offset++ )
+	{
+		data[ data_offset ] = (uint8_t) ( 0xa5 ^ data_offset );
+	}
+	result = libhmac_sha256_calculate(
+	          data,
+	          64,
+	          expected_hash,
+	          LIBHMAC_SHA256_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libhmac_sha256_calculate_64_bytes(
+	          data,
+	          hash,
+	          LIBHMAC_SHA256_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hash,
+	          expected_hash,
+	          LIBHMAC_SHA256_HASH_SIZE );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libhmac_sha256_calculate_64_bytes(
+	          NULL,
+	          hash,
+	          LIBHMAC_SHA256_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha256_calculate_64_bytes(
+	          data,
+	          NULL,
+	          LIBHMAC_SHA256_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha256_calculate_64_bytes(
+	          data,
+	          hash,
+	          0,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libhmac_sha256_calculate_64_bytes_batch function
+ * Returns 1 if successful or 0 if not
+ */
+int hmac_test_sha256_calculate_64_bytes_batch(
+     void )
+{
+	uint8_t data[ 37 * 64 ];
+	uint8_t expected_hash[ LIBHMAC_SHA256_HASH_SIZE ];
+	uint8_t hashes[ 37 * LIBHMAC_SHA256_HASH_SIZE ];
+
 	libcerror_error_t *error = NULL;
+	size_t data_offset       = 0;
+	int message_index        = 0;
+	int number_of_messages   = 0;
 	int result               = 0;
 
-	/* Initialize test
-	 */
-	memory_set(
-	 data,
-	 0,
-	 208 );
+	/* Initialize test
+	 */
+	for( data_offset = 0;
+	     data_offset < ( 37 * 64 );
+	     data_offset++ )
+	{
+		data[ data_offset ] = (uint8_t) ( data_offset * 7 );
+	}
+	/* Test regular cases
+	 * The numbers of messages cover complete and partial groups of lanes
+	 */
+	for( number_of_messages = 0;
+	     number_of_messages <= 37;
+	     number_of_messages++ )
+	{
+		result = libhmac_sha256_calculate_64_bytes_batch(
+		          data,
+		          (size_t) number_of_messages * 64,
+		          hashes,
+		          37 * LIBHMAC_SHA256_HASH_SIZE,
+		          &error );
+
+		HMAC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HMAC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( message_index = 0;
+		     message_index < number_of_messages;
+		     message_index++ )
+		{
+			result = libhmac_sha256_calculate(
+			          &( data[ message_index * 64 ] ),
+			          64,
+			          expected_hash,
+			          LIBHMAC_SHA256_HASH_SIZE,
+			          &error );
+
+			HMAC_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			HMAC_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = memory_compare(
+			          &( hashes[ message_index * LIBHMAC_SHA256_HASH_SIZE ] ),
+			          expected_hash,
+			          LIBHMAC_SHA256_HASH_SIZE );
+
+			HMAC_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+	}
+	/* Test error cases
+	 */
+	result = libhmac_sha256_calculate_64_bytes_batch(
+	          NULL,
+	          37 * 64,
+	          hashes,
+	          37 * LIBHMAC_SHA256_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-	/* Test regular cases
-	 */
-	result = libhmac_sha256_calculate(
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha256_calculate_64_bytes_batch(
 	          data,
-	          208,
-	          hash,
-	          LIBHMAC_SHA256_HASH_SIZE,
+	          (size_t) SSIZE_MAX + 1,
+	          hashes,
+	          37 * LIBHMAC_SHA256_HASH_SIZE,
 	          &error );
 
 	HMAC_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	HMAC_TEST_ASSERT_IS_NULL(
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-#if defined( HAVE_HMAC_TEST_MEMORY )
-
-	/* Test libhmac_sha256_calculate with malloc failing in libhmac_sha256_initialize
-	 */
-	hmac_test_malloc_attempts_before_fail = 0;
+	libcerror_error_free(
+	 &error );
 
-	result = libhmac_sha256_calculate(
+	result = libhmac_sha256_calculate_64_bytes_batch(
 	          data,
-	          208,
-	          hash,
-	          LIBHMAC_SHA256_HASH_SIZE,
+	          100,
+	          hashes,
+	          37 * LIBHMAC_SHA256_HASH_SIZE,
 	          &error );
 
-	if( hmac_test_malloc_attempts_before_fail != -1 )
-	{
-		hmac_test_malloc_attempts_before_fail = -1;
-	}
-	else
-	{
-		HMAC_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		HMAC_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( HAVE_HMAC_TEST_MEMORY ) */
+	libcerror_error_free(
+	 &error );
 
-	/* Test libhmac_sha256_calculate with libhmac_sha256_update failing
-	 */
-	result = libhmac_sha256_calculate(
+	result = libhmac_sha256_calculate_64_bytes_batch(
+	          data,
+	          37 * 64,
 	          NULL,
-	          208,
-	          hash,
-	          LIBHMAC_SHA256_HASH_SIZE,
+	          37 * LIBHMAC_SHA256_HASH_SIZE,
 	          &error );
 
 	HMAC_TEST_ASSERT_EQUAL_INT(
@@ -159,13 +847,30 @@ int hmac_test_sha256_calculate(
 	libcerror_error_free(
 	 &error );
 
-	/* Test libhmac_sha256_calculate with libhmac_sha256_finalize failing
-	 */
-	result = libhmac_sha256_calculate(
+	result = libhmac_sha256_calculate_64_bytes_batch(
 	          data,
-	          208,
-	          NULL,
-	          LIBHMAC_SHA256_HASH_SIZE,
+	          37 * 64,
+	          hashes,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha256_calculate_64_bytes_batch(
+	          data,
+	          37 * 64,
+	          hashes,
+	          36 * LIBHMAC_SHA256_HASH_SIZE,
 	          &error );
 
 	HMAC_TEST_ASSERT_EQUAL_INT(
@@ -278,9 +983,14 @@ int hmac_test_sha256_calculate_hmac(
 		    0xbf, 0xdc, 0x63, 0x64, 0x4f, 0x07, 0x13, 0x93, 0x8a, 0x7f, 0x51, 0x53, 0x5c, 0x3a, 0x35, 0xe2 }, 32 },
 	};
 
-	libcerror_error_t *error = NULL;
-	int result               = 0;
-	int test_number          = 0;
+	libcerror_error_t *error        = NULL;
+	int result                      = 0;
+	int test_number                 = 0;
+
+#if defined( HAVE_HMAC_TEST_MEMORY )
+	int kernel_type                 = 0;
+	int malloc_attempts_before_fail = 0;
+#endif
 
 	/* Test regular cases
 	 */
@@ -383,36 +1093,53 @@ int hmac_test_sha256_calculate_hmac(
 
 #if defined( HAVE_HMAC_TEST_MEMORY )
 
-	/* Test libhmac_sha256_calculate_hmac with malloc failing
+	/* Test libhmac_sha256_calculate_hmac does not allocate memory
+	 * The libcrypto kernel is skipped since OpenSSL can allocate memory internally
 	 */
-	hmac_test_malloc_attempts_before_fail = 0;
-
-	result = libhmac_sha256_calculate_hmac(
-	          test_vectors[ 0 ].key,
-	          test_vectors[ 0 ].key_size,
-	          test_vectors[ 0 ].data,
-	          test_vectors[ 0 ].data_size,
-	          hmac,
-	          LIBHMAC_SHA256_HASH_SIZE,
+	result = libhmac_get_kernel_type(
+	          LIBHMAC_HASH_ALGORITHM_SHA256,
+	          &kernel_type,
 	          &error );
 
-	if( hmac_test_malloc_attempts_before_fail != -1 )
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( kernel_type != LIBHMAC_KERNEL_TYPE_LIBCRYPTO )
 	{
+		hmac_test_malloc_attempts_before_fail = 0;
+
+		result = libhmac_sha256_calculate_hmac(
+		          test_vectors[ 0 ].key,
+		          test_vectors[ 0 ].key_size,
+		          test_vectors[ 0 ].data,
+		          test_vectors[ 0 ].data_size,
+		          hmac,
+		          LIBHMAC_SHA256_HASH_SIZE,
+		          &error );
+
+		malloc_attempts_before_fail = hmac_test_malloc_attempts_before_fail;
+
 		hmac_test_malloc_attempts_before_fail = -1;
-	}
-	else
-	{
+
 		HMAC_TEST_ASSERT_EQUAL_INT(
 		 "result",
 		 result,
-		 -1 );
+		 1 );
 
-		HMAC_TEST_ASSERT_IS_NOT_NULL(
+		HMAC_TEST_ASSERT_IS_NULL(
 		 "error",
 		 error );
 
-		libcerror_error_free(
-		 &error );
+		HMAC_TEST_ASSERT_EQUAL_INT(
+		 "malloc_attempts_before_fail",
+		 malloc_attempts_before_fail,
+		 0 );
 	}
 #endif /* defined( HAVE_HMAC_TEST_MEMORY ) */
 
@@ -449,6 +1176,180 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libhmac_sha256_compress_blocks function
+ * Returns 1 if successful or 0 if not
+ */
+int hmac_test_sha256_compress_blocks(
+     void )
+{
+	uint8_t blocks[ 3 * LIBHMAC_SHA256_BLOCK_SIZE ];
+	uint8_t expected_hash[ LIBHMAC_SHA256_HASH_SIZE ];
+	uint8_t hash[ LIBHMAC_SHA256_HASH_SIZE ];
+	uint32_t hash_values[ 8 ] = {
+		0x6a09e667UL, 0xbb67ae85UL, 0x3c6ef372UL, 0xa54ff53aUL,
+		0x510e527fUL, 0x9b05688cUL, 0x1f83d9abUL, 0x5be0cd19UL };
+
+	libcerror_error_t *error = NULL;
+	size_t data_offset       = 0;
+	size_t hash_offset       = 0;
+	int result               = 0;
+	int value_index          = 0;
+
+	/* Initialize test
+	 * The last block contains the padding of 2 blocks of data
+	 */
+	for( data_offset = 0;
+	     data_offset < ( 2 * LIBHMAC_SHA256_BLOCK_SIZE );
+	     data_offset++ )
+	{
+		blocks[ data_offset ] = (uint8_t) data_offset;
+	}
+	memory_set(
+	 &( blocks[ 2 * LIBHMAC_SHA256_BLOCK_SIZE ] ),
+	 0,
+	 LIBHMAC_SHA256_BLOCK_SIZE );
+
+	blocks[ 2 * LIBHMAC_SHA256_BLOCK_SIZE ] = 0x80;
+
+	/* The size of the data in bits is stored as a 64-bit big-endian value
+	 */
+	blocks[ ( 3 * LIBHMAC_SHA256_BLOCK_SIZE ) - 2 ] = 0x04;
+
+	result = libhmac_sha256_calculate(
+	          blocks,
+	          2 * LIBHMAC_SHA256_BLOCK_SIZE,
+	          expected_hash,
+	          LIBHMAC_SHA256_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libhmac_sha256_compress_blocks(
+	          hash_values,
+	          blocks,
+	          3,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( hash_offset = 0;
+	     hash_offset < LIBHMAC_SHA256_HASH_SIZE;
+	     hash_offset += 4 )
+	{
+		byte_stream_copy_from_uint32_big_endian(
+		 &( hash[ hash_offset ] ),
+		 hash_values[ value_index ] );
+
+		value_index++;
+	}
+	result = memory_compare(
+	          hash,
+	          expected_hash,
+	          LIBHMAC_SHA256_HASH_SIZE );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libhmac_sha256_compress_blocks(
+	          hash_values,
+	          blocks,
+	          0,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhmac_sha256_compress_blocks(
+	          NULL,
+	          blocks,
+	          3,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha256_compress_blocks(
+	          hash_values,
+	          NULL,
+	          3,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha256_compress_blocks(
+	          hash_values,
+	          blocks,
+	          (size_t) SSIZE_MAX,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -468,10 +1369,30 @@ int main(
 	 "libhmac_sha256_calculate",
 	 hmac_test_sha256_calculate );
 
+	HMAC_TEST_RUN(
+	 "libhmac_sha256_calculate_batch",
+	 hmac_test_sha256_calculate_batch );
+
+	HMAC_TEST_RUN(
+	 "libhmac_sha256_calculate_32_bytes",
+	 hmac_test_sha256_calculate_32_bytes );
+
+	HMAC_TEST_RUN(
+	 "libhmac_sha256_calculate_64_bytes",
+	 hmac_test_sha256_calculate_64_bytes );
+
+	HMAC_TEST_RUN(
+	 "libhmac_sha256_calculate_64_bytes_batch",
+	 hmac_test_sha256_calculate_64_bytes_batch );
+
 	HMAC_TEST_RUN(
 	 "libhmac_sha256_calculate_hmac",
 	 hmac_test_sha256_calculate_hmac );
 
+	HMAC_TEST_RUN(
+	 "libhmac_sha256_compress_blocks",
+	 hmac_test_sha256_compress_blocks );
+
 	return( EXIT_SUCCESS );
 
 on_error:
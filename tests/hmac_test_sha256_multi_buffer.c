@@ -0,0 +1,477 @@
+/*
+ * Library SHA-256 multi-buffer functions test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "hmac_test_libcerror.h"
+#include "hmac_test_libhmac.h"
+#include "hmac_test_macros.h"
+#include "hmac_test_unused.h"
+
+/* Make sure libhmac_sha256_context.h is included to define LIBHMAC_HAVE_SHA256_SUPPORT
+ */
+#include "../libhmac/libhmac_sha256_context.h"
+#include "../libhmac/libhmac_sha256_multi_buffer.h"
+
+#if defined( __GNUC__ ) && !defined( LIBHMAC_DLL_IMPORT ) && !defined( LIBHMAC_HAVE_SHA256_SUPPORT )
+
+/* Tests the libhmac_sha256_multi_buffer_get_transform_function function
+ * and the transform function of every available kernel
+ * Returns 1 if successful or 0 if not
+ */
+int hmac_test_sha256_multi_buffer_get_transform_function(
+     void )
+{
+	uint8_t test_data[ LIBHMAC_SHA256_MULTI_BUFFER_MAXIMUM_NUMBER_OF_LANES * 128 ];
+	uint32_t expected_hash_values[ LIBHMAC_SHA256_MULTI_BUFFER_MAXIMUM_NUMBER_OF_LANES * 8 ];
+	uint32_t lanes_hash_values[ LIBHMAC_SHA256_MULTI_BUFFER_MAXIMUM_NUMBER_OF_LANES * 8 ];
+	const uint8_t *lanes_buffer[ LIBHMAC_SHA256_MULTI_BUFFER_MAXIMUM_NUMBER_OF_LANES ];
+
+	uint32_t initial_hash_values[ 8 ] = {
+		0x6a09e667UL, 0xbb67ae85UL, 0x3c6ef372UL, 0xa54ff53aUL,
+		0x510e527fUL, 0x9b05688cUL, 0x1f83d9abUL, 0x5be0cd19UL };
+
+	libcerror_error_t *error                                                  = NULL;
+	libhmac_kernel_multi_buffer_transform_32bit_function_t transform_function = NULL;
+	libhmac_kernel_transform_32bit_function_t portable_transform_function     = NULL;
+	size_t data_index                                                         = 0;
+	int hash_values_index                                                     = 0;
+	int kernel_type                                                           = 0;
+	int lane_index                                                            = 0;
+	int number_of_lanes                                                       = 0;
+	int result                                                                = 0;
+
+	/* Initialize test
+	 */
+	for( data_index = 0;
+	     data_index < ( LIBHMAC_SHA256_MULTI_BUFFER_MAXIMUM_NUMBER_OF_LANES * 128 );
+	     data_index++ )
+	{
+		test_data[ data_index ] = (uint8_t) ( ( data_index * 7 ) + ( data_index / 128 ) );
+	}
+	result = libhmac_sha256_context_get_transform_function(
+	          LIBHMAC_KERNEL_TYPE_PORTABLE,
+	          &portable_transform_function,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( lane_index = 0;
+	     lane_index < LIBHMAC_SHA256_MULTI_BUFFER_MAXIMUM_NUMBER_OF_LANES;
+	     lane_index++ )
+	{
+		memory_copy(
+		 &( expected_hash_values[ lane_index * 8 ] ),
+		 initial_hash_values,
+		 sizeof( uint32_t ) * 8 );
+
+		result = portable_transform_function(
+		          &( expected_hash_values[ lane_index * 8 ] ),
+		          &( test_data[ lane_index * 128 ] ),
+		          2 );
+
+		HMAC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	/* Test regular cases
+	 */
+	for( kernel_type = LIBHMAC_KERNEL_TYPE_PORTABLE;
+	     kernel_type <= LIBHMAC_KERNEL_TYPE_SHA_NI;
+	     kernel_type++ )
+	{
+		result = libhmac_sha256_multi_buffer_get_transform_function(
+		          kernel_type,
+		          &transform_function,
+		          &number_of_lanes,
+		          &error );
+
+		HMAC_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		HMAC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( kernel_type == LIBHMAC_KERNEL_TYPE_PORTABLE )
+		{
+			HMAC_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+		if( result == 0 )
+		{
+			continue;
+		}
+		HMAC_TEST_ASSERT_GREATER_THAN_INT(
+		 "number_of_lanes",
+		 number_of_lanes,
+		 0 );
+
+		HMAC_TEST_ASSERT_LESS_THAN_INT(
+		 "number_of_lanes",
+		 number_of_lanes,
+		 LIBHMAC_SHA256_MULTI_BUFFER_MAXIMUM_NUMBER_OF_LANES + 1 );
+
+		for( lane_index = 0;
+		     lane_index < number_of_lanes;
+		     lane_index++ )
+		{
+			for( hash_values_index = 0;
+			     hash_values_index < 8;
+			     hash_values_index++ )
+			{
+				lanes_hash_values[ ( hash_values_index * number_of_lanes ) + lane_index ] = initial_hash_values[ hash_values_index ];
+			}
+			lanes_buffer[ lane_index ] = &( test_data[ lane_index * 128 ] );
+		}
+		result = transform_function(
+		          lanes_hash_values,
+		          lanes_buffer,
+		          2 );
+
+		HMAC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		for( lane_index = 0;
+		     lane_index < number_of_lanes;
+		     lane_index++ )
+		{
+			for( hash_values_index = 0;
+			     hash_values_index < 8;
+			     hash_values_index++ )
+			{
+				HMAC_TEST_ASSERT_EQUAL_UINT32(
+				 "lanes_hash_values",
+				 lanes_hash_values[ ( hash_values_index * number_of_lanes ) + lane_index ],
+				 expected_hash_values[ ( lane_index * 8 ) + hash_values_index ] );
+			}
+		}
+	}
+	/* Test error cases
+	 */
+	result = libhmac_sha256_multi_buffer_get_transform_function(
+	          LIBHMAC_KERNEL_TYPE_PORTABLE,
+	          NULL,
+	          &number_of_lanes,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha256_multi_buffer_get_transform_function(
+	          LIBHMAC_KERNEL_TYPE_PORTABLE,
+	          &transform_function,
+	          NULL,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libhmac_sha256_multi_buffer_calculate function
+ * Returns 1 if successful or 0 if not
+ */
+int hmac_test_sha256_multi_buffer_calculate(
+     void )
+{
+	uint8_t data[ 4096 ];
+	uint8_t expected_hashes[ 24 * LIBHMAC_SHA256_HASH_SIZE ];
+	uint8_t hashes[ 24 * LIBHMAC_SHA256_HASH_SIZE ];
+	const uint8_t *buffers[ 24 ];
+
+	/* Sizes that test the padding boundaries and messages of different sizes
+	 * that finish in different lanes
+	 */
+	size_t sizes[ 24 ] = {
+		0, 1, 3, 55, 56, 63, 64, 65, 119, 120, 127, 128,
+		1000, 4096, 17, 200, 2048, 56, 0, 511, 512, 513, 3000, 64 };
+
+	libcerror_error_t *error = NULL;
+	size_t data_index        = 0;
+	int buffer_index         = 0;
+	int number_of_buffers    = 0;
+	int result               = 0;
+	int test_number          = 0;
+
+	/* Initialize test
+	 */
+	for( data_index = 0;
+	     data_index < 4096;
+	     data_index++ )
+	{
+		data[ data_index ] = (uint8_t) ( data_index * 13 );
+	}
+	/* Test regular cases
+	 * 0: messages of different sizes
+	 * 1: messages of the same size, where all lanes finish at the same time
+	 * 2: fewer messages than lanes
+	 */
+	for( test_number = 0;
+	     test_number < 3;
+	     test_number++ )
+	{
+		number_of_buffers = 24;
+
+		if( test_number == 1 )
+		{
+			for( buffer_index = 0;
+			     buffer_index < 24;
+			     buffer_index++ )
+			{
+				sizes[ buffer_index ] = 100;
+			}
+		}
+		else if( test_number == 2 )
+		{
+			number_of_buffers = 12;
+		}
+		for( buffer_index = 0;
+		     buffer_index < number_of_buffers;
+		     buffer_index++ )
+		{
+			buffers[ buffer_index ] = &( data[ buffer_index ] );
+
+			if( sizes[ buffer_index ] > ( 4096 - (size_t) buffer_index ) )
+			{
+				buffers[ buffer_index ] = data;
+			}
+			result = libhmac_sha256_calculate(
+			          buffers[ buffer_index ],
+			          sizes[ buffer_index ],
+			          &( expected_hashes[ buffer_index * LIBHMAC_SHA256_HASH_SIZE ] ),
+			          LIBHMAC_SHA256_HASH_SIZE,
+			          &error );
+
+			HMAC_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			HMAC_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		result = libhmac_sha256_multi_buffer_calculate(
+		          buffers,
+		          sizes,
+		          number_of_buffers,
+		          hashes,
+		          &error );
+
+		HMAC_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		HMAC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( result != 0 )
+		{
+			result = memory_compare(
+			          hashes,
+			          expected_hashes,
+			          number_of_buffers * LIBHMAC_SHA256_HASH_SIZE );
+
+			HMAC_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+	}
+	/* Test error cases
+	 */
+	result = libhmac_sha256_multi_buffer_calculate(
+	          NULL,
+	          sizes,
+	          24,
+	          hashes,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha256_multi_buffer_calculate(
+	          buffers,
+	          NULL,
+	          24,
+	          hashes,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha256_multi_buffer_calculate(
+	          buffers,
+	          sizes,
+	          -1,
+	          hashes,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha256_multi_buffer_calculate(
+	          buffers,
+	          sizes,
+	          24,
+	          NULL,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBHMAC_DLL_IMPORT ) && !defined( LIBHMAC_HAVE_SHA256_SUPPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc HMAC_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] HMAC_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc HMAC_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] HMAC_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	HMAC_TEST_UNREFERENCED_PARAMETER( argc )
+	HMAC_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBHMAC_DLL_IMPORT ) && !defined( LIBHMAC_HAVE_SHA256_SUPPORT )
+
+	HMAC_TEST_RUN(
+	 "libhmac_sha256_multi_buffer_get_transform_function",
+	 hmac_test_sha256_multi_buffer_get_transform_function );
+
+	HMAC_TEST_RUN(
+	 "libhmac_sha256_multi_buffer_calculate",
+	 hmac_test_sha256_multi_buffer_calculate );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBHMAC_DLL_IMPORT ) && !defined( LIBHMAC_HAVE_SHA256_SUPPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBHMAC_DLL_IMPORT ) && !defined( LIBHMAC_HAVE_SHA256_SUPPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBHMAC_DLL_IMPORT ) && !defined( LIBHMAC_HAVE_SHA256_SUPPORT ) */
+}
+
@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <memory.h>
 #include <types.h>
 
@@ -75,8 +76,13 @@ int hmac_test_sha512_calculate(
 	uint8_t data[ 208 ];
 	uint8_t hash[ LIBHMAC_SHA512_HASH_SIZE ];
 
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	libcerror_error_t *error        = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_HMAC_TEST_MEMORY )
+	int kernel_type                 = 0;
+	int malloc_attempts_before_fail = 0;
+#endif
 
 	/* Initialize test
 	 */
@@ -103,41 +109,58 @@ int hmac_test_sha512_calculate(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
 #if defined( HAVE_HMAC_TEST_MEMORY )
 
-	/* Test libhmac_sha512_calculate with malloc failing in libhmac_sha512_initialize
+	/* Test libhmac_sha512_calculate does not allocate memory
+	 * The libcrypto kernel is skipped since OpenSSL can allocate memory internally
 	 */
-	hmac_test_malloc_attempts_before_fail = 0;
-
-	result = libhmac_sha512_calculate(
-	          data,
-	          208,
-	          hash,
-	          LIBHMAC_SHA512_HASH_SIZE,
+	result = libhmac_get_kernel_type(
+	          LIBHMAC_HASH_ALGORITHM_SHA512,
+	          &kernel_type,
 	          &error );
 
-	if( hmac_test_malloc_attempts_before_fail != -1 )
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( kernel_type != LIBHMAC_KERNEL_TYPE_LIBCRYPTO )
 	{
+		hmac_test_malloc_attempts_before_fail = 0;
+
+		result = libhmac_sha512_calculate(
+		          data,
+		          208,
+		          hash,
+		          LIBHMAC_SHA512_HASH_SIZE,
+		          &error );
+
+		malloc_attempts_before_fail = hmac_test_malloc_attempts_before_fail;
+
 		hmac_test_malloc_attempts_before_fail = -1;
-	}
-	else
-	{
+
 		HMAC_TEST_ASSERT_EQUAL_INT(
 		 "result",
 		 result,
-		 -1 );
+		 1 );
 
-		HMAC_TEST_ASSERT_IS_NOT_NULL(
+		HMAC_TEST_ASSERT_IS_NULL(
 		 "error",
 		 error );
 
-		libcerror_error_free(
-		 &error );
+		HMAC_TEST_ASSERT_EQUAL_INT(
+		 "malloc_attempts_before_fail",
+		 malloc_attempts_before_fail,
+		 0 );
 	}
 #endif /* defined( HAVE_HMAC_TEST_MEMORY ) */
 
+	/* Test error cases
+	 */
 	/* Test libhmac_sha512_calculate with libhmac_sha512_update failing
 	 */
 	result = libhmac_sha512_calculate(
@@ -191,6 +214,225 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libhmac_sha512_calculate_batch function
+ * Returns 1 if successful or 0 if not
+ */
+int hmac_test_sha512_calculate_batch(
+     void )
+{
+	uint8_t expected_hashes[ 3 * LIBHMAC_SHA512_HASH_SIZE ] = {
+		0xcf, 0x83, 0xe1, 0x35, 0x7e, 0xef, 0xb8, 0xbd, 0xf1, 0x54, 0x28, 0x50, 0xd6, 0x6d, 0x80, 0x07,
+		0xd6, 0x20, 0xe4, 0x05, 0x0b, 0x57, 0x15, 0xdc, 0x83, 0xf4, 0xa9, 0x21, 0xd3, 0x6c, 0xe9, 0xce,
+		0x47, 0xd0, 0xd1, 0x3c, 0x5d, 0x85, 0xf2, 0xb0, 0xff, 0x83, 0x18, 0xd2, 0x87, 0x7e, 0xec, 0x2f,
+		0x63, 0xb9, 0x31, 0xbd, 0x47, 0x41, 0x7a, 0x81, 0xa5, 0x38, 0x32, 0x7a, 0xf9, 0x27, 0xda, 0x3e,
+		0xdd, 0xaf, 0x35, 0xa1, 0x93, 0x61, 0x7a, 0xba, 0xcc, 0x41, 0x73, 0x49, 0xae, 0x20, 0x41, 0x31,
+		0x12, 0xe6, 0xfa, 0x4e, 0x89, 0xa9, 0x7e, 0xa2, 0x0a, 0x9e, 0xee, 0xe6, 0x4b, 0x55, 0xd3, 0x9a,
+		0x21, 0x92, 0x99, 0x2a, 0x27, 0x4f, 0xc1, 0xa8, 0x36, 0xba, 0x3c, 0x23, 0xa3, 0xfe, 0xeb, 0xbd,
+		0x45, 0x4d, 0x44, 0x23, 0x64, 0x3c, 0xe8, 0x0e, 0x2a, 0x9a, 0xc9, 0x4f, 0xa5, 0x4c, 0xa4, 0x9f,
+		0x20, 0x4a, 0x8f, 0xc6, 0xdd, 0xa8, 0x2f, 0x0a, 0x0c, 0xed, 0x7b, 0xeb, 0x8e, 0x08, 0xa4, 0x16,
+		0x57, 0xc1, 0x6e, 0xf4, 0x68, 0xb2, 0x28, 0xa8, 0x27, 0x9b, 0xe3, 0x31, 0xa7, 0x03, 0xc3, 0x35,
+		0x96, 0xfd, 0x15, 0xc1, 0x3b, 0x1b, 0x07, 0xf9, 0xaa, 0x1d, 0x3b, 0xea, 0x57, 0x78, 0x9c, 0xa0,
+		0x31, 0xad, 0x85, 0xc7, 0xa7, 0x1d, 0xd7, 0x03, 0x54, 0xec, 0x63, 0x12, 0x38, 0xca, 0x34, 0x45 };
+
+	uint8_t hashes[ 3 * LIBHMAC_SHA512_HASH_SIZE ];
+
+	const uint8_t *buffers[ 3 ] = {
+		(uint8_t *) "",
+		(uint8_t *) "abc",
+		(uint8_t *) "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq" };
+
+	size_t sizes[ 3 ] = {
+		0, 3, 56 };
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libhmac_sha512_calculate_batch(
+	          buffers,
+	          sizes,
+	          3,
+	          hashes,
+	          3 * LIBHMAC_SHA512_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hashes,
+	          expected_hashes,
+	          3 * LIBHMAC_SHA512_HASH_SIZE );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libhmac_sha512_calculate_batch(
+	          NULL,
+	          sizes,
+	          3,
+	          hashes,
+	          3 * LIBHMAC_SHA512_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha512_calculate_batch(
+	          buffers,
+	          NULL,
+	          3,
+	          hashes,
+	          3 * LIBHMAC_SHA512_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha512_calculate_batch(
+	          buffers,
+	          sizes,
+	          -1,
+	          hashes,
+	          3 * LIBHMAC_SHA512_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha512_calculate_batch(
+	          buffers,
+	          sizes,
+	          3,
+	          NULL,
+	          3 * LIBHMAC_SHA512_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha512_calculate_batch(
+	          buffers,
+	          sizes,
+	          3,
+	          hashes,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha512_calculate_batch(
+	          buffers,
+	          sizes,
+	          3,
+	          hashes,
+	          2 * LIBHMAC_SHA512_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libhmac_sha512_calculate_batch with a missing buffer
+	 */
+	buffers[ 0 ] = NULL;
+
+	result = libhmac_sha512_calculate_batch(
+	          buffers,
+	          sizes,
+	          3,
+	          hashes,
+	          3 * LIBHMAC_SHA512_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the libhmac_sha512_calculate_hmac function
  * Returns 1 if successful or 0 if not
  */
@@ -290,9 +532,14 @@ int hmac_test_sha512_calculate_hmac(
 		    0x13, 0x46, 0x76, 0xfb, 0x6d, 0xe0, 0x44, 0x60, 0x65, 0xc9, 0x74, 0x40, 0xfa, 0x8c, 0x6a, 0x58 }, 64 },
 	};
 
-	libcerror_error_t *error = NULL;
-	int result               = 0;
-	int test_number          = 0;
+	libcerror_error_t *error        = NULL;
+	int result                      = 0;
+	int test_number                 = 0;
+
+#if defined( HAVE_HMAC_TEST_MEMORY )
+	int kernel_type                 = 0;
+	int malloc_attempts_before_fail = 0;
+#endif
 
 	/* Test regular cases
 	 */
@@ -395,36 +642,53 @@ int hmac_test_sha512_calculate_hmac(
 
 #if defined( HAVE_HMAC_TEST_MEMORY )
 
-	/* Test libhmac_sha512_calculate_hmac with malloc failing
+	/* Test libhmac_sha512_calculate_hmac does not allocate memory
+	 * The libcrypto kernel is skipped since OpenSSL can allocate memory internally
 	 */
-	hmac_test_malloc_attempts_before_fail = 0;
-
-	result = libhmac_sha512_calculate_hmac(
-	          test_vectors[ 0 ].key,
-	          test_vectors[ 0 ].key_size,
-	          test_vectors[ 0 ].data,
-	          test_vectors[ 0 ].data_size,
-	          hmac,
-	          LIBHMAC_SHA512_HASH_SIZE,
+	result = libhmac_get_kernel_type(
+	          LIBHMAC_HASH_ALGORITHM_SHA512,
+	          &kernel_type,
 	          &error );
 
-	if( hmac_test_malloc_attempts_before_fail != -1 )
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( kernel_type != LIBHMAC_KERNEL_TYPE_LIBCRYPTO )
 	{
+		hmac_test_malloc_attempts_before_fail = 0;
+
+		result = libhmac_sha512_calculate_hmac(
+		          test_vectors[ 0 ].key,
+		          test_vectors[ 0 ].key_size,
+		          test_vectors[ 0 ].data,
+		          test_vectors[ 0 ].data_size,
+		          hmac,
+		          LIBHMAC_SHA512_HASH_SIZE,
+		          &error );
+
+		malloc_attempts_before_fail = hmac_test_malloc_attempts_before_fail;
+
 		hmac_test_malloc_attempts_before_fail = -1;
-	}
-	else
-	{
+
 		HMAC_TEST_ASSERT_EQUAL_INT(
 		 "result",
 		 result,
-		 -1 );
+		 1 );
 
-		HMAC_TEST_ASSERT_IS_NOT_NULL(
+		HMAC_TEST_ASSERT_IS_NULL(
 		 "error",
 		 error );
 
-		libcerror_error_free(
-		 &error );
+		HMAC_TEST_ASSERT_EQUAL_INT(
+		 "malloc_attempts_before_fail",
+		 malloc_attempts_before_fail,
+		 0 );
 	}
 #endif /* defined( HAVE_HMAC_TEST_MEMORY ) */
 
@@ -461,6 +725,180 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libhmac_sha512_compress_blocks function
+ * Returns 1 if successful or 0 if not
+ */
+int hmac_test_sha512_compress_blocks(
+     void )
+{
+	uint8_t blocks[ 3 * LIBHMAC_SHA512_BLOCK_SIZE ];
+	uint8_t expected_hash[ LIBHMAC_SHA512_HASH_SIZE ];
+	uint8_t hash[ LIBHMAC_SHA512_HASH_SIZE ];
+	uint64_t hash_values[ 8 ] = {
+		0x6a09e667f3bcc908UL, 0xbb67ae8584caa73bUL, 0x3c6ef372fe94f82bUL, 0xa54ff53a5f1d36f1UL,
+		0x510e527fade682d1UL, 0x9b05688c2b3e6c1fUL, 0x1f83d9abfb41bd6bUL, 0x5be0cd19137e2179UL };
+
+	libcerror_error_t *error = NULL;
+	size_t data_offset       = 0;
+	size_t hash_offset       = 0;
+	int result               = 0;
+	int value_index          = 0;
+
+	/* Initialize test
+	 * The last block contains the padding of 2 blocks of data
+	 */
+	for( data_offset = 0;
+	     data_offset < ( 2 * LIBHMAC_SHA512_BLOCK_SIZE );
+	     data_offset++ )
+	{
+		blocks[ data_offset ] = (uint8_t) data_offset;
+	}
+	memory_set(
+	 &( blocks[ 2 * LIBHMAC_SHA512_BLOCK_SIZE ] ),
+	 0,
+	 LIBHMAC_SHA512_BLOCK_SIZE );
+
+	blocks[ 2 * LIBHMAC_SHA512_BLOCK_SIZE ] = 0x80;
+
+	/* The size of the data in bits is stored as a 128-bit big-endian value
+	 */
+	blocks[ ( 3 * LIBHMAC_SHA512_BLOCK_SIZE ) - 2 ] = 0x08;
+
+	result = libhmac_sha512_calculate(
+	          blocks,
+	          2 * LIBHMAC_SHA512_BLOCK_SIZE,
+	          expected_hash,
+	          LIBHMAC_SHA512_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libhmac_sha512_compress_blocks(
+	          hash_values,
+	          blocks,
+	          3,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( hash_offset = 0;
+	     hash_offset < LIBHMAC_SHA512_HASH_SIZE;
+	     hash_offset += 8 )
+	{
+		byte_stream_copy_from_uint64_big_endian(
+		 &( hash[ hash_offset ] ),
+		 hash_values[ value_index ] );
+
+		value_index++;
+	}
+	result = memory_compare(
+	          hash,
+	          expected_hash,
+	          LIBHMAC_SHA512_HASH_SIZE );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libhmac_sha512_compress_blocks(
+	          hash_values,
+	          blocks,
+	          0,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhmac_sha512_compress_blocks(
+	          NULL,
+	          blocks,
+	          3,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha512_compress_blocks(
+	          hash_values,
+	          NULL,
+	          3,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha512_compress_blocks(
+	          hash_values,
+	          blocks,
+	          (size_t) SSIZE_MAX,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -480,10 +918,18 @@ int main(
 	 "libhmac_sha512_calculate",
 	 hmac_test_sha512_calculate );
 
+	HMAC_TEST_RUN(
+	 "libhmac_sha512_calculate_batch",
+	 hmac_test_sha512_calculate_batch );
+
 	HMAC_TEST_RUN(
 	 "libhmac_sha512_calculate_hmac",
 	 hmac_test_sha512_calculate_hmac );
 
+	HMAC_TEST_RUN(
+	 "libhmac_sha512_compress_blocks",
+	 hmac_test_sha512_compress_blocks );
+
 	return( EXIT_SUCCESS );
 
 on_error:
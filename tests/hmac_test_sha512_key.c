@@ -0,0 +1,1027 @@
+/*
+ * Library SHA-512 HMAC key functions test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "hmac_test_libcerror.h"
+#include "hmac_test_libhmac.h"
+#include "hmac_test_macros.h"
+#include "hmac_test_memory.h"
+#include "hmac_test_unused.h"
+
+/* Tests the libhmac_sha512_key_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int hmac_test_sha512_key_initialize(
+     void )
+{
+	uint8_t key_data[ 16 ]           = {
+		0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f };
+
+	libcerror_error_t *error         = NULL;
+	libhmac_sha512_key_t *key        = NULL;
+	int result                       = 0;
+
+#if defined( HAVE_HMAC_TEST_MEMORY )
+	int number_of_malloc_fail_tests  = 1;
+	int number_of_memset_fail_tests  = 1;
+	int test_number                  = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libhmac_sha512_key_initialize(
+	          &key,
+	          key_data,
+	          16,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "key",
+	 key );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhmac_sha512_key_free(
+	          &key,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "key",
+	 key );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhmac_sha512_key_initialize(
+	          NULL,
+	          key_data,
+	          16,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	key = (libhmac_sha512_key_t *) 0x12345678UL;
+
+	result = libhmac_sha512_key_initialize(
+	          &key,
+	          key_data,
+	          16,
+	          &error );
+
+	key = NULL;
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha512_key_initialize(
+	          &key,
+	          NULL,
+	          16,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "key",
+	 key );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha512_key_initialize(
+	          &key,
+	          key_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "key",
+	 key );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_HMAC_TEST_MEMORY )
+
+	/* 1 fail in memory_allocate_structure
+	 */
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libhmac_sha512_key_initialize with malloc failing
+		 */
+		hmac_test_malloc_attempts_before_fail = test_number;
+
+		result = libhmac_sha512_key_initialize(
+		          &key,
+		          key_data,
+		          16,
+		          &error );
+
+		if( hmac_test_malloc_attempts_before_fail != -1 )
+		{
+			hmac_test_malloc_attempts_before_fail = -1;
+
+			if( key != NULL )
+			{
+				libhmac_sha512_key_free(
+				 &key,
+				 NULL );
+			}
+		}
+		else
+		{
+			HMAC_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			HMAC_TEST_ASSERT_IS_NULL(
+			 "key",
+			 key );
+
+			HMAC_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* 1 fail in memset after memory_allocate_structure
+	 */
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libhmac_sha512_key_initialize with memset failing
+		 */
+		hmac_test_memset_attempts_before_fail = test_number;
+
+		result = libhmac_sha512_key_initialize(
+		          &key,
+		          key_data,
+		          16,
+		          &error );
+
+		if( hmac_test_memset_attempts_before_fail != -1 )
+		{
+			hmac_test_memset_attempts_before_fail = -1;
+
+			if( key != NULL )
+			{
+				libhmac_sha512_key_free(
+				 &key,
+				 NULL );
+			}
+		}
+		else
+		{
+			HMAC_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			HMAC_TEST_ASSERT_IS_NULL(
+			 "key",
+			 key );
+
+			HMAC_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_HMAC_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( key != NULL )
+	{
+		libhmac_sha512_key_free(
+		 &key,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libhmac_sha512_key_free function
+ * Returns 1 if successful or 0 if not
+ */
+int hmac_test_sha512_key_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libhmac_sha512_key_free(
+	          NULL,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libhmac_sha512_key_calculate_hmac function
+ * Returns 1 if successful or 0 if not
+ */
+int hmac_test_sha512_key_calculate_hmac(
+     void )
+{
+	uint8_t expected_hmac[ LIBHMAC_SHA512_HASH_SIZE ];
+	uint8_t hmac[ LIBHMAC_SHA512_HASH_SIZE ];
+	uint8_t test_data[ 256 ];
+
+	size_t key_data_sizes[ 7 ] = { 0, 20, 63, 64, 65, 128, 131 };
+	size_t data_sizes[ 6 ]     = { 0, 3, 55, 56, 64, 200 };
+	libcerror_error_t *error   = NULL;
+	libhmac_sha512_key_t *key  = NULL;
+	size_t data_offset         = 0;
+	int data_size_index        = 0;
+	int key_data_size_index    = 0;
+	int result                 = 0;
+
+	for( data_offset = 0;
+	     data_offset < 256;
+	     data_offset++ )
+	{
+		test_data[ data_offset ] = (uint8_t) ( 0xff - data_offset );
+	}
+	/* Test regular cases
+	 */
+	for( key_data_size_index = 0;
+	     key_data_size_index < 7;
+	     key_data_size_index++ )
+	{
+		result = libhmac_sha512_key_initialize(
+		          &key,
+		          test_data,
+		          key_data_sizes[ key_data_size_index ],
+		          &error );
+
+		HMAC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HMAC_TEST_ASSERT_IS_NOT_NULL(
+		 "key",
+		 key );
+
+		HMAC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( data_size_index = 0;
+		     data_size_index < 6;
+		     data_size_index++ )
+		{
+			result = libhmac_sha512_calculate_hmac(
+			          test_data,
+			          key_data_sizes[ key_data_size_index ],
+			          &( test_data[ 56 ] ),
+			          data_sizes[ data_size_index ],
+			          expected_hmac,
+			          LIBHMAC_SHA512_HASH_SIZE,
+			          &error );
+
+			HMAC_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			HMAC_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libhmac_sha512_key_calculate_hmac(
+			          key,
+			          &( test_data[ 56 ] ),
+			          data_sizes[ data_size_index ],
+			          hmac,
+			          LIBHMAC_SHA512_HASH_SIZE,
+			          &error );
+
+			HMAC_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			HMAC_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = memory_compare(
+			          hmac,
+			          expected_hmac,
+			          LIBHMAC_SHA512_HASH_SIZE );
+
+			HMAC_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+		result = libhmac_sha512_key_free(
+		          &key,
+		          &error );
+
+		HMAC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HMAC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Initialize test
+	 */
+	result = libhmac_sha512_key_initialize(
+	          &key,
+	          test_data,
+	          20,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "key",
+	 key );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhmac_sha512_key_calculate_hmac(
+	          NULL,
+	          test_data,
+	          3,
+	          hmac,
+	          LIBHMAC_SHA512_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha512_key_calculate_hmac(
+	          key,
+	          NULL,
+	          3,
+	          hmac,
+	          LIBHMAC_SHA512_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha512_key_calculate_hmac(
+	          key,
+	          test_data,
+	          3,
+	          NULL,
+	          LIBHMAC_SHA512_HASH_SIZE,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha512_key_calculate_hmac(
+	          key,
+	          test_data,
+	          3,
+	          hmac,
+	          LIBHMAC_SHA512_HASH_SIZE - 1,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libhmac_sha512_key_free(
+	          &key,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "key",
+	 key );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( key != NULL )
+	{
+		libhmac_sha512_key_free(
+		 &key,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libhmac_sha512_key_verify_hmac_batch function
+ * Returns 1 if successful or 0 if not
+ */
+int hmac_test_sha512_key_verify_hmac_batch(
+     void )
+{
+	uint8_t hmacs[ 40 * LIBHMAC_SHA512_HASH_SIZE ];
+	uint8_t test_data[ 256 ];
+	uint8_t results[ 5 ];
+	const uint8_t *buffers[ 40 ];
+	size_t sizes[ 40 ];
+
+	libcerror_error_t *error  = NULL;
+	libhmac_sha512_key_t *key = NULL;
+	size_t data_offset        = 0;
+	int buffer_index          = 0;
+	int result                = 0;
+
+	for( data_offset = 0;
+	     data_offset < 256;
+	     data_offset++ )
+	{
+		test_data[ data_offset ] = (uint8_t) ( 0xff - data_offset );
+	}
+	/* Initialize test
+	 */
+	result = libhmac_sha512_key_initialize(
+	          &key,
+	          test_data,
+	          20,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "key",
+	 key );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( buffer_index = 0;
+	     buffer_index < 40;
+	     buffer_index++ )
+	{
+		buffers[ buffer_index ] = &( test_data[ buffer_index ] );
+		sizes[ buffer_index ]   = (size_t) ( buffer_index * 5 );
+
+		result = libhmac_sha512_key_calculate_hmac(
+		          key,
+		          buffers[ buffer_index ],
+		          sizes[ buffer_index ],
+		          &( hmacs[ buffer_index * LIBHMAC_SHA512_HASH_SIZE ] ),
+		          LIBHMAC_SHA512_HASH_SIZE,
+		          &error );
+
+		HMAC_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HMAC_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases
+	 */
+	result = libhmac_sha512_key_verify_hmac_batch(
+	          key,
+	          buffers,
+	          sizes,
+	          40,
+	          hmacs,
+	          40 * LIBHMAC_SHA512_HASH_SIZE,
+	          results,
+	          5,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( buffer_index = 0;
+	     buffer_index < 5;
+	     buffer_index++ )
+	{
+		HMAC_TEST_ASSERT_EQUAL_UINT8(
+		 "results[ buffer_index ]",
+		 results[ buffer_index ],
+		 (uint8_t) 0xff );
+	}
+	hmacs[ ( 4 * LIBHMAC_SHA512_HASH_SIZE ) - 1 ] ^= 0x01;
+	hmacs[ 37 * LIBHMAC_SHA512_HASH_SIZE ]        ^= 0x80;
+
+	result = libhmac_sha512_key_verify_hmac_batch(
+	          key,
+	          buffers,
+	          sizes,
+	          40,
+	          hmacs,
+	          40 * LIBHMAC_SHA512_HASH_SIZE,
+	          results,
+	          5,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	HMAC_TEST_ASSERT_EQUAL_UINT8(
+	 "results[ 0 ]",
+	 results[ 0 ],
+	 (uint8_t) 0xf7 );
+
+	HMAC_TEST_ASSERT_EQUAL_UINT8(
+	 "results[ 1 ]",
+	 results[ 1 ],
+	 (uint8_t) 0xff );
+
+	HMAC_TEST_ASSERT_EQUAL_UINT8(
+	 "results[ 4 ]",
+	 results[ 4 ],
+	 (uint8_t) 0xdf );
+
+	/* Test a single buffer
+	 */
+	result = libhmac_sha512_key_verify_hmac_batch(
+	          key,
+	          &( buffers[ 37 ] ),
+	          &( sizes[ 37 ] ),
+	          1,
+	          &( hmacs[ 37 * LIBHMAC_SHA512_HASH_SIZE ] ),
+	          LIBHMAC_SHA512_HASH_SIZE,
+	          results,
+	          1,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	HMAC_TEST_ASSERT_EQUAL_UINT8(
+	 "results[ 0 ]",
+	 results[ 0 ],
+	 (uint8_t) 0x00 );
+
+	/* Test no buffers
+	 */
+	result = libhmac_sha512_key_verify_hmac_batch(
+	          key,
+	          buffers,
+	          sizes,
+	          0,
+	          hmacs,
+	          0,
+	          results,
+	          0,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhmac_sha512_key_verify_hmac_batch(
+	          NULL,
+	          buffers,
+	          sizes,
+	          40,
+	          hmacs,
+	          40 * LIBHMAC_SHA512_HASH_SIZE,
+	          results,
+	          5,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha512_key_verify_hmac_batch(
+	          key,
+	          NULL,
+	          sizes,
+	          40,
+	          hmacs,
+	          40 * LIBHMAC_SHA512_HASH_SIZE,
+	          results,
+	          5,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha512_key_verify_hmac_batch(
+	          key,
+	          buffers,
+	          NULL,
+	          40,
+	          hmacs,
+	          40 * LIBHMAC_SHA512_HASH_SIZE,
+	          results,
+	          5,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha512_key_verify_hmac_batch(
+	          key,
+	          buffers,
+	          sizes,
+	          -1,
+	          hmacs,
+	          40 * LIBHMAC_SHA512_HASH_SIZE,
+	          results,
+	          5,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha512_key_verify_hmac_batch(
+	          key,
+	          buffers,
+	          sizes,
+	          40,
+	          NULL,
+	          40 * LIBHMAC_SHA512_HASH_SIZE,
+	          results,
+	          5,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha512_key_verify_hmac_batch(
+	          key,
+	          buffers,
+	          sizes,
+	          40,
+	          hmacs,
+	          ( 40 * LIBHMAC_SHA512_HASH_SIZE ) - 1,
+	          results,
+	          5,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha512_key_verify_hmac_batch(
+	          key,
+	          buffers,
+	          sizes,
+	          40,
+	          hmacs,
+	          40 * LIBHMAC_SHA512_HASH_SIZE,
+	          NULL,
+	          5,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhmac_sha512_key_verify_hmac_batch(
+	          key,
+	          buffers,
+	          sizes,
+	          40,
+	          hmacs,
+	          40 * LIBHMAC_SHA512_HASH_SIZE,
+	          results,
+	          4,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HMAC_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libhmac_sha512_key_free(
+	          &key,
+	          &error );
+
+	HMAC_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "key",
+	 key );
+
+	HMAC_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( key != NULL )
+	{
+		libhmac_sha512_key_free(
+		 &key,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc HMAC_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] HMAC_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc HMAC_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] HMAC_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	HMAC_TEST_UNREFERENCED_PARAMETER( argc )
+	HMAC_TEST_UNREFERENCED_PARAMETER( argv )
+
+	HMAC_TEST_RUN(
+	 "libhmac_sha512_key_initialize",
+	 hmac_test_sha512_key_initialize );
+
+	HMAC_TEST_RUN(
+	 "libhmac_sha512_key_free",
+	 hmac_test_sha512_key_free );
+
+	HMAC_TEST_RUN(
+	 "libhmac_sha512_key_calculate_hmac",
+	 hmac_test_sha512_key_calculate_hmac );
+
+	HMAC_TEST_RUN(
+	 "libhmac_sha512_key_verify_hmac_batch",
+	 hmac_test_sha512_key_verify_hmac_batch );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -1,6 +1,6 @@
 # Tests library functions and types.
 
-$LibraryTests = "error md5 md5_context sha1 sha1_context sha224 sha224_context sha256 sha256_context sha512 sha512_context support"
+$LibraryTests = "error kernel md5 md5_context md5_hmac_context md5_job_manager md5_key md5_multi_buffer sha1 sha1_context sha1_hmac_context sha1_job_manager sha1_key sha1_multi_buffer sha224 sha224_context sha224_hmac_context sha224_job_manager sha224_key sha256 sha256_context sha256_hmac_context sha256_job_manager sha256_key sha256_multi_buffer sha512 sha512_context sha512_hmac_context sha512_job_manager sha512_key sha512_multi_buffer support"
 $LibraryTestsWithInput = ""
 $OptionSets = "" -split " "
 